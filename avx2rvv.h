@@ -3,6 +3,9 @@
 
 #if defined(__riscv) || defined(__riscv__)
 #include <riscv_vector.h>
+#if defined(__riscv_zbc) && !defined(__riscv_zvbc)
+#include <riscv_bitmanip.h>
+#endif
 #define AVX2RVV_IMPLEMENTATION
 #elif defined(__x86_64__) || defined(__i386__)
 #include <immintrin.h>
@@ -34,38 +37,323 @@
     #endif
 #endif
 
+/* ===== Vector length configuration ===== */
+/* AVX2RVV_VLEN is the VLEN the register layout is built for. A pinned VLEN
+ * (-mrvv-vector-bits=zvl) wins over the Zvl*b minimum; without either, the
+ * layout falls back to the VLEN=128 baseline of the V extension. */
+#if defined(__riscv_v_fixed_vlen)
+#define AVX2RVV_VLEN __riscv_v_fixed_vlen
+#elif defined(__riscv_v_min_vlen)
+#define AVX2RVV_VLEN __riscv_v_min_vlen
+#else
+#define AVX2RVV_VLEN 128
+#endif
+
+#define AVX2RVV_CAT_(a, b) a##b
+#define AVX2RVV_CAT(a, b) AVX2RVV_CAT_(a, b)
+
+#if AVX2RVV_VLEN < 128
+#error "avx2rvv.h requires VLEN >= 128"
+#endif
+
+/* A 512-bit value is kept in a register group of AVX512_LMUL registers:
+ * four at VLEN=128, two at VLEN=256 and a single register from VLEN=512 */
+#if AVX2RVV_VLEN >= 512
+#define AVX512_LMUL m1
+#elif AVX2RVV_VLEN >= 256
+#define AVX512_LMUL m2
+#else
+#define AVX512_LMUL m4
+#endif
+
+/* Paste the 512-bit LMUL onto a type-suffixed RVV intrinsic name:
+ * _avx512_rvv(vle16_v_i16) -> __riscv_vle16_v_i16m4 at VLEN=128 */
+#define _avx512_rvv(op) AVX2RVV_CAT(__riscv_##op, AVX512_LMUL)
+#define _avx512_type(t) AVX2RVV_CAT(AVX2RVV_CAT(v##t, AVX512_LMUL), _t)
+
+/* With a pinned VLEN the group is exactly 512 bits wide and the vector
+ * types can be made fixed-length, so they may be used as struct members,
+ * array elements and with sizeof just like the x86 types. VLEN > 512 and
+ * VLEN-agnostic builds use the sizeless group. */
+#if defined(__riscv_v_fixed_vlen) && __riscv_v_fixed_vlen <= 512
+#define AVX512_FIXED __attribute__((riscv_rvv_vector_bits(512)))
+#else
+#define AVX512_FIXED
+#endif
+
+/* A 256-bit value uses the same scheme one step down: an LMUL=2 group at
+ * VLEN=128 and a single register from VLEN=256. AVX256_HALF is the LMUL of
+ * half a 256-bit value, the result of a narrowing op. */
+#if AVX2RVV_VLEN >= 256
+#define AVX256_LMUL m1
+#define AVX256_HALF mf2
+#else
+#define AVX256_LMUL m2
+#define AVX256_HALF m1
+#endif
+
+#define _avx256_rvv(op) AVX2RVV_CAT(__riscv_##op, AVX256_LMUL)
+#define _avx256_type(t) AVX2RVV_CAT(AVX2RVV_CAT(v##t, AVX256_LMUL), _t)
+/* Widen a half-width narrowing result back to the 256-bit LMUL:
+ * _avx256_ext(i8, x) -> __riscv_vlmul_ext_v_i8m1_i8m2(x) at VLEN=128 */
+#define _avx256_ext(t, x)                                                      \
+  AVX2RVV_CAT(AVX2RVV_CAT(AVX2RVV_CAT(__riscv_vlmul_ext_v_##t, AVX256_HALF),   \
+                          _##t),                                               \
+              AVX256_LMUL)(x)
+
+#if defined(__riscv_v_fixed_vlen) && __riscv_v_fixed_vlen <= 256
+#define AVX256_FIXED __attribute__((riscv_rvv_vector_bits(256)))
+#else
+#define AVX256_FIXED
+#endif
+
+/* LMUL of the 64-bit byte offsets that widen 32-bit lanes for indexed
+ * loads and stores: twice the LMUL of the 32-bit data they address */
+#if AVX2RVV_VLEN >= 512
+#define AVX512_WIDE m2
+#define AVX256_WIDE m2
+#elif AVX2RVV_VLEN >= 256
+#define AVX512_WIDE m4
+#define AVX256_WIDE m2
+#else
+#define AVX512_WIDE m8
+#define AVX256_WIDE m4
+#endif
+
 /* ===== Type mapping ===== */
 #ifdef AVX2RVV_IMPLEMENTATION
-typedef vuint8m8_t  __m512u;     /* 512-bit unsigned integer vector */
-typedef vfloat32m4_t __m512f;    /* 512-bit float vector (16 32-bit floats) */
-typedef vfloat64m2_t __m512d;    /* 512-bit double precision vector (8 64-bit floats) */
+/* Working types for 512-bit element views */
+typedef _avx512_type(int8) avx512_i8_t;
+typedef _avx512_type(int16) avx512_i16_t;
+typedef _avx512_type(int32) avx512_i32_t;
+typedef _avx512_type(int64) avx512_i64_t;
+typedef _avx512_type(uint8) avx512_u8_t;
+typedef _avx512_type(uint16) avx512_u16_t;
+typedef _avx512_type(uint32) avx512_u32_t;
+typedef _avx512_type(uint64) avx512_u64_t;
+typedef _avx512_type(float32) avx512_f32_t;
+typedef _avx512_type(float64) avx512_f64_t;
+
+typedef avx512_i64_t __m512i AVX512_FIXED;  /* 512-bit integer vector */
+typedef avx512_f32_t __m512 AVX512_FIXED;   /* 16 32-bit floats */
+typedef avx512_f64_t __m512d AVX512_FIXED;  /* 8 64-bit doubles */
+typedef avx512_u8_t __m512u AVX512_FIXED;   /* 512-bit unsigned integer vector */
+typedef avx512_u16_t __m512bh AVX512_FIXED; /* 32 bf16 values, as their bits */
+typedef __m512 __m512f;
 typedef uint8_t __mmask8;
 typedef uint16_t __mmask16;
 typedef uint32_t __mmask32;
 typedef uint64_t __mmask64;
-typedef vfloat32m2_t __m256f;    /* 256-bit float vector (8 32-bit floats) */
 typedef vfloat32m1_t __m128f;    /* 128-bit float vector (4 32-bit floats) */
-typedef union {
-    uint8_t u8[64] __attribute__((aligned(64)));
-    uint16_t u16[32];
-    uint32_t u32[16];
-    uint64_t u64[8];
-    int8_t i8[64];
-    int16_t i16[32];
-    int32_t i32[16];
-    int64_t i64[8];
-} __m512i;
-
-typedef union {
-    uint8_t u8[32] __attribute__((aligned(32)));
-    uint16_t u16[16];
-    uint32_t u32[8];
-    uint64_t u64[4];
-    int8_t  i8[32];
-    int16_t i16[16];
-    int32_t i32[8];
-    int64_t i64[4];
-} __m256i;
+typedef vfloat32m1_t __m128;     /* 128-bit float vector, as in sse2rvv.h */
+typedef vint32m1_t __m128i;      /* 128-bit integer vector, as in sse2rvv.h */
+
+/* Element views of the 512-bit types; these only retag the register group
+ * and never touch memory. */
+#define vreinterpret_m512i_i8(x) _avx512_rvv(vreinterpret_i64)(x)
+#define vreinterpret_m512i_i16(x) _avx512_rvv(vreinterpret_i64)(x)
+#define vreinterpret_m512i_i32(x) _avx512_rvv(vreinterpret_i64)(x)
+#define vreinterpret_m512i_i64(x) (x)
+#define vreinterpret_m512i_u8(x)                                               \
+  _avx512_rvv(vreinterpret_i64)(_avx512_rvv(vreinterpret_i8)(x))
+#define vreinterpret_m512i_u16(x)                                              \
+  _avx512_rvv(vreinterpret_i64)(_avx512_rvv(vreinterpret_i16)(x))
+#define vreinterpret_m512i_u32(x)                                              \
+  _avx512_rvv(vreinterpret_i64)(_avx512_rvv(vreinterpret_i32)(x))
+#define vreinterpret_m512i_u64(x) _avx512_rvv(vreinterpret_i64)(x)
+#define vreinterpret_m512i_f32(x)                                              \
+  _avx512_rvv(vreinterpret_i64)(_avx512_rvv(vreinterpret_i32)(x))
+#define vreinterpret_m512i_f64(x) _avx512_rvv(vreinterpret_i64)(x)
+
+#define vreinterpret_i8_m512i(x) _avx512_rvv(vreinterpret_i8)(x)
+#define vreinterpret_i16_m512i(x) _avx512_rvv(vreinterpret_i16)(x)
+#define vreinterpret_i32_m512i(x) _avx512_rvv(vreinterpret_i32)(x)
+#define vreinterpret_i64_m512i(x) (x)
+#define vreinterpret_u8_m512i(x)                                               \
+  _avx512_rvv(vreinterpret_u8)(_avx512_rvv(vreinterpret_i8)(x))
+#define vreinterpret_u16_m512i(x)                                              \
+  _avx512_rvv(vreinterpret_u16)(_avx512_rvv(vreinterpret_i16)(x))
+#define vreinterpret_u32_m512i(x)                                              \
+  _avx512_rvv(vreinterpret_u32)(_avx512_rvv(vreinterpret_i32)(x))
+#define vreinterpret_u64_m512i(x) _avx512_rvv(vreinterpret_u64)(x)
+#define vreinterpret_f32_m512i(x)                                              \
+  _avx512_rvv(vreinterpret_f32)(_avx512_rvv(vreinterpret_i32)(x))
+#define vreinterpret_f64_m512i(x) _avx512_rvv(vreinterpret_f64)(x)
+
+#define vreinterpret_m512_i32(x) _avx512_rvv(vreinterpret_f32)(x)
+#define vreinterpret_m512_u32(x) _avx512_rvv(vreinterpret_f32)(x)
+#define vreinterpret_m512_f32(x) (x)
+#define vreinterpret_i32_m512(x) _avx512_rvv(vreinterpret_i32)(x)
+#define vreinterpret_u32_m512(x) _avx512_rvv(vreinterpret_u32)(x)
+#define vreinterpret_f32_m512(x) (x)
+
+#define vreinterpret_m512d_i64(x) _avx512_rvv(vreinterpret_f64)(x)
+#define vreinterpret_m512d_u64(x) _avx512_rvv(vreinterpret_f64)(x)
+#define vreinterpret_m512d_f64(x) (x)
+#define vreinterpret_i64_m512d(x) _avx512_rvv(vreinterpret_i64)(x)
+#define vreinterpret_u64_m512d(x) _avx512_rvv(vreinterpret_u64)(x)
+#define vreinterpret_f64_m512d(x) (x)
+
+/* ===== Mask register layer ===== */
+/* An AVX-512 kmask has one bit per lane, which is exactly the layout of an
+ * RVV mask register: bit i of v0 governs element i. Converting between the
+ * two is therefore a single vmv.s.x / vmv.x.s through element 0 of an m1
+ * register plus a reinterpret, never a per-bit loop. All masks of a 512-bit
+ * value fit in the low 64 bits, so element 0 covers every lane. */
+#define _avx_bool(n) AVX2RVV_CAT(AVX2RVV_CAT(vbool, n), _t)
+
+#if AVX2RVV_VLEN >= 512
+#define AVX512_MASK8 8
+#define AVX512_MASK16 16
+#define AVX512_MASK32 32
+#define AVX512_MASK64 64
+#elif AVX2RVV_VLEN >= 256
+#define AVX512_MASK8 4
+#define AVX512_MASK16 8
+#define AVX512_MASK32 16
+#define AVX512_MASK64 32
+#else
+#define AVX512_MASK8 2
+#define AVX512_MASK16 4
+#define AVX512_MASK32 8
+#define AVX512_MASK64 16
+#endif
+
+#if AVX2RVV_VLEN >= 256
+#define AVX256_MASK8 8
+#define AVX256_MASK16 16
+#define AVX256_MASK32 32
+#define AVX256_MASK64 64
+#else
+#define AVX256_MASK8 4
+#define AVX256_MASK16 8
+#define AVX256_MASK32 16
+#define AVX256_MASK64 32
+#endif
+
+/* Mask types for 8/16/32/64-bit lanes of a 512-bit register group */
+typedef _avx_bool(AVX512_MASK8) avx512_b8_t;
+typedef _avx_bool(AVX512_MASK16) avx512_b16_t;
+typedef _avx_bool(AVX512_MASK32) avx512_b32_t;
+typedef _avx_bool(AVX512_MASK64) avx512_b64_t;
+
+#define _avx_k_to_bool(n, k)                                                \
+  AVX2RVV_CAT(__riscv_vreinterpret_v_u64m1_b, n)(                              \
+      __riscv_vmv_s_x_u64m1((uint64_t)(k), 1))
+#define _avx_bool_to_k(n, m)                                                \
+  __riscv_vmv_x_s_u64m1_u64(                                                   \
+      AVX2RVV_CAT(AVX2RVV_CAT(__riscv_vreinterpret_v_b, n), _u64m1)(m))
+
+/* __mmask -> vbool for the lane width of the operation */
+FORCE_INLINE avx512_b8_t _avx512_mask_to_b8(__mmask64 k) {
+    return _avx_k_to_bool(AVX512_MASK8, k);
+}
+FORCE_INLINE avx512_b16_t _avx512_mask_to_b16(__mmask32 k) {
+    return _avx_k_to_bool(AVX512_MASK16, k);
+}
+FORCE_INLINE avx512_b32_t _avx512_mask_to_b32(__mmask16 k) {
+    return _avx_k_to_bool(AVX512_MASK32, k);
+}
+FORCE_INLINE avx512_b64_t _avx512_mask_to_b64(__mmask8 k) {
+    return _avx_k_to_bool(AVX512_MASK64, k);
+}
+
+/* vbool -> __mmask; bits past the lane count are mask-tail agnostic and are
+ * dropped by the narrowing to the kmask width */
+FORCE_INLINE __mmask64 _avx512_b8_to_mask(avx512_b8_t m) {
+    return (__mmask64)_avx_bool_to_k(AVX512_MASK8, m);
+}
+FORCE_INLINE __mmask32 _avx512_b16_to_mask(avx512_b16_t m) {
+    return (__mmask32)_avx_bool_to_k(AVX512_MASK16, m);
+}
+FORCE_INLINE __mmask16 _avx512_b32_to_mask(avx512_b32_t m) {
+    return (__mmask16)_avx_bool_to_k(AVX512_MASK32, m);
+}
+FORCE_INLINE __mmask8 _avx512_b64_to_mask(avx512_b64_t m) {
+    return (__mmask8)_avx_bool_to_k(AVX512_MASK64, m);
+}
+
+/* Working types for 256-bit element views */
+typedef _avx256_type(int8) avx256_i8_t;
+typedef _avx256_type(int16) avx256_i16_t;
+typedef _avx256_type(int32) avx256_i32_t;
+typedef _avx256_type(int64) avx256_i64_t;
+typedef _avx256_type(uint8) avx256_u8_t;
+typedef _avx256_type(uint16) avx256_u16_t;
+typedef _avx256_type(uint32) avx256_u32_t;
+typedef _avx256_type(uint64) avx256_u64_t;
+typedef _avx256_type(float32) avx256_f32_t;
+typedef _avx256_type(float64) avx256_f64_t;
+
+typedef avx256_i64_t __m256i AVX256_FIXED;  /* 256-bit integer vector */
+typedef avx256_f32_t __m256 AVX256_FIXED;   /* 8 32-bit floats */
+typedef avx256_f64_t __m256d AVX256_FIXED;  /* 4 64-bit doubles */
+typedef avx256_u16_t __m256bh AVX256_FIXED; /* 16 bf16 values, as their bits */
+typedef __m256 __m256f;
+
+/* Mask types for 8/16/32/64-bit lanes of a 256-bit value */
+typedef _avx_bool(AVX256_MASK8) avx256_b8_t;
+typedef _avx_bool(AVX256_MASK16) avx256_b16_t;
+typedef _avx_bool(AVX256_MASK32) avx256_b32_t;
+typedef _avx_bool(AVX256_MASK64) avx256_b64_t;
+
+#define vreinterpret_m256i_i8(x) _avx256_rvv(vreinterpret_i64)(x)
+#define vreinterpret_m256i_i16(x) _avx256_rvv(vreinterpret_i64)(x)
+#define vreinterpret_m256i_i32(x) _avx256_rvv(vreinterpret_i64)(x)
+#define vreinterpret_m256i_i64(x) (x)
+#define vreinterpret_m256i_u8(x)                                               \
+  _avx256_rvv(vreinterpret_i64)(_avx256_rvv(vreinterpret_i8)(x))
+#define vreinterpret_m256i_u16(x)                                              \
+  _avx256_rvv(vreinterpret_i64)(_avx256_rvv(vreinterpret_i16)(x))
+#define vreinterpret_m256i_u32(x)                                              \
+  _avx256_rvv(vreinterpret_i64)(_avx256_rvv(vreinterpret_i32)(x))
+#define vreinterpret_m256i_u64(x) _avx256_rvv(vreinterpret_i64)(x)
+
+#define vreinterpret_i8_m256i(x) _avx256_rvv(vreinterpret_i8)(x)
+#define vreinterpret_i16_m256i(x) _avx256_rvv(vreinterpret_i16)(x)
+#define vreinterpret_i32_m256i(x) _avx256_rvv(vreinterpret_i32)(x)
+#define vreinterpret_i64_m256i(x) (x)
+#define vreinterpret_u8_m256i(x)                                               \
+  _avx256_rvv(vreinterpret_u8)(_avx256_rvv(vreinterpret_i8)(x))
+#define vreinterpret_u16_m256i(x)                                              \
+  _avx256_rvv(vreinterpret_u16)(_avx256_rvv(vreinterpret_i16)(x))
+#define vreinterpret_u32_m256i(x)                                              \
+  _avx256_rvv(vreinterpret_u32)(_avx256_rvv(vreinterpret_i32)(x))
+#define vreinterpret_u64_m256i(x) _avx256_rvv(vreinterpret_u64)(x)
+#define vreinterpret_f32_m256i(x)                                              \
+  _avx256_rvv(vreinterpret_f32)(_avx256_rvv(vreinterpret_i32)(x))
+#define vreinterpret_f64_m256i(x) _avx256_rvv(vreinterpret_f64)(x)
+#define vreinterpret_m256i_f32(x)                                              \
+  _avx256_rvv(vreinterpret_i64)(_avx256_rvv(vreinterpret_i32)(x))
+#define vreinterpret_m256i_f64(x) _avx256_rvv(vreinterpret_i64)(x)
+
+#define vreinterpret_m256_i32(x) _avx256_rvv(vreinterpret_f32)(x)
+#define vreinterpret_m256_u32(x) _avx256_rvv(vreinterpret_f32)(x)
+#define vreinterpret_m256_f32(x) (x)
+#define vreinterpret_i32_m256(x) _avx256_rvv(vreinterpret_i32)(x)
+#define vreinterpret_u32_m256(x) _avx256_rvv(vreinterpret_u32)(x)
+#define vreinterpret_f32_m256(x) (x)
+
+#define vreinterpret_m256d_i64(x) _avx256_rvv(vreinterpret_f64)(x)
+#define vreinterpret_m256d_u64(x) _avx256_rvv(vreinterpret_f64)(x)
+#define vreinterpret_m256d_f64(x) (x)
+#define vreinterpret_i64_m256d(x) _avx256_rvv(vreinterpret_i64)(x)
+#define vreinterpret_u64_m256d(x) _avx256_rvv(vreinterpret_u64)(x)
+#define vreinterpret_f64_m256d(x) (x)
+
+/* Byte offsets for gathers and scatters of 32-bit lanes */
+typedef AVX2RVV_CAT(AVX2RVV_CAT(vuint64, AVX512_WIDE), _t) avx512_off32_t;
+typedef AVX2RVV_CAT(AVX2RVV_CAT(vuint64, AVX256_WIDE), _t) avx256_off32_t;
+
+/* Widening products and sums, at twice the LMUL of their operands */
+#define _avx512_wide(op) AVX2RVV_CAT(__riscv_##op, AVX512_WIDE)
+#define _avx256_wide(op) AVX2RVV_CAT(__riscv_##op, AVX256_WIDE)
+typedef AVX2RVV_CAT(AVX2RVV_CAT(vint16, AVX512_WIDE), _t) avx512_i16w_t;
+typedef AVX2RVV_CAT(AVX2RVV_CAT(vint32, AVX512_WIDE), _t) avx512_i32w_t;
+typedef AVX2RVV_CAT(AVX2RVV_CAT(vint64, AVX512_WIDE), _t) avx512_i64w_t;
+typedef AVX2RVV_CAT(AVX2RVV_CAT(vint16, AVX256_WIDE), _t) avx256_i16w_t;
+typedef AVX2RVV_CAT(AVX2RVV_CAT(vint32, AVX256_WIDE), _t) avx256_i32w_t;
+typedef AVX2RVV_CAT(AVX2RVV_CAT(vint64, AVX256_WIDE), _t) avx256_i64w_t;
 #endif
 
 #define _MM_ROUND_TO_NEAREST_INT 0x00
@@ -76,13 +364,6 @@ typedef union {
 #define _MM_ROUND_NO_EXC         0x08
 #define _MM_ROUND_RAISE_EXC      0x00
 
-#ifndef __riscv_frm_rne
-#define __riscv_frm_rne 0
-#define __riscv_frm_rdn 1
-#define __riscv_frm_rup 2
-#define __riscv_frm_rtz 3
-#endif
-
 #ifndef _MM_FROUND_TO_NEAREST_INT
 #define _MM_FROUND_TO_NEAREST_INT 0x0
 #define _MM_FROUND_TO_NEG_INF     0x1
@@ -90,247 +371,2689 @@ typedef union {
 #define _MM_FROUND_TO_ZERO        0x3
 #endif
 
-// #define _MM_FROUND_CUR_DIRECTION  0x4
-// #define _MM_FROUND_NO_EXC 0x8
-/* Map to RVV rounding mode (FRM field) */
-FORCE_INLINE uint8_t aux512_round_mode_to_rvv(uint8_t aux_mode) {
-    switch(aux_mode & 0x03) {
-        case _MM_ROUND_TO_NEAREST_INT: return __riscv_frm_rne; /* Round to nearest even */
-        case _MM_ROUND_TO_NEG_INF:     return __riscv_frm_rdn; /* Round down */
-        case _MM_ROUND_TO_POS_INF:     return __riscv_frm_rup; /* Round up */
-        case _MM_ROUND_TO_ZERO:        return __riscv_frm_rtz; /* Round to zero */
-        default: return __riscv_frm_rne;
-    }
-}
+#ifndef _CMP_EQ_OQ
+#define _CMP_EQ_OQ    0x00
+#define _CMP_LT_OS    0x01
+#define _CMP_LE_OS    0x02
+#define _CMP_UNORD_Q  0x03
+#define _CMP_NEQ_UQ   0x04
+#define _CMP_NLT_US   0x05
+#define _CMP_NLE_US   0x06
+#define _CMP_ORD_Q    0x07
+#define _CMP_EQ_UQ    0x08
+#define _CMP_NGE_US   0x09
+#define _CMP_NGT_US   0x0a
+#define _CMP_FALSE_OQ 0x0b
+#define _CMP_NEQ_OQ   0x0c
+#define _CMP_GE_OS    0x0d
+#define _CMP_GT_OS    0x0e
+#define _CMP_TRUE_UQ  0x0f
+#define _CMP_EQ_OS    0x10
+#define _CMP_LT_OQ    0x11
+#define _CMP_LE_OQ    0x12
+#define _CMP_UNORD_S  0x13
+#define _CMP_NEQ_US   0x14
+#define _CMP_NLT_UQ   0x15
+#define _CMP_NLE_UQ   0x16
+#define _CMP_ORD_S    0x17
+#define _CMP_EQ_US    0x18
+#define _CMP_NGE_UQ   0x19
+#define _CMP_NGT_UQ   0x1a
+#define _CMP_FALSE_OS 0x1b
+#define _CMP_NEQ_OS   0x1c
+#define _CMP_GE_OQ    0x1d
+#define _CMP_GT_OQ    0x1e
+#define _CMP_TRUE_US  0x1f
+#endif
+
+#ifndef _MM_FROUND_CUR_DIRECTION
+#define _MM_FROUND_CUR_DIRECTION  0x4
+#define _MM_FROUND_NO_EXC         0x8
+#endif
+
+/* Body of an embedded-rounding intrinsic. The _rm RVV intrinsics need the
+ * rounding mode as a constant, so the _MM_FROUND_* immediate is mapped onto
+ * one call per mode; once inlined with a constant immediate only one of them
+ * survives. The compiler sets frm around that single instruction and fcsr is
+ * never read or written as a whole. _MM_FROUND_CUR_DIRECTION uses the
+ * dynamic rounding mode. `op` is a non-overloaded intrinsic name and the
+ * arguments are the ones before frm. */
+#define _avx512_round_call(rounding, op, vl, ...)                              \
+  do {                                                                         \
+    if ((rounding) & _MM_FROUND_CUR_DIRECTION)                                 \
+      return op(__VA_ARGS__, vl);                                              \
+    switch ((rounding) & 0x03) {                                               \
+    case _MM_FROUND_TO_NEG_INF:                                                \
+      return AVX2RVV_CAT(op, _rm)(__VA_ARGS__, __RISCV_FRM_RDN, vl);           \
+    case _MM_FROUND_TO_POS_INF:                                                \
+      return AVX2RVV_CAT(op, _rm)(__VA_ARGS__, __RISCV_FRM_RUP, vl);           \
+    case _MM_FROUND_TO_ZERO:                                                   \
+      return AVX2RVV_CAT(op, _rm)(__VA_ARGS__, __RISCV_FRM_RTZ, vl);           \
+    default:                                                                   \
+      return AVX2RVV_CAT(op, _rm)(__VA_ARGS__, __RISCV_FRM_RNE, vl);           \
+    }                                                                          \
+  } while (0)
 
 FORCE_INLINE __m512i _mm512_loadu_epi8(const void* mem_addr) {
-    __m512i result;
-    size_t vl = __riscv_vsetvl_e8m1(64);
-    
-    vint8m1_t vec = __riscv_vle8_v_i8m1((const int8_t*)mem_addr, vl);
-    
-    __riscv_vse8_v_i8m1((int8_t*)result.u8, vec, vl);
-    
-    return result;
+    return vreinterpret_m512i_i8(_avx512_rvv(vle8_v_i8)((const int8_t*)mem_addr, 64));
 }
 
 FORCE_INLINE __m512i _mm512_loadu_epi16(const void* mem_addr) {
-    size_t vl = __riscv_vsetvlmax_e16m4();
-    vint16m4_t v = __riscv_vle16_v_i16m4((const short int*)mem_addr, vl);
-    
-    int16_t buffer[32] __attribute__((aligned(64)));
-    __riscv_vse16_v_i16m4(buffer, v, vl);
-    return *(__m512i*)buffer;
+    return vreinterpret_m512i_i16(_avx512_rvv(vle16_v_i16)((const int16_t*)mem_addr, 32));
 }
 
 FORCE_INLINE void _mm512_storeu_epi8(void* mem_addr, __m512i a) {
-    for (int i = 0; i < 64; i += 8) {
-        size_t vl = __riscv_vsetvl_e8m1(8);
-        vint8m1_t vec = *(vint8m1_t*)((int8_t*)&a + i);
-        __riscv_vse8_v_i8m1((int8_t*)mem_addr + i, vec, vl);
-    }
+    _avx512_rvv(vse8_v_i8)((int8_t*)mem_addr, vreinterpret_i8_m512i(a), 64);
 }
 
 FORCE_INLINE void _mm512_storeu_epi16(void *mem_addr, __m512i a) {
-    size_t vl = __riscv_vsetvl_e16m1(8);
-    int16_t *dst = (int16_t*)mem_addr;
-
-    for (int i = 0; i < 4; i++) {
-        vint16m1_t vec = __riscv_vle16_v_i16m1((const short int*)&a.u16[i*8], vl);
-        __riscv_vse16_v_i16m1(dst + i*8, vec, vl);
-    }
+    _avx512_rvv(vse16_v_i16)((int16_t*)mem_addr, vreinterpret_i16_m512i(a), 32);
 }
 
 FORCE_INLINE __m512i _mm512_add_epi16(__m512i a, __m512i b) {
-    __m512i result;
-    size_t vl = __riscv_vsetvl_e16m4(32);
-    vint16m4_t va = __riscv_vle16_v_i16m4(a.i16, vl);
-    vint16m4_t vb = __riscv_vle16_v_i16m4(b.i16, vl);
-    vint16m4_t vr = __riscv_vadd_vv_i16m4(va, vb, vl);
-    __riscv_vse16_v_i16m4(result.i16, vr, vl);
-    return result;
+    avx512_i16_t va = vreinterpret_i16_m512i(a);
+    avx512_i16_t vb = vreinterpret_i16_m512i(b);
+    return vreinterpret_m512i_i16(__riscv_vadd(va, vb, 32));
 }
 
-static inline __m512i _mm512_sub_epi16(__m512i a, __m512i b) {
-    size_t vl = __riscv_vsetvl_e16m8(32);
+FORCE_INLINE __m512i _mm512_sub_epi16(__m512i a, __m512i b) {
+    avx512_i16_t va = vreinterpret_i16_m512i(a);
+    avx512_i16_t vb = vreinterpret_i16_m512i(b);
+    return vreinterpret_m512i_i16(__riscv_vsub(va, vb, 32));
+}
+
+FORCE_INLINE __m512i _mm512_avg_epu16(__m512i a, __m512i b) {
+    avx512_u16_t va = vreinterpret_u16_m512i(a);
+    avx512_u16_t vb = vreinterpret_u16_m512i(b);
+    /* (a + b + 1) >> 1 without overflowing the 16-bit lanes */
+    return vreinterpret_m512i_u16(__riscv_vaaddu(va, vb, __RISCV_VXRM_RNU, 32));
+}
 
-    vint16m8_t va = __riscv_vle16_v_i16m8((const int16_t*)a.u16, vl);
-    vint16m8_t vb = __riscv_vle16_v_i16m8((const int16_t*)b.u16, vl);
+FORCE_INLINE __mmask64 _mm512_cmpeq_epi8_mask(__m512i a, __m512i b) {
+    avx512_i8_t va = vreinterpret_i8_m512i(a);
+    avx512_i8_t vb = vreinterpret_i8_m512i(b);
+    return _avx512_b8_to_mask(__riscv_vmseq(va, vb, 64));
+}
 
-    vint16m8_t vsub = __riscv_vsub_vv_i16m8(va, vb, vl);
+FORCE_INLINE __mmask32 _mm512_cmpeq_epi16_mask(__m512i a, __m512i b) {
+    avx512_i16_t va = vreinterpret_i16_m512i(a);
+    avx512_i16_t vb = vreinterpret_i16_m512i(b);
+    return _avx512_b16_to_mask(__riscv_vmseq(va, vb, 32));
+}
 
-    __m512i result;
-    __riscv_vse16_v_i16m8((int16_t*)result.u16, vsub, vl);
-    return result;
+FORCE_INLINE __mmask64 _mm512_cmpgt_epi8_mask(__m512i a, __m512i b) {
+    avx512_i8_t va = vreinterpret_i8_m512i(a);
+    avx512_i8_t vb = vreinterpret_i8_m512i(b);
+    return _avx512_b8_to_mask(__riscv_vmsgt(va, vb, 64));
 }
 
-FORCE_INLINE __m512i _mm512_avg_epu16(__m512i a, __m512i b) {
-    size_t vl = __riscv_vsetvl_e16m8(32);
+FORCE_INLINE __mmask32 _mm512_cmpgt_epi16_mask(__m512i a, __m512i b) {
+    avx512_i16_t va = vreinterpret_i16_m512i(a);
+    avx512_i16_t vb = vreinterpret_i16_m512i(b);
+    return _avx512_b16_to_mask(__riscv_vmsgt(va, vb, 32));
+}
 
-    vuint16m8_t va = __riscv_vle16_v_u16m8((const uint16_t*)&a, vl);
-    vuint16m8_t vb = __riscv_vle16_v_u16m8((const uint16_t*)&b, vl);
+FORCE_INLINE __m512i _mm512_min_epi16(__m512i a, __m512i b) {
+    avx512_i16_t va = vreinterpret_i16_m512i(a);
+    avx512_i16_t vb = vreinterpret_i16_m512i(b);
+    return vreinterpret_m512i_i16(__riscv_vmin(va, vb, 32));
+}
 
-    vuint16m8_t vsum = __riscv_vadd_vv_u16m8(va, vb, vl);
-    vuint16m8_t vone = __riscv_vmv_v_x_u16m8(1, vl);
-    vsum = __riscv_vadd_vv_u16m8(vsum, vone, vl);
-    vuint16m8_t vavg = __riscv_vsrl_vx_u16m8(vsum, 1, vl);
+FORCE_INLINE __m512i _mm512_max_epi16(__m512i a, __m512i b) {
+    avx512_i16_t va = vreinterpret_i16_m512i(a);
+    avx512_i16_t vb = vreinterpret_i16_m512i(b);
+    return vreinterpret_m512i_i16(__riscv_vmax(va, vb, 32));
+}
 
-    __m512i result;
-    __riscv_vse16_v_u16m8((uint16_t*)&result, vavg, vl);
+FORCE_INLINE __m512i _mm512_mask_min_epu8(__m512i src, __mmask64 k, __m512i a, __m512i b) {
+    avx512_u8_t vsrc = vreinterpret_u8_m512i(src);
+    avx512_u8_t va = vreinterpret_u8_m512i(a);
+    avx512_u8_t vb = vreinterpret_u8_m512i(b);
+    return vreinterpret_m512i_u8(
+        __riscv_vminu_mu(_avx512_mask_to_b8(k), vsrc, va, vb, 64));
+}
 
-    return result;
+FORCE_INLINE __m512i _mm512_min_epu16(__m512i a, __m512i b) {
+    avx512_u16_t va = vreinterpret_u16_m512i(a);
+    avx512_u16_t vb = vreinterpret_u16_m512i(b);
+    return vreinterpret_m512i_u16(__riscv_vminu(va, vb, 32));
 }
 
-FORCE_INLINE __mmask32 _mm512_cmpeq_epi16_mask(__m512i a, __m512i b) {
-    size_t vl = __riscv_vsetvl_e16m4(32);
+FORCE_INLINE __m512i _mm512_mask_min_epu16(__m512i src, __mmask32 k, __m512i a, __m512i b) {
+    avx512_u16_t vsrc = vreinterpret_u16_m512i(src);
+    avx512_u16_t va = vreinterpret_u16_m512i(a);
+    avx512_u16_t vb = vreinterpret_u16_m512i(b);
+    return vreinterpret_m512i_u16(
+        __riscv_vminu_mu(_avx512_mask_to_b16(k), vsrc, va, vb, 32));
+}
 
-    vint16m4_t va = __riscv_vle16_v_i16m4((const int16_t*)&a, vl);
-    vint16m4_t vb = __riscv_vle16_v_i16m4((const int16_t*)&b, vl);
+FORCE_INLINE __m512i _mm512_max_epu16(__m512i a, __m512i b) {
+    avx512_u16_t va = vreinterpret_u16_m512i(a);
+    avx512_u16_t vb = vreinterpret_u16_m512i(b);
+    return vreinterpret_m512i_u16(__riscv_vmaxu(va, vb, 32));
+}
 
-    vbool4_t vcmp = __riscv_vmseq_vv_i16m4_b4(va, vb, vl);
+FORCE_INLINE __m512i _mm512_setzero_si512(void) {
+    return vreinterpret_m512i_i64(_avx512_rvv(vmv_v_x_i64)(0, 8));
+}
 
-    uint8_t mask_arr[4] = {0};
-    __riscv_vsm_v_b4(mask_arr, vcmp, vl);
+FORCE_INLINE __m512 _mm512_setzero_ps(void) {
+    return _avx512_rvv(vfmv_v_f_f32)(0.0f, 16);
+}
 
-    return *(uint32_t*)mask_arr;
+FORCE_INLINE __m512d _mm512_setzero_pd(void) {
+    return _avx512_rvv(vfmv_v_f_f64)(0.0, 8);
 }
 
-FORCE_INLINE __mmask32 _mm512_cmpgt_epi16_mask(__m512i a, __m512i b) {
-    size_t vl = __riscv_vsetvl_e16m4(32);
+FORCE_INLINE void _mm512_storeu_si512(void* mem_addr, __m512i a) {
+    _avx512_rvv(vse64_v_i64)((int64_t*)mem_addr, vreinterpret_i64_m512i(a), 8);
+}
 
-    vint16m4_t va = __riscv_vle16_v_i16m4((const int16_t*)&a, vl);
-    vint16m4_t vb = __riscv_vle16_v_i16m4((const int16_t*)&b, vl);
+FORCE_INLINE __m512i _mm512_loadu_si512(void const* mem_addr) {
+    return vreinterpret_m512i_i64(_avx512_rvv(vle64_v_i64)((int64_t const*)mem_addr, 8));
+}
 
-    vbool4_t vcmp = __riscv_vmslt_vv_i16m4_b4(vb, va, vl);
+FORCE_INLINE __m512i _mm512_mask_mov_epi8(__m512i src, __mmask64 k, __m512i a) {
+    avx512_i8_t vsrc = vreinterpret_i8_m512i(src);
+    avx512_i8_t va = vreinterpret_i8_m512i(a);
+    return vreinterpret_m512i_i8(__riscv_vmerge(vsrc, va, _avx512_mask_to_b8(k), 64));
+}
 
-    uint8_t mask_arr[4] = {0};
-    __riscv_vsm_v_b4(mask_arr, vcmp, vl);
+FORCE_INLINE __m512i _mm512_mask_mov_epi16(__m512i src, __mmask32 k, __m512i a) {
+    avx512_i16_t vsrc = vreinterpret_i16_m512i(src);
+    avx512_i16_t va = vreinterpret_i16_m512i(a);
+    return vreinterpret_m512i_i16(__riscv_vmerge(vsrc, va, _avx512_mask_to_b16(k), 32));
+}
 
-    return *(uint32_t*)mask_arr;
+FORCE_INLINE __m512i _mm512_maskz_mov_epi8(__mmask64 k, __m512i a) {
+    avx512_i8_t va = vreinterpret_i8_m512i(a);
+    avx512_i8_t vzero = _avx512_rvv(vmv_v_x_i8)(0, 64);
+    return vreinterpret_m512i_i8(__riscv_vmerge(vzero, va, _avx512_mask_to_b8(k), 64));
 }
 
-FORCE_INLINE __m512i _mm512_min_epi16(__m512i a, __m512i b) {
-    size_t vl = __riscv_vsetvl_e16m8(32);
+FORCE_INLINE __m512i _mm512_maskz_mov_epi16(__mmask32 k, __m512i a) {
+    avx512_i16_t va = vreinterpret_i16_m512i(a);
+    avx512_i16_t vzero = _avx512_rvv(vmv_v_x_i16)(0, 32);
+    return vreinterpret_m512i_i16(__riscv_vmerge(vzero, va, _avx512_mask_to_b16(k), 32));
+}
 
-    vint16m8_t va = __riscv_vle16_v_i16m8(a.i16, vl);
-    vint16m8_t vb = __riscv_vle16_v_i16m8(b.i16, vl);
+FORCE_INLINE __m512i _mm512_mask_blend_epi8(__mmask64 k, __m512i a, __m512i b) {
+    return _mm512_mask_mov_epi8(a, k, b);
+}
 
-    vint16m8_t vmin = __riscv_vmin_vv_i16m8(va, vb, vl);
+FORCE_INLINE __m512i _mm512_mask_blend_epi16(__mmask32 k, __m512i a, __m512i b) {
+    return _mm512_mask_mov_epi16(a, k, b);
+}
 
-    __m512i result;
-    __riscv_vse16_v_i16m8(result.i16, vmin, vl);
-    return result;
+FORCE_INLINE __m512i _mm512_mask_set1_epi8(__m512i src, __mmask64 k, char a) {
+    avx512_i8_t vsrc = vreinterpret_i8_m512i(src);
+    return vreinterpret_m512i_i8(__riscv_vmerge(vsrc, (int8_t)a, _avx512_mask_to_b8(k), 64));
 }
 
-FORCE_INLINE __m512i _mm512_max_epi16(__m512i a, __m512i b) {
-    size_t vl = __riscv_vsetvl_e16m8(32);
+FORCE_INLINE __m512i _mm512_mask_set1_epi16(__m512i src, __mmask32 k, short a) {
+    avx512_i16_t vsrc = vreinterpret_i16_m512i(src);
+    return vreinterpret_m512i_i16(__riscv_vmerge(vsrc, (int16_t)a, _avx512_mask_to_b16(k), 32));
+}
 
-    vint16m8_t va = __riscv_vle16_v_i16m8((const int16_t*)a.i16, vl);
-    vint16m8_t vb = __riscv_vle16_v_i16m8((const int16_t*)b.i16, vl);
+FORCE_INLINE __m512i _mm512_maskz_set1_epi8(__mmask64 k, char a) {
+    avx512_i8_t vzero = _avx512_rvv(vmv_v_x_i8)(0, 64);
+    return vreinterpret_m512i_i8(__riscv_vmerge(vzero, (int8_t)a, _avx512_mask_to_b8(k), 64));
+}
 
-    vint16m8_t vmax = __riscv_vmax_vv_i16m8(va, vb, vl);
+FORCE_INLINE __m512i _mm512_maskz_set1_epi16(__mmask32 k, short a) {
+    avx512_i16_t vzero = _avx512_rvv(vmv_v_x_i16)(0, 32);
+    return vreinterpret_m512i_i16(__riscv_vmerge(vzero, (int16_t)a, _avx512_mask_to_b16(k), 32));
+}
 
-    __m512i dst;
-    __riscv_vse16_v_i16m8((int16_t*)dst.i16, vmax, vl);
-    return dst;
+/* Masked loads and stores do not access inactive lanes, so like AVX-512 they
+ * never fault on bytes outside the mask */
+FORCE_INLINE __m512i _mm512_mask_loadu_epi8(__m512i src, __mmask64 k, void const* mem_addr) {
+    avx512_i8_t vsrc = vreinterpret_i8_m512i(src);
+    return vreinterpret_m512i_i8(
+        __riscv_vle8_mu(_avx512_mask_to_b8(k), vsrc, (const int8_t*)mem_addr, 64));
 }
 
-FORCE_INLINE __m512i _mm512_mask_min_epu8(__m512i src, __mmask64 k, __m512i a, __m512i b) {
-    size_t vl = __riscv_vsetvl_e8m8(64);
+FORCE_INLINE __m512i _mm512_mask_loadu_epi16(__m512i src, __mmask32 k, void const* mem_addr) {
+    avx512_i16_t vsrc = vreinterpret_i16_m512i(src);
+    return vreinterpret_m512i_i16(
+        __riscv_vle16_mu(_avx512_mask_to_b16(k), vsrc, (const int16_t*)mem_addr, 32));
+}
 
-    vuint8m8_t vsrc = __riscv_vle8_v_u8m8(src.u8, vl);
-    vuint8m8_t va = __riscv_vle8_v_u8m8(a.u8, vl);
-    vuint8m8_t vb = __riscv_vle8_v_u8m8(b.u8, vl);
+FORCE_INLINE __m512i _mm512_maskz_loadu_epi8(__mmask64 k, void const* mem_addr) {
+    return _mm512_mask_loadu_epi8(_mm512_setzero_si512(), k, mem_addr);
+}
 
-    uint8_t mask_arr[64];
-    for (int i = 0; i < 64; i++) {
-        mask_arr[i] = (k & (1ULL << i)) ? 0xFF : 0x00;
-    }
-    vbool1_t mask = __riscv_vmseq_vx_u8m8_b1(
-        __riscv_vle8_v_u8m8(mask_arr, vl), 0xFF, vl);
+FORCE_INLINE __m512i _mm512_maskz_loadu_epi16(__mmask32 k, void const* mem_addr) {
+    return _mm512_mask_loadu_epi16(_mm512_setzero_si512(), k, mem_addr);
+}
+
+FORCE_INLINE void _mm512_mask_storeu_epi8(void* mem_addr, __mmask64 k, __m512i a) {
+    __riscv_vse8(_avx512_mask_to_b8(k), (int8_t*)mem_addr, vreinterpret_i8_m512i(a), 64);
+}
 
-    vuint8m8_t vmin = __riscv_vminu_vv_u8m8(va, vb, vl);
+FORCE_INLINE void _mm512_mask_storeu_epi16(void* mem_addr, __mmask32 k, __m512i a) {
+    __riscv_vse16(_avx512_mask_to_b16(k), (int16_t*)mem_addr, vreinterpret_i16_m512i(a), 32);
+}
 
-    vuint8m8_t result = __riscv_vmerge_vvm_u8m8(vsrc, vmin, mask, vl);
+/* ===== AVX2 256-bit integer ===== */
+FORCE_INLINE __m256i _mm256_setzero_si256(void) {
+    return vreinterpret_m256i_i64(_avx256_rvv(vmv_v_x_i64)(0, 4));
+}
 
-    __m512i dst;
-    __riscv_vse8_v_u8m8(dst.u8, result, vl);
-    return dst;
+FORCE_INLINE __m256i _mm256_set1_epi8(char a) {
+    return vreinterpret_m256i_i8(_avx256_rvv(vmv_v_x_i8)(a, 32));
 }
 
+FORCE_INLINE __m256i _mm256_set1_epi16(short a) {
+    return vreinterpret_m256i_i16(_avx256_rvv(vmv_v_x_i16)(a, 16));
+}
 
-FORCE_INLINE __m512i _mm512_min_epu16(__m512i a, __m512i b) {
-    size_t vl = __riscv_vsetvl_e16m8(32);
+FORCE_INLINE __m256i _mm256_set1_epi32(int a) {
+    return vreinterpret_m256i_i32(_avx256_rvv(vmv_v_x_i32)(a, 8));
+}
 
-    vuint16m8_t va = __riscv_vle16_v_u16m8((const uint16_t*)&a, vl);
-    vuint16m8_t vb = __riscv_vle16_v_u16m8((const uint16_t*)&b, vl);
+FORCE_INLINE __m256i _mm256_set1_epi64x(long long a) {
+    return vreinterpret_m256i_i64(_avx256_rvv(vmv_v_x_i64)(a, 4));
+}
 
-    vuint16m8_t vmin = __riscv_vminu_vv_u16m8(va, vb, vl);
+FORCE_INLINE __m256i _mm256_set_epi8(char e31, char e30, char e29, char e28,
+                                     char e27, char e26, char e25, char e24,
+                                     char e23, char e22, char e21, char e20,
+                                     char e19, char e18, char e17, char e16,
+                                     char e15, char e14, char e13, char e12,
+                                     char e11, char e10, char e9, char e8,
+                                     char e7, char e6, char e5, char e4,
+                                     char e3, char e2, char e1, char e0) {
+    char arr[32] = {e0,  e1,  e2,  e3,  e4,  e5,  e6,  e7,
+                    e8,  e9,  e10, e11, e12, e13, e14, e15,
+                    e16, e17, e18, e19, e20, e21, e22, e23,
+                    e24, e25, e26, e27, e28, e29, e30, e31};
+    return vreinterpret_m256i_i8(_avx256_rvv(vle8_v_i8)((const int8_t*)arr, 32));
+}
 
-    __m512i result;
-    __riscv_vse16_v_u16m8((uint16_t*)&result, vmin, vl);
-    return result;
+FORCE_INLINE __m256i _mm256_set_epi16(short e15, short e14, short e13, short e12,
+                                      short e11, short e10, short e9, short e8,
+                                      short e7, short e6, short e5, short e4,
+                                      short e3, short e2, short e1, short e0) {
+    short arr[16] = {e0, e1, e2,  e3,  e4,  e5,  e6,  e7,
+                     e8, e9, e10, e11, e12, e13, e14, e15};
+    return vreinterpret_m256i_i16(_avx256_rvv(vle16_v_i16)((const int16_t*)arr, 16));
 }
 
-FORCE_INLINE __m512i _mm512_mask_min_epu16(__m512i src, __mmask32 k, __m512i a, __m512i b) {
-    size_t vl = __riscv_vsetvl_e16m8(32);
-    
-    vuint16m8_t vsrc = __riscv_vle16_v_u16m8((const uint16_t*)&src, vl);
-    vuint16m8_t va = __riscv_vle16_v_u16m8((const uint16_t*)&a, vl);
-    vuint16m8_t vb = __riscv_vle16_v_u16m8((const uint16_t*)&b, vl);
-    
-    uint16_t mask_arr[32];
-    for (int i = 0; i < 32; i++) {
-        mask_arr[i] = (k & (1 << i)) ? 0xFFFF : 0x0000;
+FORCE_INLINE __m256i _mm256_set_epi32(int e7, int e6, int e5, int e4,
+                                      int e3, int e2, int e1, int e0) {
+    int arr[8] = {e0, e1, e2, e3, e4, e5, e6, e7};
+    return vreinterpret_m256i_i32(_avx256_rvv(vle32_v_i32)((const int32_t*)arr, 8));
+}
+
+FORCE_INLINE __m256i _mm256_set_epi64x(long long e3, long long e2,
+                                       long long e1, long long e0) {
+    long long arr[4] = {e0, e1, e2, e3};
+    return vreinterpret_m256i_i64(_avx256_rvv(vle64_v_i64)((const int64_t*)arr, 4));
+}
+
+FORCE_INLINE __m256i _mm256_loadu_si256(__m256i const* mem_addr) {
+    return vreinterpret_m256i_i64(_avx256_rvv(vle64_v_i64)((const int64_t*)mem_addr, 4));
+}
+
+FORCE_INLINE __m256i _mm256_load_si256(__m256i const* mem_addr) {
+    return _mm256_loadu_si256(mem_addr);
+}
+
+FORCE_INLINE void _mm256_storeu_si256(__m256i* mem_addr, __m256i a) {
+    _avx256_rvv(vse64_v_i64)((int64_t*)mem_addr, vreinterpret_i64_m256i(a), 4);
+}
+
+FORCE_INLINE void _mm256_store_si256(__m256i* mem_addr, __m256i a) {
+    _mm256_storeu_si256(mem_addr, a);
+}
+
+FORCE_INLINE __m256i _mm256_add_epi8(__m256i a, __m256i b) {
+    return vreinterpret_m256i_i8(
+        __riscv_vadd(vreinterpret_i8_m256i(a), vreinterpret_i8_m256i(b), 32));
+}
+
+FORCE_INLINE __m256i _mm256_add_epi16(__m256i a, __m256i b) {
+    return vreinterpret_m256i_i16(
+        __riscv_vadd(vreinterpret_i16_m256i(a), vreinterpret_i16_m256i(b), 16));
+}
+
+FORCE_INLINE __m256i _mm256_add_epi32(__m256i a, __m256i b) {
+    return vreinterpret_m256i_i32(
+        __riscv_vadd(vreinterpret_i32_m256i(a), vreinterpret_i32_m256i(b), 8));
+}
+
+FORCE_INLINE __m256i _mm256_add_epi64(__m256i a, __m256i b) {
+    return __riscv_vadd(vreinterpret_i64_m256i(a), vreinterpret_i64_m256i(b), 4);
+}
+
+FORCE_INLINE __m256i _mm256_sub_epi8(__m256i a, __m256i b) {
+    return vreinterpret_m256i_i8(
+        __riscv_vsub(vreinterpret_i8_m256i(a), vreinterpret_i8_m256i(b), 32));
+}
+
+FORCE_INLINE __m256i _mm256_sub_epi16(__m256i a, __m256i b) {
+    return vreinterpret_m256i_i16(
+        __riscv_vsub(vreinterpret_i16_m256i(a), vreinterpret_i16_m256i(b), 16));
+}
+
+FORCE_INLINE __m256i _mm256_sub_epi32(__m256i a, __m256i b) {
+    return vreinterpret_m256i_i32(
+        __riscv_vsub(vreinterpret_i32_m256i(a), vreinterpret_i32_m256i(b), 8));
+}
+
+FORCE_INLINE __m256i _mm256_sub_epi64(__m256i a, __m256i b) {
+    return __riscv_vsub(vreinterpret_i64_m256i(a), vreinterpret_i64_m256i(b), 4);
+}
+
+FORCE_INLINE __m256i _mm256_adds_epi8(__m256i a, __m256i b) {
+    return vreinterpret_m256i_i8(
+        __riscv_vsadd(vreinterpret_i8_m256i(a), vreinterpret_i8_m256i(b), 32));
+}
+
+FORCE_INLINE __m256i _mm256_adds_epi16(__m256i a, __m256i b) {
+    return vreinterpret_m256i_i16(
+        __riscv_vsadd(vreinterpret_i16_m256i(a), vreinterpret_i16_m256i(b), 16));
+}
+
+FORCE_INLINE __m256i _mm256_adds_epu8(__m256i a, __m256i b) {
+    return vreinterpret_m256i_u8(
+        __riscv_vsaddu(vreinterpret_u8_m256i(a), vreinterpret_u8_m256i(b), 32));
+}
+
+FORCE_INLINE __m256i _mm256_adds_epu16(__m256i a, __m256i b) {
+    return vreinterpret_m256i_u16(
+        __riscv_vsaddu(vreinterpret_u16_m256i(a), vreinterpret_u16_m256i(b), 16));
+}
+
+FORCE_INLINE __m256i _mm256_subs_epi8(__m256i a, __m256i b) {
+    return vreinterpret_m256i_i8(
+        __riscv_vssub(vreinterpret_i8_m256i(a), vreinterpret_i8_m256i(b), 32));
+}
+
+FORCE_INLINE __m256i _mm256_subs_epi16(__m256i a, __m256i b) {
+    return vreinterpret_m256i_i16(
+        __riscv_vssub(vreinterpret_i16_m256i(a), vreinterpret_i16_m256i(b), 16));
+}
+
+FORCE_INLINE __m256i _mm256_subs_epu8(__m256i a, __m256i b) {
+    return vreinterpret_m256i_u8(
+        __riscv_vssubu(vreinterpret_u8_m256i(a), vreinterpret_u8_m256i(b), 32));
+}
+
+FORCE_INLINE __m256i _mm256_subs_epu16(__m256i a, __m256i b) {
+    return vreinterpret_m256i_u16(
+        __riscv_vssubu(vreinterpret_u16_m256i(a), vreinterpret_u16_m256i(b), 16));
+}
+
+FORCE_INLINE __m256i _mm256_mullo_epi16(__m256i a, __m256i b) {
+    return vreinterpret_m256i_i16(
+        __riscv_vmul(vreinterpret_i16_m256i(a), vreinterpret_i16_m256i(b), 16));
+}
+
+FORCE_INLINE __m256i _mm256_mullo_epi32(__m256i a, __m256i b) {
+    return vreinterpret_m256i_i32(
+        __riscv_vmul(vreinterpret_i32_m256i(a), vreinterpret_i32_m256i(b), 8));
+}
+
+FORCE_INLINE __m256i _mm256_mulhi_epi16(__m256i a, __m256i b) {
+    return vreinterpret_m256i_i16(
+        __riscv_vmulh(vreinterpret_i16_m256i(a), vreinterpret_i16_m256i(b), 16));
+}
+
+FORCE_INLINE __m256i _mm256_mulhi_epu16(__m256i a, __m256i b) {
+    return vreinterpret_m256i_u16(
+        __riscv_vmulhu(vreinterpret_u16_m256i(a), vreinterpret_u16_m256i(b), 16));
+}
+
+FORCE_INLINE __m256i _mm256_min_epi8(__m256i a, __m256i b) {
+    return vreinterpret_m256i_i8(
+        __riscv_vmin(vreinterpret_i8_m256i(a), vreinterpret_i8_m256i(b), 32));
+}
+
+FORCE_INLINE __m256i _mm256_min_epi16(__m256i a, __m256i b) {
+    return vreinterpret_m256i_i16(
+        __riscv_vmin(vreinterpret_i16_m256i(a), vreinterpret_i16_m256i(b), 16));
+}
+
+FORCE_INLINE __m256i _mm256_min_epi32(__m256i a, __m256i b) {
+    return vreinterpret_m256i_i32(
+        __riscv_vmin(vreinterpret_i32_m256i(a), vreinterpret_i32_m256i(b), 8));
+}
+
+FORCE_INLINE __m256i _mm256_min_epu8(__m256i a, __m256i b) {
+    return vreinterpret_m256i_u8(
+        __riscv_vminu(vreinterpret_u8_m256i(a), vreinterpret_u8_m256i(b), 32));
+}
+
+FORCE_INLINE __m256i _mm256_min_epu16(__m256i a, __m256i b) {
+    return vreinterpret_m256i_u16(
+        __riscv_vminu(vreinterpret_u16_m256i(a), vreinterpret_u16_m256i(b), 16));
+}
+
+FORCE_INLINE __m256i _mm256_min_epu32(__m256i a, __m256i b) {
+    return vreinterpret_m256i_u32(
+        __riscv_vminu(vreinterpret_u32_m256i(a), vreinterpret_u32_m256i(b), 8));
+}
+
+FORCE_INLINE __m256i _mm256_max_epi8(__m256i a, __m256i b) {
+    return vreinterpret_m256i_i8(
+        __riscv_vmax(vreinterpret_i8_m256i(a), vreinterpret_i8_m256i(b), 32));
+}
+
+FORCE_INLINE __m256i _mm256_max_epi16(__m256i a, __m256i b) {
+    return vreinterpret_m256i_i16(
+        __riscv_vmax(vreinterpret_i16_m256i(a), vreinterpret_i16_m256i(b), 16));
+}
+
+FORCE_INLINE __m256i _mm256_max_epi32(__m256i a, __m256i b) {
+    return vreinterpret_m256i_i32(
+        __riscv_vmax(vreinterpret_i32_m256i(a), vreinterpret_i32_m256i(b), 8));
+}
+
+FORCE_INLINE __m256i _mm256_max_epu8(__m256i a, __m256i b) {
+    return vreinterpret_m256i_u8(
+        __riscv_vmaxu(vreinterpret_u8_m256i(a), vreinterpret_u8_m256i(b), 32));
+}
+
+FORCE_INLINE __m256i _mm256_max_epu16(__m256i a, __m256i b) {
+    return vreinterpret_m256i_u16(
+        __riscv_vmaxu(vreinterpret_u16_m256i(a), vreinterpret_u16_m256i(b), 16));
+}
+
+FORCE_INLINE __m256i _mm256_max_epu32(__m256i a, __m256i b) {
+    return vreinterpret_m256i_u32(
+        __riscv_vmaxu(vreinterpret_u32_m256i(a), vreinterpret_u32_m256i(b), 8));
+}
+
+FORCE_INLINE __m256i _mm256_cmpeq_epi8(__m256i a, __m256i b) {
+    avx256_i8_t va = vreinterpret_i8_m256i(a);
+    avx256_i8_t vb = vreinterpret_i8_m256i(b);
+    return vreinterpret_m256i_i8(__riscv_vmerge(
+        _avx256_rvv(vmv_v_x_i8)(0, 32), -1, __riscv_vmseq(va, vb, 32), 32));
+}
+
+FORCE_INLINE __m256i _mm256_cmpeq_epi16(__m256i a, __m256i b) {
+    avx256_i16_t va = vreinterpret_i16_m256i(a);
+    avx256_i16_t vb = vreinterpret_i16_m256i(b);
+    return vreinterpret_m256i_i16(__riscv_vmerge(
+        _avx256_rvv(vmv_v_x_i16)(0, 16), -1, __riscv_vmseq(va, vb, 16), 16));
+}
+
+FORCE_INLINE __m256i _mm256_cmpeq_epi32(__m256i a, __m256i b) {
+    avx256_i32_t va = vreinterpret_i32_m256i(a);
+    avx256_i32_t vb = vreinterpret_i32_m256i(b);
+    return vreinterpret_m256i_i32(__riscv_vmerge(
+        _avx256_rvv(vmv_v_x_i32)(0, 8), -1, __riscv_vmseq(va, vb, 8), 8));
+}
+
+FORCE_INLINE __m256i _mm256_cmpeq_epi64(__m256i a, __m256i b) {
+    avx256_i64_t va = vreinterpret_i64_m256i(a);
+    avx256_i64_t vb = vreinterpret_i64_m256i(b);
+    return __riscv_vmerge(
+        _avx256_rvv(vmv_v_x_i64)(0, 4), -1, __riscv_vmseq(va, vb, 4), 4);
+}
+
+FORCE_INLINE __m256i _mm256_cmpgt_epi8(__m256i a, __m256i b) {
+    avx256_i8_t va = vreinterpret_i8_m256i(a);
+    avx256_i8_t vb = vreinterpret_i8_m256i(b);
+    return vreinterpret_m256i_i8(__riscv_vmerge(
+        _avx256_rvv(vmv_v_x_i8)(0, 32), -1, __riscv_vmsgt(va, vb, 32), 32));
+}
+
+FORCE_INLINE __m256i _mm256_cmpgt_epi16(__m256i a, __m256i b) {
+    avx256_i16_t va = vreinterpret_i16_m256i(a);
+    avx256_i16_t vb = vreinterpret_i16_m256i(b);
+    return vreinterpret_m256i_i16(__riscv_vmerge(
+        _avx256_rvv(vmv_v_x_i16)(0, 16), -1, __riscv_vmsgt(va, vb, 16), 16));
+}
+
+FORCE_INLINE __m256i _mm256_cmpgt_epi32(__m256i a, __m256i b) {
+    avx256_i32_t va = vreinterpret_i32_m256i(a);
+    avx256_i32_t vb = vreinterpret_i32_m256i(b);
+    return vreinterpret_m256i_i32(__riscv_vmerge(
+        _avx256_rvv(vmv_v_x_i32)(0, 8), -1, __riscv_vmsgt(va, vb, 8), 8));
+}
+
+FORCE_INLINE __m256i _mm256_cmpgt_epi64(__m256i a, __m256i b) {
+    avx256_i64_t va = vreinterpret_i64_m256i(a);
+    avx256_i64_t vb = vreinterpret_i64_m256i(b);
+    return __riscv_vmerge(
+        _avx256_rvv(vmv_v_x_i64)(0, 4), -1, __riscv_vmsgt(va, vb, 4), 4);
+}
+
+/* |INT_MIN| stays INT_MIN, as on x86 */
+FORCE_INLINE __m256i _mm256_abs_epi8(__m256i a) {
+    avx256_i8_t va = vreinterpret_i8_m256i(a);
+    return vreinterpret_m256i_i8(__riscv_vmax(va, __riscv_vneg(va, 32), 32));
+}
+
+FORCE_INLINE __m256i _mm256_abs_epi16(__m256i a) {
+    avx256_i16_t va = vreinterpret_i16_m256i(a);
+    return vreinterpret_m256i_i16(__riscv_vmax(va, __riscv_vneg(va, 16), 16));
+}
+
+FORCE_INLINE __m256i _mm256_abs_epi32(__m256i a) {
+    avx256_i32_t va = vreinterpret_i32_m256i(a);
+    return vreinterpret_m256i_i32(__riscv_vmax(va, __riscv_vneg(va, 8), 8));
+}
+
+FORCE_INLINE __m256i _mm256_avg_epu8(__m256i a, __m256i b) {
+    avx256_u8_t va = vreinterpret_u8_m256i(a);
+    avx256_u8_t vb = vreinterpret_u8_m256i(b);
+    return vreinterpret_m256i_u8(__riscv_vaaddu(va, vb, __RISCV_VXRM_RNU, 32));
+}
+
+FORCE_INLINE __m256i _mm256_avg_epu16(__m256i a, __m256i b) {
+    avx256_u16_t va = vreinterpret_u16_m256i(a);
+    avx256_u16_t vb = vreinterpret_u16_m256i(b);
+    return vreinterpret_m256i_u16(__riscv_vaaddu(va, vb, __RISCV_VXRM_RNU, 16));
+}
+
+FORCE_INLINE __m256i _mm256_and_si256(__m256i a, __m256i b) {
+    return __riscv_vand(vreinterpret_i64_m256i(a), vreinterpret_i64_m256i(b), 4);
+}
+
+FORCE_INLINE __m256i _mm256_andnot_si256(__m256i a, __m256i b) {
+    return __riscv_vand(__riscv_vnot(vreinterpret_i64_m256i(a), 4),
+                        vreinterpret_i64_m256i(b), 4);
+}
+
+FORCE_INLINE __m256i _mm256_or_si256(__m256i a, __m256i b) {
+    return __riscv_vor(vreinterpret_i64_m256i(a), vreinterpret_i64_m256i(b), 4);
+}
+
+FORCE_INLINE __m256i _mm256_xor_si256(__m256i a, __m256i b) {
+    return __riscv_vxor(vreinterpret_i64_m256i(a), vreinterpret_i64_m256i(b), 4);
+}
+
+FORCE_INLINE __m256i _mm256_slli_epi16(__m256i a, int imm8) {
+    const int _imm8 = imm8 & 0xff;
+    if (_imm8 > 15) {
+        return _mm256_setzero_si256();
     }
-    vbool2_t mask = __riscv_vmseq_vx_u16m8_b2(
-        __riscv_vle16_v_u16m8(mask_arr, vl), 0xFFFF, vl);
-    
-    vuint16m8_t vmin = __riscv_vminu_vv_u16m8(va, vb, vl);
-    
-    vuint16m8_t result = __riscv_vmerge_vvm_u16m8(
-        vsrc,
-        vmin,
-        mask,
-        vl
-    );
-    
-    __m512i dst;
-    __riscv_vse16_v_u16m8((uint16_t*)&dst, result, vl);
-    return dst;
+    return vreinterpret_m256i_i16(__riscv_vsll(vreinterpret_i16_m256i(a), _imm8, 16));
 }
 
-FORCE_INLINE __m512i _mm512_max_epu16(__m512i a, __m512i b) {
-    size_t vl = __riscv_vsetvl_e16m8(32);
+FORCE_INLINE __m256i _mm256_slli_epi32(__m256i a, int imm8) {
+    const int _imm8 = imm8 & 0xff;
+    if (_imm8 > 31) {
+        return _mm256_setzero_si256();
+    }
+    return vreinterpret_m256i_i32(__riscv_vsll(vreinterpret_i32_m256i(a), _imm8, 8));
+}
+
+FORCE_INLINE __m256i _mm256_slli_epi64(__m256i a, int imm8) {
+    const int _imm8 = imm8 & 0xff;
+    if (_imm8 > 63) {
+        return _mm256_setzero_si256();
+    }
+    return __riscv_vsll(vreinterpret_i64_m256i(a), _imm8, 4);
+}
 
-    vuint16m8_t va = __riscv_vle16_v_u16m8((const uint16_t*)a.u16, vl);
-    vuint16m8_t vb = __riscv_vle16_v_u16m8((const uint16_t*)b.u16, vl);
+FORCE_INLINE __m256i _mm256_srli_epi16(__m256i a, int imm8) {
+    const int _imm8 = imm8 & 0xff;
+    if (_imm8 > 15) {
+        return _mm256_setzero_si256();
+    }
+    return vreinterpret_m256i_u16(__riscv_vsrl(vreinterpret_u16_m256i(a), _imm8, 16));
+}
 
-    vuint16m8_t vmax = __riscv_vmaxu_vv_u16m8(va, vb, vl);
+FORCE_INLINE __m256i _mm256_srli_epi32(__m256i a, int imm8) {
+    const int _imm8 = imm8 & 0xff;
+    if (_imm8 > 31) {
+        return _mm256_setzero_si256();
+    }
+    return vreinterpret_m256i_u32(__riscv_vsrl(vreinterpret_u32_m256i(a), _imm8, 8));
+}
 
-    __m512i dst;
-    __riscv_vse16_v_u16m8((uint16_t*)dst.u16, vmax, vl);
-    return dst;
+FORCE_INLINE __m256i _mm256_srli_epi64(__m256i a, int imm8) {
+    const int _imm8 = imm8 & 0xff;
+    if (_imm8 > 63) {
+        return _mm256_setzero_si256();
+    }
+    return vreinterpret_m256i_u64(__riscv_vsrl(vreinterpret_u64_m256i(a), _imm8, 4));
 }
 
-FORCE_INLINE __m512i _mm512_setzero_si512(void) {
-    __m512i result;
-    size_t vl = __riscv_vsetvl_e8m8(64);
-    vint8m8_t zero_vec = __riscv_vmv_v_x_i8m8(0, vl);
-    __riscv_vse8_v_i8m8((int8_t*)&result, zero_vec, vl);
-    return result;
+/* Arithmetic shifts past the lane width fill with the sign bit */
+FORCE_INLINE __m256i _mm256_srai_epi16(__m256i a, int imm8) {
+    const int _imm8 = (imm8 & 0xff) > 15 ? 15 : (imm8 & 0xff);
+    return vreinterpret_m256i_i16(__riscv_vsra(vreinterpret_i16_m256i(a), _imm8, 16));
 }
 
-FORCE_INLINE void _mm512_storeu_si512(void* mem_addr, __m512i a) {
-    size_t vl = __riscv_vsetvl_e64m8(8);
-    __riscv_vse64_v_i64m8((int64_t*)mem_addr, __riscv_vle64_v_i64m8(a.i64, vl), vl);
+FORCE_INLINE __m256i _mm256_srai_epi32(__m256i a, int imm8) {
+    const int _imm8 = (imm8 & 0xff) > 31 ? 31 : (imm8 & 0xff);
+    return vreinterpret_m256i_i32(__riscv_vsra(vreinterpret_i32_m256i(a), _imm8, 8));
 }
 
-FORCE_INLINE __m512i _mm512_loadu_si512(void const* mem_addr) {
-    size_t vl = __riscv_vsetvl_e64m8(8);
-    vint64m8_t vec = __riscv_vle64_v_i64m8((int64_t const*)mem_addr, vl);
-    __m512i result;
-    __riscv_vse64_v_i64m8(result.i64, vec, vl);
-    return result;
+/* Per-lane shift counts; counts past the lane width give 0 (or the sign for
+ * srav), whereas RVV would only use the low log2(SEW) bits */
+FORCE_INLINE __m256i _mm256_sllv_epi32(__m256i a, __m256i count) {
+    avx256_u32_t va = vreinterpret_u32_m256i(a);
+    avx256_u32_t vc = vreinterpret_u32_m256i(count);
+    avx256_u32_t r = __riscv_vsll(va, vc, 8);
+    return vreinterpret_m256i_u32(__riscv_vmerge(r, 0, __riscv_vmsgtu(vc, 31, 8), 8));
+}
+
+FORCE_INLINE __m256i _mm256_sllv_epi64(__m256i a, __m256i count) {
+    avx256_u64_t va = vreinterpret_u64_m256i(a);
+    avx256_u64_t vc = vreinterpret_u64_m256i(count);
+    avx256_u64_t r = __riscv_vsll(va, vc, 4);
+    return vreinterpret_m256i_u64(__riscv_vmerge(r, 0, __riscv_vmsgtu(vc, 63, 4), 4));
+}
+
+FORCE_INLINE __m256i _mm256_srlv_epi32(__m256i a, __m256i count) {
+    avx256_u32_t va = vreinterpret_u32_m256i(a);
+    avx256_u32_t vc = vreinterpret_u32_m256i(count);
+    avx256_u32_t r = __riscv_vsrl(va, vc, 8);
+    return vreinterpret_m256i_u32(__riscv_vmerge(r, 0, __riscv_vmsgtu(vc, 31, 8), 8));
+}
+
+FORCE_INLINE __m256i _mm256_srlv_epi64(__m256i a, __m256i count) {
+    avx256_u64_t va = vreinterpret_u64_m256i(a);
+    avx256_u64_t vc = vreinterpret_u64_m256i(count);
+    avx256_u64_t r = __riscv_vsrl(va, vc, 4);
+    return vreinterpret_m256i_u64(__riscv_vmerge(r, 0, __riscv_vmsgtu(vc, 63, 4), 4));
+}
+
+FORCE_INLINE __m256i _mm256_srav_epi32(__m256i a, __m256i count) {
+    avx256_i32_t va = vreinterpret_i32_m256i(a);
+    avx256_u32_t vc = __riscv_vminu(vreinterpret_u32_m256i(count), 31, 8);
+    return vreinterpret_m256i_i32(__riscv_vsra(va, vc, 8));
 }
-#endif 
+
+/* AVX2 unpacks work inside each 128-bit lane. Byte p of the result comes
+ * from element slot (p & 15) >> shift of its lane: even slots from a, odd
+ * slots from b, both at source element (slot >> 1), offset by half a lane
+ * for the high variants. shift is log2 of the element size in bytes. */
+FORCE_INLINE __m256i _avx256_unpack(__m256i a, __m256i b, int shift, int hi) {
+    avx256_u8_t va = vreinterpret_u8_m256i(a);
+    avx256_u8_t vb = vreinterpret_u8_m256i(b);
+    avx256_u8_t p = _avx256_rvv(vid_v_u8)(32);
+    avx256_u8_t elem = __riscv_vsrl(__riscv_vand(p, 0x0F, 32), shift + 1, 32);
+    avx256_u8_t idx = __riscv_vsll(__riscv_vadd(elem, hi ? (8 >> shift) : 0, 32), shift, 32);
+    idx = __riscv_vor(idx, __riscv_vand(p, 0xF0 | ((1 << shift) - 1), 32), 32);
+    avx256_b8_t odd = __riscv_vmsne(__riscv_vand(p, 1 << shift, 32), 0, 32);
+    avx256_u8_t r = __riscv_vrgather(va, idx, 32);
+    return vreinterpret_m256i_u8(__riscv_vrgather_mu(odd, r, vb, idx, 32));
+}
+
+FORCE_INLINE __m256i _mm256_unpacklo_epi8(__m256i a, __m256i b) {
+    return _avx256_unpack(a, b, 0, 0);
+}
+
+FORCE_INLINE __m256i _mm256_unpacklo_epi16(__m256i a, __m256i b) {
+    return _avx256_unpack(a, b, 1, 0);
+}
+
+FORCE_INLINE __m256i _mm256_unpacklo_epi32(__m256i a, __m256i b) {
+    return _avx256_unpack(a, b, 2, 0);
+}
+
+FORCE_INLINE __m256i _mm256_unpacklo_epi64(__m256i a, __m256i b) {
+    return _avx256_unpack(a, b, 3, 0);
+}
+
+FORCE_INLINE __m256i _mm256_unpackhi_epi8(__m256i a, __m256i b) {
+    return _avx256_unpack(a, b, 0, 1);
+}
+
+FORCE_INLINE __m256i _mm256_unpackhi_epi16(__m256i a, __m256i b) {
+    return _avx256_unpack(a, b, 1, 1);
+}
+
+FORCE_INLINE __m256i _mm256_unpackhi_epi32(__m256i a, __m256i b) {
+    return _avx256_unpack(a, b, 2, 1);
+}
+
+FORCE_INLINE __m256i _mm256_unpackhi_epi64(__m256i a, __m256i b) {
+    return _avx256_unpack(a, b, 3, 1);
+}
+
+/* The AVX2 packs also stay inside 128-bit lanes: the narrowed a and b each
+ * fill one 64-bit half of every lane, i.e. the result is the 64-bit
+ * interleave {a0, b0, a1, b1} of the two narrowed halves. */
+FORCE_INLINE __m256i _avx256_pack_lanes(avx256_u64_t a, avx256_u64_t b) {
+    avx256_u64_t idx = __riscv_vsrl(_avx256_rvv(vid_v_u64)(4), 1, 4);
+    avx256_u64_t odd = __riscv_vand(_avx256_rvv(vid_v_u64)(4), 1, 4);
+    avx256_u64_t r = __riscv_vrgather(a, idx, 4);
+    return vreinterpret_m256i_u64(
+        __riscv_vrgather_mu(__riscv_vmsne(odd, 0, 4), r, b, idx, 4));
+}
+
+FORCE_INLINE __m256i _mm256_packs_epi16(__m256i a, __m256i b) {
+    avx256_i8_t a_sat = _avx256_ext(i8, __riscv_vnclip(
+        vreinterpret_i16_m256i(a), 0, __RISCV_VXRM_RDN, 16));
+    avx256_i8_t b_sat = _avx256_ext(i8, __riscv_vnclip(
+        vreinterpret_i16_m256i(b), 0, __RISCV_VXRM_RDN, 16));
+    return _avx256_pack_lanes(
+        _avx256_rvv(vreinterpret_u64)(_avx256_rvv(vreinterpret_u8)(a_sat)),
+        _avx256_rvv(vreinterpret_u64)(_avx256_rvv(vreinterpret_u8)(b_sat)));
+}
+
+FORCE_INLINE __m256i _mm256_packs_epi32(__m256i a, __m256i b) {
+    avx256_i16_t a_sat = _avx256_ext(i16, __riscv_vnclip(
+        vreinterpret_i32_m256i(a), 0, __RISCV_VXRM_RDN, 8));
+    avx256_i16_t b_sat = _avx256_ext(i16, __riscv_vnclip(
+        vreinterpret_i32_m256i(b), 0, __RISCV_VXRM_RDN, 8));
+    return _avx256_pack_lanes(
+        _avx256_rvv(vreinterpret_u64)(_avx256_rvv(vreinterpret_u16)(a_sat)),
+        _avx256_rvv(vreinterpret_u64)(_avx256_rvv(vreinterpret_u16)(b_sat)));
+}
+
+FORCE_INLINE __m256i _mm256_packus_epi16(__m256i a, __m256i b) {
+    avx256_u16_t a_pos = _avx256_rvv(vreinterpret_u16)(
+        __riscv_vmax(vreinterpret_i16_m256i(a), 0, 16));
+    avx256_u16_t b_pos = _avx256_rvv(vreinterpret_u16)(
+        __riscv_vmax(vreinterpret_i16_m256i(b), 0, 16));
+    avx256_u8_t a_sat = _avx256_ext(u8, __riscv_vnclipu(a_pos, 0, __RISCV_VXRM_RDN, 16));
+    avx256_u8_t b_sat = _avx256_ext(u8, __riscv_vnclipu(b_pos, 0, __RISCV_VXRM_RDN, 16));
+    return _avx256_pack_lanes(_avx256_rvv(vreinterpret_u64)(a_sat),
+                              _avx256_rvv(vreinterpret_u64)(b_sat));
+}
+
+FORCE_INLINE __m256i _mm256_packus_epi32(__m256i a, __m256i b) {
+    avx256_u32_t a_pos = _avx256_rvv(vreinterpret_u32)(
+        __riscv_vmax(vreinterpret_i32_m256i(a), 0, 8));
+    avx256_u32_t b_pos = _avx256_rvv(vreinterpret_u32)(
+        __riscv_vmax(vreinterpret_i32_m256i(b), 0, 8));
+    avx256_u16_t a_sat = _avx256_ext(u16, __riscv_vnclipu(a_pos, 0, __RISCV_VXRM_RDN, 8));
+    avx256_u16_t b_sat = _avx256_ext(u16, __riscv_vnclipu(b_pos, 0, __RISCV_VXRM_RDN, 8));
+    return _avx256_pack_lanes(_avx256_rvv(vreinterpret_u64)(a_sat),
+                              _avx256_rvv(vreinterpret_u64)(b_sat));
+}
+
+/* vpshufb indexes within each 128-bit lane, so the lane base of the result
+ * byte is kept in the gather index */
+FORCE_INLINE __m256i _mm256_shuffle_epi8(__m256i a, __m256i b) {
+    avx256_u8_t va = vreinterpret_u8_m256i(a);
+    avx256_i8_t vb = vreinterpret_i8_m256i(b);
+    avx256_u8_t lane = __riscv_vand(_avx256_rvv(vid_v_u8)(32), 0xF0, 32);
+    avx256_u8_t idx = __riscv_vor(
+        __riscv_vand(_avx256_rvv(vreinterpret_u8)(vb), 0x0F, 32), lane, 32);
+    avx256_u8_t r = __riscv_vrgather(va, idx, 32);
+    return vreinterpret_m256i_u8(__riscv_vmerge(r, 0, __riscv_vmslt(vb, 0, 32), 32));
+}
+
+/* vmpsadbw works inside each 128-bit lane, with imm8[2:0] for the low lane
+ * and imm8[5:3] for the high one. Result j gathers its window of a and its
+ * byte of the b quadruplet with lane-based indices; the byte differences
+ * are narrowed to the half-width type so they widen into the 16-bit sums. */
+FORCE_INLINE __m256i _mm256_mpsadbw_epu8(__m256i a, __m256i b, const int imm8) {
+    avx256_u8_t va = vreinterpret_u8_m256i(a);
+    avx256_u8_t vb = vreinterpret_u8_m256i(b);
+    avx256_u8_t i = _avx256_rvv(vid_v_u8)(16);
+    avx256_b8_t hi = __riscv_vmsgeu(i, 8, 16);
+    avx256_u8_t ia = __riscv_vadd(
+        __riscv_vand(i, 7, 16),
+        __riscv_vmerge(_avx256_rvv(vmv_v_x_u8)(((imm8 >> 2) & 1) * 4, 16),
+                       16 + ((imm8 >> 5) & 1) * 4, hi, 16), 16);
+    avx256_u8_t ib = __riscv_vmerge(_avx256_rvv(vmv_v_x_u8)((imm8 & 3) * 4, 16),
+                                    16 + ((imm8 >> 3) & 3) * 4, hi, 16);
+    avx256_u16_t sum = _avx256_rvv(vmv_v_x_u16)(0, 16);
+    for (int k = 0; k < 4; k++) {
+        avx256_u8_t x = __riscv_vrgather(va, __riscv_vadd(ia, k, 16), 16);
+        avx256_u8_t y = __riscv_vrgather(vb, __riscv_vadd(ib, k, 16), 16);
+        avx256_u8_t d = __riscv_vsub(__riscv_vmaxu(x, y, 16), __riscv_vminu(x, y, 16), 16);
+        sum = __riscv_vwaddu_wv(sum, AVX2RVV_CAT(__riscv_vlmul_trunc_u8, AVX256_HALF)(d), 16);
+    }
+    return vreinterpret_m256i_u16(sum);
+}
+
+FORCE_INLINE int _mm256_movemask_epi8(__m256i a) {
+    avx256_b8_t m = __riscv_vmslt(vreinterpret_i8_m256i(a), 0, 32);
+    return (int)(uint32_t)_avx_bool_to_k(AVX256_MASK8, m);
+}
+
+/* ===== AVX 256-bit floating point ===== */
+FORCE_INLINE __m256 _mm256_setzero_ps(void) {
+    return _avx256_rvv(vfmv_v_f_f32)(0.0f, 8);
+}
+
+FORCE_INLINE __m256d _mm256_setzero_pd(void) {
+    return _avx256_rvv(vfmv_v_f_f64)(0.0, 4);
+}
+
+FORCE_INLINE __m256 _mm256_set1_ps(float a) {
+    return _avx256_rvv(vfmv_v_f_f32)(a, 8);
+}
+
+FORCE_INLINE __m256d _mm256_set1_pd(double a) {
+    return _avx256_rvv(vfmv_v_f_f64)(a, 4);
+}
+
+FORCE_INLINE __m256 _mm256_set_ps(float e7, float e6, float e5, float e4,
+                                  float e3, float e2, float e1, float e0) {
+    float arr[8] = {e0, e1, e2, e3, e4, e5, e6, e7};
+    return _avx256_rvv(vle32_v_f32)(arr, 8);
+}
+
+FORCE_INLINE __m256d _mm256_set_pd(double e3, double e2, double e1, double e0) {
+    double arr[4] = {e0, e1, e2, e3};
+    return _avx256_rvv(vle64_v_f64)(arr, 4);
+}
+
+FORCE_INLINE __m256 _mm256_loadu_ps(float const* mem_addr) {
+    return _avx256_rvv(vle32_v_f32)(mem_addr, 8);
+}
+
+FORCE_INLINE __m256d _mm256_loadu_pd(double const* mem_addr) {
+    return _avx256_rvv(vle64_v_f64)(mem_addr, 4);
+}
+
+FORCE_INLINE __m256 _mm256_load_ps(float const* mem_addr) {
+    return _mm256_loadu_ps(mem_addr);
+}
+
+FORCE_INLINE __m256d _mm256_load_pd(double const* mem_addr) {
+    return _mm256_loadu_pd(mem_addr);
+}
+
+FORCE_INLINE void _mm256_storeu_ps(float* mem_addr, __m256 a) {
+    _avx256_rvv(vse32_v_f32)(mem_addr, a, 8);
+}
+
+FORCE_INLINE void _mm256_storeu_pd(double* mem_addr, __m256d a) {
+    _avx256_rvv(vse64_v_f64)(mem_addr, a, 4);
+}
+
+FORCE_INLINE void _mm256_store_ps(float* mem_addr, __m256 a) {
+    _mm256_storeu_ps(mem_addr, a);
+}
+
+FORCE_INLINE void _mm256_store_pd(double* mem_addr, __m256d a) {
+    _mm256_storeu_pd(mem_addr, a);
+}
+
+FORCE_INLINE __m256i _mm256_castps_si256(__m256 a) {
+    return vreinterpret_m256i_f32(a);
+}
+
+FORCE_INLINE __m256 _mm256_castsi256_ps(__m256i a) {
+    return vreinterpret_f32_m256i(a);
+}
+
+FORCE_INLINE __m256i _mm256_castpd_si256(__m256d a) {
+    return vreinterpret_m256i_f64(a);
+}
+
+FORCE_INLINE __m256d _mm256_castsi256_pd(__m256i a) {
+    return vreinterpret_f64_m256i(a);
+}
+
+FORCE_INLINE __m256d _mm256_castps_pd(__m256 a) {
+    return vreinterpret_f64_m256i(vreinterpret_m256i_f32(a));
+}
+
+FORCE_INLINE __m256 _mm256_castpd_ps(__m256d a) {
+    return vreinterpret_f32_m256i(vreinterpret_m256i_f64(a));
+}
+
+FORCE_INLINE __m256 _mm256_add_ps(__m256 a, __m256 b) {
+    return __riscv_vfadd(a, b, 8);
+}
+
+FORCE_INLINE __m256d _mm256_add_pd(__m256d a, __m256d b) {
+    return __riscv_vfadd(a, b, 4);
+}
+
+FORCE_INLINE __m256 _mm256_sub_ps(__m256 a, __m256 b) {
+    return __riscv_vfsub(a, b, 8);
+}
+
+FORCE_INLINE __m256d _mm256_sub_pd(__m256d a, __m256d b) {
+    return __riscv_vfsub(a, b, 4);
+}
+
+FORCE_INLINE __m256 _mm256_mul_ps(__m256 a, __m256 b) {
+    return __riscv_vfmul(a, b, 8);
+}
+
+FORCE_INLINE __m256d _mm256_mul_pd(__m256d a, __m256d b) {
+    return __riscv_vfmul(a, b, 4);
+}
+
+FORCE_INLINE __m256 _mm256_div_ps(__m256 a, __m256 b) {
+    return __riscv_vfdiv(a, b, 8);
+}
+
+FORCE_INLINE __m256d _mm256_div_pd(__m256d a, __m256d b) {
+    return __riscv_vfdiv(a, b, 4);
+}
+
+FORCE_INLINE __m256 _mm256_sqrt_ps(__m256 a) {
+    return __riscv_vfsqrt(a, 8);
+}
+
+FORCE_INLINE __m256d _mm256_sqrt_pd(__m256d a) {
+    return __riscv_vfsqrt(a, 4);
+}
+
+/* Subtract in even lanes, add in odd lanes */
+FORCE_INLINE __m256 _mm256_addsub_ps(__m256 a, __m256 b) {
+    avx256_u32_t odd = __riscv_vand(_avx256_rvv(vid_v_u32)(8), 1, 8);
+    return __riscv_vfsub_mu(__riscv_vmseq(odd, 0, 8), __riscv_vfadd(a, b, 8), a, b, 8);
+}
+
+FORCE_INLINE __m256d _mm256_addsub_pd(__m256d a, __m256d b) {
+    avx256_u64_t odd = __riscv_vand(_avx256_rvv(vid_v_u64)(4), 1, 4);
+    return __riscv_vfsub_mu(__riscv_vmseq(odd, 0, 4), __riscv_vfadd(a, b, 4), a, b, 4);
+}
+
+/* x86 min/max return the second operand when either input is NaN or both
+ * are zero, which vfmin/vfmax do not; a compare and merge keeps that. */
+FORCE_INLINE __m256 _mm256_min_ps(__m256 a, __m256 b) {
+    return __riscv_vmerge(b, a, __riscv_vmflt(a, b, 8), 8);
+}
+
+FORCE_INLINE __m256d _mm256_min_pd(__m256d a, __m256d b) {
+    return __riscv_vmerge(b, a, __riscv_vmflt(a, b, 4), 4);
+}
+
+FORCE_INLINE __m256 _mm256_max_ps(__m256 a, __m256 b) {
+    return __riscv_vmerge(b, a, __riscv_vmfgt(a, b, 8), 8);
+}
+
+FORCE_INLINE __m256d _mm256_max_pd(__m256d a, __m256d b) {
+    return __riscv_vmerge(b, a, __riscv_vmfgt(a, b, 4), 4);
+}
+
+FORCE_INLINE __m256 _mm256_and_ps(__m256 a, __m256 b) {
+    return vreinterpret_m256_u32(
+        __riscv_vand(vreinterpret_u32_m256(a), vreinterpret_u32_m256(b), 8));
+}
+
+FORCE_INLINE __m256d _mm256_and_pd(__m256d a, __m256d b) {
+    return vreinterpret_m256d_u64(
+        __riscv_vand(vreinterpret_u64_m256d(a), vreinterpret_u64_m256d(b), 4));
+}
+
+FORCE_INLINE __m256 _mm256_andnot_ps(__m256 a, __m256 b) {
+    return vreinterpret_m256_u32(__riscv_vand(
+        __riscv_vnot(vreinterpret_u32_m256(a), 8), vreinterpret_u32_m256(b), 8));
+}
+
+FORCE_INLINE __m256d _mm256_andnot_pd(__m256d a, __m256d b) {
+    return vreinterpret_m256d_u64(__riscv_vand(
+        __riscv_vnot(vreinterpret_u64_m256d(a), 4), vreinterpret_u64_m256d(b), 4));
+}
+
+FORCE_INLINE __m256 _mm256_or_ps(__m256 a, __m256 b) {
+    return vreinterpret_m256_u32(
+        __riscv_vor(vreinterpret_u32_m256(a), vreinterpret_u32_m256(b), 8));
+}
+
+FORCE_INLINE __m256d _mm256_or_pd(__m256d a, __m256d b) {
+    return vreinterpret_m256d_u64(
+        __riscv_vor(vreinterpret_u64_m256d(a), vreinterpret_u64_m256d(b), 4));
+}
+
+FORCE_INLINE __m256 _mm256_xor_ps(__m256 a, __m256 b) {
+    return vreinterpret_m256_u32(
+        __riscv_vxor(vreinterpret_u32_m256(a), vreinterpret_u32_m256(b), 8));
+}
+
+FORCE_INLINE __m256d _mm256_xor_pd(__m256d a, __m256d b) {
+    return vreinterpret_m256d_u64(
+        __riscv_vxor(vreinterpret_u64_m256d(a), vreinterpret_u64_m256d(b), 4));
+}
+
+/* Evaluate a _CMP_* predicate. Bit 4 of the predicate only selects the
+ * signalling behaviour, which does not change the result. */
+FORCE_INLINE avx256_b32_t _avx256_cmp_f32(__m256 a, __m256 b, int imm8) {
+    avx256_b32_t ord = __riscv_vmand(__riscv_vmfeq(a, a, 8), __riscv_vmfeq(b, b, 8), 8);
+    switch (imm8 & 0x0F) {
+    case _CMP_EQ_OQ:    return __riscv_vmfeq(a, b, 8);
+    case _CMP_LT_OS:    return __riscv_vmflt(a, b, 8);
+    case _CMP_LE_OS:    return __riscv_vmfle(a, b, 8);
+    case _CMP_UNORD_Q:  return __riscv_vmnot(ord, 8);
+    case _CMP_NEQ_UQ:   return __riscv_vmfne(a, b, 8);
+    case _CMP_NLT_US:   return __riscv_vmnot(__riscv_vmflt(a, b, 8), 8);
+    case _CMP_NLE_US:   return __riscv_vmnot(__riscv_vmfle(a, b, 8), 8);
+    case _CMP_ORD_Q:    return ord;
+    case _CMP_EQ_UQ:    return __riscv_vmorn(__riscv_vmfeq(a, b, 8), ord, 8);
+    case _CMP_NGE_US:   return __riscv_vmnot(__riscv_vmfge(a, b, 8), 8);
+    case _CMP_NGT_US:   return __riscv_vmnot(__riscv_vmfgt(a, b, 8), 8);
+    case _CMP_FALSE_OQ: return AVX2RVV_CAT(__riscv_vmclr_m_b, AVX256_MASK32)(8);
+    case _CMP_NEQ_OQ:   return __riscv_vmand(__riscv_vmfne(a, b, 8), ord, 8);
+    case _CMP_GE_OS:    return __riscv_vmfge(a, b, 8);
+    case _CMP_GT_OS:    return __riscv_vmfgt(a, b, 8);
+    default:            return AVX2RVV_CAT(__riscv_vmset_m_b, AVX256_MASK32)(8);
+    }
+}
+
+FORCE_INLINE avx256_b64_t _avx256_cmp_f64(__m256d a, __m256d b, int imm8) {
+    avx256_b64_t ord = __riscv_vmand(__riscv_vmfeq(a, a, 4), __riscv_vmfeq(b, b, 4), 4);
+    switch (imm8 & 0x0F) {
+    case _CMP_EQ_OQ:    return __riscv_vmfeq(a, b, 4);
+    case _CMP_LT_OS:    return __riscv_vmflt(a, b, 4);
+    case _CMP_LE_OS:    return __riscv_vmfle(a, b, 4);
+    case _CMP_UNORD_Q:  return __riscv_vmnot(ord, 4);
+    case _CMP_NEQ_UQ:   return __riscv_vmfne(a, b, 4);
+    case _CMP_NLT_US:   return __riscv_vmnot(__riscv_vmflt(a, b, 4), 4);
+    case _CMP_NLE_US:   return __riscv_vmnot(__riscv_vmfle(a, b, 4), 4);
+    case _CMP_ORD_Q:    return ord;
+    case _CMP_EQ_UQ:    return __riscv_vmorn(__riscv_vmfeq(a, b, 4), ord, 4);
+    case _CMP_NGE_US:   return __riscv_vmnot(__riscv_vmfge(a, b, 4), 4);
+    case _CMP_NGT_US:   return __riscv_vmnot(__riscv_vmfgt(a, b, 4), 4);
+    case _CMP_FALSE_OQ: return AVX2RVV_CAT(__riscv_vmclr_m_b, AVX256_MASK64)(4);
+    case _CMP_NEQ_OQ:   return __riscv_vmand(__riscv_vmfne(a, b, 4), ord, 4);
+    case _CMP_GE_OS:    return __riscv_vmfge(a, b, 4);
+    case _CMP_GT_OS:    return __riscv_vmfgt(a, b, 4);
+    default:            return AVX2RVV_CAT(__riscv_vmset_m_b, AVX256_MASK64)(4);
+    }
+}
+
+FORCE_INLINE __m256 _mm256_cmp_ps(__m256 a, __m256 b, const int imm8) {
+    return vreinterpret_m256_i32(__riscv_vmerge(
+        _avx256_rvv(vmv_v_x_i32)(0, 8), -1, _avx256_cmp_f32(a, b, imm8), 8));
+}
+
+FORCE_INLINE __m256d _mm256_cmp_pd(__m256d a, __m256d b, const int imm8) {
+    return vreinterpret_m256d_i64(__riscv_vmerge(
+        _avx256_rvv(vmv_v_x_i64)(0, 4), -1, _avx256_cmp_f64(a, b, imm8), 4));
+}
+
+FORCE_INLINE __m256 _mm256_blendv_ps(__m256 a, __m256 b, __m256 mask) {
+    return __riscv_vmerge(a, b, __riscv_vmslt(vreinterpret_i32_m256(mask), 0, 8), 8);
+}
+
+FORCE_INLINE __m256d _mm256_blendv_pd(__m256d a, __m256d b, __m256d mask) {
+    return __riscv_vmerge(a, b, __riscv_vmslt(vreinterpret_i64_m256d(mask), 0, 4), 4);
+}
+
+FORCE_INLINE __m256 _mm256_blend_ps(__m256 a, __m256 b, const int imm8) {
+    avx256_b32_t m = _avx_k_to_bool(AVX256_MASK32, imm8 & 0xff);
+    return __riscv_vmerge(a, b, m, 8);
+}
+
+FORCE_INLINE __m256d _mm256_blend_pd(__m256d a, __m256d b, const int imm8) {
+    avx256_b64_t m = _avx_k_to_bool(AVX256_MASK64, imm8 & 0xf);
+    return __riscv_vmerge(a, b, m, 4);
+}
+
+FORCE_INLINE int _mm256_movemask_ps(__m256 a) {
+    avx256_b32_t m = __riscv_vmslt(vreinterpret_i32_m256(a), 0, 8);
+    return (int)(_avx_bool_to_k(AVX256_MASK32, m) & 0xff);
+}
+
+FORCE_INLINE int _mm256_movemask_pd(__m256d a) {
+    avx256_b64_t m = __riscv_vmslt(vreinterpret_i64_m256d(a), 0, 4);
+    return (int)(_avx_bool_to_k(AVX256_MASK64, m) & 0xf);
+}
+
+/* Horizontal adds pair neighbours inside each 128-bit lane: for ps a lane
+ * of the result is {a0+a1, a2+a3, b0+b1, b2+b3} of the same lane. */
+FORCE_INLINE __m256 _mm256_hadd_ps(__m256 a, __m256 b) {
+    __m256 sa = __riscv_vfadd(a, __riscv_vslidedown(a, 1, 8), 8);
+    __m256 sb = __riscv_vfadd(b, __riscv_vslidedown(b, 1, 8), 8);
+    avx256_u32_t i = _avx256_rvv(vid_v_u32)(8);
+    avx256_u32_t idx = __riscv_vor(__riscv_vand(i, ~3u, 8),
+                                   __riscv_vsll(__riscv_vand(i, 1, 8), 1, 8), 8);
+    avx256_b32_t from_b = __riscv_vmsne(__riscv_vand(i, 2, 8), 0, 8);
+    return __riscv_vrgather_mu(from_b, __riscv_vrgather(sa, idx, 8), sb, idx, 8);
+}
+
+FORCE_INLINE __m256d _mm256_hadd_pd(__m256d a, __m256d b) {
+    __m256d sa = __riscv_vfadd(a, __riscv_vslidedown(a, 1, 4), 4);
+    __m256d sb = __riscv_vfadd(b, __riscv_vslidedown(b, 1, 4), 4);
+    avx256_u64_t i = _avx256_rvv(vid_v_u64)(4);
+    avx256_u64_t idx = __riscv_vand(i, ~1ull, 4);
+    avx256_b64_t from_b = __riscv_vmsne(__riscv_vand(i, 1, 4), 0, 4);
+    return __riscv_vrgather_mu(from_b, __riscv_vrgather(sa, idx, 4), sb, idx, 4);
+}
+
+FORCE_INLINE __m256 _mm256_hsub_ps(__m256 a, __m256 b) {
+    __m256 sa = __riscv_vfsub(a, __riscv_vslidedown(a, 1, 8), 8);
+    __m256 sb = __riscv_vfsub(b, __riscv_vslidedown(b, 1, 8), 8);
+    avx256_u32_t i = _avx256_rvv(vid_v_u32)(8);
+    avx256_u32_t idx = __riscv_vor(__riscv_vand(i, ~3u, 8),
+                                   __riscv_vsll(__riscv_vand(i, 1, 8), 1, 8), 8);
+    avx256_b32_t from_b = __riscv_vmsne(__riscv_vand(i, 2, 8), 0, 8);
+    return __riscv_vrgather_mu(from_b, __riscv_vrgather(sa, idx, 8), sb, idx, 8);
+}
+
+FORCE_INLINE __m256d _mm256_hsub_pd(__m256d a, __m256d b) {
+    __m256d sa = __riscv_vfsub(a, __riscv_vslidedown(a, 1, 4), 4);
+    __m256d sb = __riscv_vfsub(b, __riscv_vslidedown(b, 1, 4), 4);
+    avx256_u64_t i = _avx256_rvv(vid_v_u64)(4);
+    avx256_u64_t idx = __riscv_vand(i, ~1ull, 4);
+    avx256_b64_t from_b = __riscv_vmsne(__riscv_vand(i, 1, 4), 0, 4);
+    return __riscv_vrgather_mu(from_b, __riscv_vrgather(sa, idx, 4), sb, idx, 4);
+}
+
+/* Dot product inside each 128-bit lane, summed in the x86 order
+ * (p0 + p1) + (p2 + p3) by two slide-adds rather than an RVV reduction,
+ * whose order would not match. Lane 4k of the second sum holds lane k's
+ * total, which is broadcast to the lanes selected by imm8[3:0]. */
+FORCE_INLINE __m256 _mm256_dp_ps(__m256 a, __m256 b, const int imm8) {
+    avx256_b32_t in_mask = _avx_k_to_bool(AVX256_MASK32, ((imm8 >> 4) & 15) * 0x11);
+    avx256_b32_t out_mask = _avx_k_to_bool(AVX256_MASK32, (imm8 & 15) * 0x11);
+    __m256 zero = _avx256_rvv(vfmv_v_f_f32)(0.0f, 8);
+    __m256 prod = __riscv_vfmul_mu(in_mask, zero, a, b, 8);
+    __m256 pair = __riscv_vfadd(prod, __riscv_vslidedown(prod, 1, 8), 8);
+    __m256 sum = __riscv_vfadd(pair, __riscv_vslidedown(pair, 2, 8), 8);
+    avx256_u32_t idx = __riscv_vand(_avx256_rvv(vid_v_u32)(8), ~3u, 8);
+    return __riscv_vrgather_mu(out_mask, zero, sum, idx, 8);
+}
+
+FORCE_INLINE __m256 _mm256_cvtepi32_ps(__m256i a) {
+    return __riscv_vfcvt_f(vreinterpret_i32_m256i(a), 8);
+}
+
+/* Out-of-range and NaN inputs give the x86 "integer indefinite" INT32_MIN;
+ * vfcvt would saturate positive overflow and NaN to INT32_MAX instead. */
+FORCE_INLINE __m256i _mm256_cvtps_epi32(__m256 a) {
+    avx256_i32_t r = __riscv_vfcvt_x(a, 8);
+    avx256_b32_t bad = __riscv_vmnot(__riscv_vmflt(a, 2147483648.0f, 8), 8);
+    return vreinterpret_m256i_i32(__riscv_vmerge(r, INT32_MIN, bad, 8));
+}
+
+FORCE_INLINE __m256i _mm256_cvttps_epi32(__m256 a) {
+    avx256_i32_t r = __riscv_vfcvt_rtz_x(a, 8);
+    avx256_b32_t bad = __riscv_vmnot(__riscv_vmflt(a, 2147483648.0f, 8), 8);
+    return vreinterpret_m256i_i32(__riscv_vmerge(r, INT32_MIN, bad, 8));
+}
+
+/* ===== AVX-512 float with embedded rounding ===== */
+FORCE_INLINE __m512 _mm512_loadu_ps(void const* mem_addr) {
+    return _avx512_rvv(vle32_v_f32)((const float*)mem_addr, 16);
+}
+
+FORCE_INLINE __m512d _mm512_loadu_pd(void const* mem_addr) {
+    return _avx512_rvv(vle64_v_f64)((const double*)mem_addr, 8);
+}
+
+FORCE_INLINE void _mm512_storeu_ps(void* mem_addr, __m512 a) {
+    _avx512_rvv(vse32_v_f32)((float*)mem_addr, a, 16);
+}
+
+FORCE_INLINE void _mm512_storeu_pd(void* mem_addr, __m512d a) {
+    _avx512_rvv(vse64_v_f64)((double*)mem_addr, a, 8);
+}
+
+FORCE_INLINE __m512 _mm512_add_round_ps(__m512 a, __m512 b, const int rounding) {
+    _avx512_round_call(rounding, _avx512_rvv(vfadd_vv_f32), 16, a, b);
+}
+
+FORCE_INLINE __m512d _mm512_add_round_pd(__m512d a, __m512d b, const int rounding) {
+    _avx512_round_call(rounding, _avx512_rvv(vfadd_vv_f64), 8, a, b);
+}
+
+FORCE_INLINE __m512 _mm512_sub_round_ps(__m512 a, __m512 b, const int rounding) {
+    _avx512_round_call(rounding, _avx512_rvv(vfsub_vv_f32), 16, a, b);
+}
+
+FORCE_INLINE __m512d _mm512_sub_round_pd(__m512d a, __m512d b, const int rounding) {
+    _avx512_round_call(rounding, _avx512_rvv(vfsub_vv_f64), 8, a, b);
+}
+
+FORCE_INLINE __m512 _mm512_mul_round_ps(__m512 a, __m512 b, const int rounding) {
+    _avx512_round_call(rounding, _avx512_rvv(vfmul_vv_f32), 16, a, b);
+}
+
+FORCE_INLINE __m512d _mm512_mul_round_pd(__m512d a, __m512d b, const int rounding) {
+    _avx512_round_call(rounding, _avx512_rvv(vfmul_vv_f64), 8, a, b);
+}
+
+FORCE_INLINE __m512 _mm512_div_round_ps(__m512 a, __m512 b, const int rounding) {
+    _avx512_round_call(rounding, _avx512_rvv(vfdiv_vv_f32), 16, a, b);
+}
+
+FORCE_INLINE __m512d _mm512_div_round_pd(__m512d a, __m512d b, const int rounding) {
+    _avx512_round_call(rounding, _avx512_rvv(vfdiv_vv_f64), 8, a, b);
+}
+
+FORCE_INLINE __m512 _mm512_sqrt_round_ps(__m512 a, const int rounding) {
+    _avx512_round_call(rounding, _avx512_rvv(vfsqrt_v_f32), 16, a);
+}
+
+FORCE_INLINE __m512d _mm512_sqrt_round_pd(__m512d a, const int rounding) {
+    _avx512_round_call(rounding, _avx512_rvv(vfsqrt_v_f64), 8, a);
+}
+
+FORCE_INLINE __m512 _mm512_cvt_roundepi32_ps(__m512i a, const int rounding) {
+    avx512_i32_t va = vreinterpret_i32_m512i(a);
+    _avx512_round_call(rounding, _avx512_rvv(vfcvt_f_x_v_f32), 16, va);
+}
+
+FORCE_INLINE __m512 _mm512_cvt_roundepu32_ps(__m512i a, const int rounding) {
+    avx512_u32_t va = vreinterpret_u32_m512i(a);
+    _avx512_round_call(rounding, _avx512_rvv(vfcvt_f_xu_v_f32), 16, va);
+}
+
+FORCE_INLINE avx512_i32_t _avx512_cvt_round_f32_i32(__m512 a, const int rounding) {
+    _avx512_round_call(rounding, _avx512_rvv(vfcvt_x_f_v_i32), 16, a);
+}
+
+/* Out-of-range and NaN inputs give the x86 "integer indefinite" INT32_MIN */
+FORCE_INLINE __m512i _mm512_cvt_roundps_epi32(__m512 a, const int rounding) {
+    avx512_i32_t r = _avx512_cvt_round_f32_i32(a, rounding);
+    avx512_b32_t bad = __riscv_vmnot(__riscv_vmflt(a, 2147483648.0f, 16), 16);
+    return vreinterpret_m512i_i32(__riscv_vmerge(r, INT32_MIN, bad, 16));
+}
+
+/* ===== FMA3 ===== */
+/* RVV vfmadd overwrites the multiplicand, which is exactly the x86 a*b+c
+ * form; fnmadd/fnmsub swap names because RVV's "n" negates the whole
+ * result while x86 only negates the product. fmaddsub/fmsubadd negate c
+ * in the lanes that subtract, so every lane is still one fused op. */
+FORCE_INLINE __m256 _mm256_fmadd_ps(__m256 a, __m256 b, __m256 c) {
+    return __riscv_vfmadd(a, b, c, 8);
+}
+
+FORCE_INLINE __m256 _mm256_fmsub_ps(__m256 a, __m256 b, __m256 c) {
+    return __riscv_vfmsub(a, b, c, 8);
+}
+
+FORCE_INLINE __m256 _mm256_fnmadd_ps(__m256 a, __m256 b, __m256 c) {
+    return __riscv_vfnmsub(a, b, c, 8);
+}
+
+FORCE_INLINE __m256 _mm256_fnmsub_ps(__m256 a, __m256 b, __m256 c) {
+    return __riscv_vfnmadd(a, b, c, 8);
+}
+
+FORCE_INLINE __m256 _mm256_fmaddsub_ps(__m256 a, __m256 b, __m256 c) {
+    avx256_u32_t i = __riscv_vand(_avx256_rvv(vid_v_u32)(8), 1, 8);
+    avx256_b32_t even = __riscv_vmseq(i, 0, 8);
+    return __riscv_vfmadd(a, b, __riscv_vfneg_mu(even, c, c, 8), 8);
+}
+
+FORCE_INLINE __m256 _mm256_fmsubadd_ps(__m256 a, __m256 b, __m256 c) {
+    avx256_u32_t i = __riscv_vand(_avx256_rvv(vid_v_u32)(8), 1, 8);
+    avx256_b32_t odd = __riscv_vmsne(i, 0, 8);
+    return __riscv_vfmadd(a, b, __riscv_vfneg_mu(odd, c, c, 8), 8);
+}
+
+FORCE_INLINE __m256d _mm256_fmadd_pd(__m256d a, __m256d b, __m256d c) {
+    return __riscv_vfmadd(a, b, c, 4);
+}
+
+FORCE_INLINE __m256d _mm256_fmsub_pd(__m256d a, __m256d b, __m256d c) {
+    return __riscv_vfmsub(a, b, c, 4);
+}
+
+FORCE_INLINE __m256d _mm256_fnmadd_pd(__m256d a, __m256d b, __m256d c) {
+    return __riscv_vfnmsub(a, b, c, 4);
+}
+
+FORCE_INLINE __m256d _mm256_fnmsub_pd(__m256d a, __m256d b, __m256d c) {
+    return __riscv_vfnmadd(a, b, c, 4);
+}
+
+FORCE_INLINE __m256d _mm256_fmaddsub_pd(__m256d a, __m256d b, __m256d c) {
+    avx256_u64_t i = __riscv_vand(_avx256_rvv(vid_v_u64)(4), 1, 4);
+    avx256_b64_t even = __riscv_vmseq(i, 0, 4);
+    return __riscv_vfmadd(a, b, __riscv_vfneg_mu(even, c, c, 4), 4);
+}
+
+FORCE_INLINE __m256d _mm256_fmsubadd_pd(__m256d a, __m256d b, __m256d c) {
+    avx256_u64_t i = __riscv_vand(_avx256_rvv(vid_v_u64)(4), 1, 4);
+    avx256_b64_t odd = __riscv_vmsne(i, 0, 4);
+    return __riscv_vfmadd(a, b, __riscv_vfneg_mu(odd, c, c, 4), 4);
+}
+
+FORCE_INLINE __m512 _mm512_fmadd_ps(__m512 a, __m512 b, __m512 c) {
+    return __riscv_vfmadd(a, b, c, 16);
+}
+
+FORCE_INLINE __m512 _mm512_fmsub_ps(__m512 a, __m512 b, __m512 c) {
+    return __riscv_vfmsub(a, b, c, 16);
+}
+
+FORCE_INLINE __m512 _mm512_fnmadd_ps(__m512 a, __m512 b, __m512 c) {
+    return __riscv_vfnmsub(a, b, c, 16);
+}
+
+FORCE_INLINE __m512 _mm512_fnmsub_ps(__m512 a, __m512 b, __m512 c) {
+    return __riscv_vfnmadd(a, b, c, 16);
+}
+
+FORCE_INLINE __m512 _mm512_fmaddsub_ps(__m512 a, __m512 b, __m512 c) {
+    avx512_u32_t i = __riscv_vand(_avx512_rvv(vid_v_u32)(16), 1, 16);
+    avx512_b32_t even = __riscv_vmseq(i, 0, 16);
+    return __riscv_vfmadd(a, b, __riscv_vfneg_mu(even, c, c, 16), 16);
+}
+
+FORCE_INLINE __m512 _mm512_fmsubadd_ps(__m512 a, __m512 b, __m512 c) {
+    avx512_u32_t i = __riscv_vand(_avx512_rvv(vid_v_u32)(16), 1, 16);
+    avx512_b32_t odd = __riscv_vmsne(i, 0, 16);
+    return __riscv_vfmadd(a, b, __riscv_vfneg_mu(odd, c, c, 16), 16);
+}
+
+FORCE_INLINE __m512d _mm512_fmadd_pd(__m512d a, __m512d b, __m512d c) {
+    return __riscv_vfmadd(a, b, c, 8);
+}
+
+FORCE_INLINE __m512d _mm512_fmsub_pd(__m512d a, __m512d b, __m512d c) {
+    return __riscv_vfmsub(a, b, c, 8);
+}
+
+FORCE_INLINE __m512d _mm512_fnmadd_pd(__m512d a, __m512d b, __m512d c) {
+    return __riscv_vfnmsub(a, b, c, 8);
+}
+
+FORCE_INLINE __m512d _mm512_fnmsub_pd(__m512d a, __m512d b, __m512d c) {
+    return __riscv_vfnmadd(a, b, c, 8);
+}
+
+FORCE_INLINE __m512d _mm512_fmaddsub_pd(__m512d a, __m512d b, __m512d c) {
+    avx512_u64_t i = __riscv_vand(_avx512_rvv(vid_v_u64)(8), 1, 8);
+    avx512_b64_t even = __riscv_vmseq(i, 0, 8);
+    return __riscv_vfmadd(a, b, __riscv_vfneg_mu(even, c, c, 8), 8);
+}
+
+FORCE_INLINE __m512d _mm512_fmsubadd_pd(__m512d a, __m512d b, __m512d c) {
+    avx512_u64_t i = __riscv_vand(_avx512_rvv(vid_v_u64)(8), 1, 8);
+    avx512_b64_t odd = __riscv_vmsne(i, 0, 8);
+    return __riscv_vfmadd(a, b, __riscv_vfneg_mu(odd, c, c, 8), 8);
+}
+
+/* ===== F16C ===== */
+/* Eight halves fill a 128-bit __m128i and widen to a 256-bit __m256, so
+ * they live at AVX256_HALF: the whole register at VLEN=128, the low half of
+ * it from VLEN=256. */
+#if AVX2RVV_VLEN >= 256
+#define _avx256_u16_m128i(x)                                                   \
+  __riscv_vlmul_trunc_u16mf2(                                                  \
+      __riscv_vreinterpret_u16m1(__riscv_vreinterpret_u32m1(x)))
+#define _avx256_m128i_u16(x)                                                   \
+  __riscv_vreinterpret_i32m1(                                                  \
+      __riscv_vreinterpret_u32m1(__riscv_vlmul_ext_u16m1(x)))
+#else
+#define _avx256_u16_m128i(x)                                                   \
+  __riscv_vreinterpret_u16m1(__riscv_vreinterpret_u32m1(x))
+#define _avx256_m128i_u16(x)                                                   \
+  __riscv_vreinterpret_i32m1(__riscv_vreinterpret_u32m1(x))
+#endif
+
+/* With Zvfhmin both directions are a single vfwcvt/vfncvt, which return the
+ * canonical NaN where x86 keeps the sign and payload of a quieted NaN.
+ * Without it the conversions are integer code on 32-bit lanes. */
+#if !defined(__riscv_zvfhmin) && !defined(__riscv_zvfh)
+/* Place exponent and mantissa and multiply by 2^112, which rebiases normal
+ * and denormal halves exactly; infinities and NaNs are rebiased directly,
+ * NaNs quieted as on x86. */
+FORCE_INLINE __m256 _avx256_cvtph_ps(avx256_u32_t h) {
+    avx256_u32_t o = __riscv_vsll(__riscv_vand(h, 0x7fff, 8), 13, 8);
+    __m256 scale = vreinterpret_m256_u32(_avx256_rvv(vmv_v_x_u32)(0x77800000, 8));
+    avx256_u32_t r = vreinterpret_u32_m256(__riscv_vfmul(vreinterpret_m256_u32(o), scale, 8));
+    avx256_u32_t special = __riscv_vadd(o, 0x70000000, 8);
+    special = __riscv_vor_mu(__riscv_vmsgtu(o, 0x0f800000, 8), special, special, 0x00400000, 8);
+    r = __riscv_vmerge(r, special, __riscv_vmsgeu(o, 0x0f800000, 8), 8);
+    avx256_u32_t sign = __riscv_vsll(__riscv_vand(h, 0x8000, 8), 16, 8);
+    return vreinterpret_m256_u32(__riscv_vor(r, sign, 8));
+}
+
+/* Normal results rebias the exponent and drop 13 mantissa bits, denormal
+ * results shift the mantissa and its implicit bit right by up to 31; both
+ * round on the bits shifted out, and a carry bumps the exponent. Beyond the
+ * largest half the result is infinity when rounding away from zero and
+ * 0x7bff otherwise. frm is an RVV rounding mode. */
+FORCE_INLINE avx256_u32_t _avx256_cvtps_ph(avx256_u32_t f, int frm) {
+    avx256_u32_t mag = __riscv_vand(f, 0x7fffffff, 8);
+    avx256_b32_t neg = __riscv_vmsgtu(f, 0x7fffffff, 8);
+    avx256_u32_t e = __riscv_vsrl(mag, 23, 8);
+    avx256_b32_t denorm = __riscv_vmsltu(mag, 113u << 23, 8);
+    avx256_u32_t m = __riscv_vand(mag, 0x7fffff, 8);
+    m = __riscv_vor_mu(__riscv_vmsne(e, 0, 8), m, m, 0x800000, 8);
+    avx256_u32_t src = __riscv_vmerge(__riscv_vsub(mag, 112u << 23, 8), m, denorm, 8);
+    avx256_u32_t sh = __riscv_vminu(__riscv_vrsub(e, 126, 8), 31, 8);
+    sh = __riscv_vmerge(_avx256_rvv(vmv_v_x_u32)(13, 8), sh, denorm, 8);
+    avx256_u32_t o = __riscv_vsrl(src, sh, 8);
+    avx256_u32_t unit = __riscv_vsll(_avx256_rvv(vmv_v_x_u32)(1, 8), sh, 8);
+    avx256_u32_t rem = __riscv_vand(src, __riscv_vsub(unit, 1, 8), 8);
+    avx256_b32_t inexact = __riscv_vmsne(rem, 0, 8);
+    avx256_u32_t big = _avx256_rvv(vmv_v_x_u32)(0x7bff, 8);
+    switch (frm) {
+    case __RISCV_FRM_RTZ:
+        break;
+    case __RISCV_FRM_RDN:
+        o = __riscv_vadd_mu(__riscv_vmand(inexact, neg, 8), o, o, 1, 8);
+        big = __riscv_vadd_mu(neg, big, big, 1, 8);
+        break;
+    case __RISCV_FRM_RUP:
+        o = __riscv_vadd_mu(__riscv_vmandn(inexact, neg, 8), o, o, 1, 8);
+        big = __riscv_vadd_mu(__riscv_vmnot(neg, 8), big, big, 1, 8);
+        break;
+    default:
+        /* ties to even: rem + (o & 1) exceeds half exactly when rounding up */
+        o = __riscv_vadd_mu(__riscv_vmsgtu(__riscv_vadd(rem, __riscv_vand(o, 1, 8), 8),
+                                           __riscv_vsrl(unit, 1, 8), 8),
+                            o, o, 1, 8);
+        big = __riscv_vadd(big, 1, 8);
+        break;
+    }
+    o = __riscv_vmerge(o, big, __riscv_vmsgeu(mag, 143u << 23, 8), 8);
+    o = __riscv_vmerge(o, 0x7c00, __riscv_vmseq(mag, 0x7f800000, 8), 8);
+    avx256_u32_t nan = __riscv_vor(__riscv_vand(__riscv_vsrl(mag, 13, 8), 0x3ff, 8), 0x7e00, 8);
+    o = __riscv_vmerge(o, nan, __riscv_vmsgtu(mag, 0x7f800000, 8), 8);
+    return __riscv_vor(o, __riscv_vand(__riscv_vsrl(f, 16, 8), 0x8000, 8), 8);
+}
+#endif
+
+FORCE_INLINE __m256 _mm256_cvtph_ps(__m128i a) {
+    AVX2RVV_CAT(AVX2RVV_CAT(vuint16, AVX256_HALF), _t) h = _avx256_u16_m128i(a);
+#if defined(__riscv_zvfhmin) || defined(__riscv_zvfh)
+    return __riscv_vfwcvt_f(AVX2RVV_CAT(__riscv_vreinterpret_f16, AVX256_HALF)(h), 8);
+#else
+    return _avx256_cvtph_ps(__riscv_vzext_vf2(h, 8));
+#endif
+}
+
+#if defined(__riscv_zvfhmin) || defined(__riscv_zvfh)
+FORCE_INLINE AVX2RVV_CAT(AVX2RVV_CAT(vfloat16, AVX256_HALF), _t)
+_avx256_cvtps_ph_f16(__m256 a, const int imm8) {
+    _avx512_round_call(imm8, AVX2RVV_CAT(__riscv_vfncvt_f_f_w_f16, AVX256_HALF), 8, a);
+}
+#endif
+
+FORCE_INLINE __m128i _mm256_cvtps_ph(__m256 a, const int imm8) {
+#if defined(__riscv_zvfhmin) || defined(__riscv_zvfh)
+    return _avx256_m128i_u16(
+        AVX2RVV_CAT(__riscv_vreinterpret_u16, AVX256_HALF)(_avx256_cvtps_ph_f16(a, imm8)));
+#else
+    static const int frm[4] = {__RISCV_FRM_RNE, __RISCV_FRM_RDN, __RISCV_FRM_RUP,
+                               __RISCV_FRM_RTZ};
+    int mode;
+    if (imm8 & _MM_FROUND_CUR_DIRECTION)
+        __asm__ volatile("frrm %0" : "=r"(mode));
+    else
+        mode = frm[imm8 & 3];
+    avx256_u32_t r = _avx256_cvtps_ph(vreinterpret_u32_m256(a), mode);
+    return _avx256_m128i_u16(__riscv_vncvt_x(r, 8));
+#endif
+}
+
+/* ===== Gather and scatter ===== */
+/* x86 indices are signed and scaled by 1, 2, 4 or 8, while RVV indexed
+ * accesses take unsigned byte offsets and zero-extend narrower ones to
+ * XLEN. 32-bit indices are therefore widened to 64-bit offsets by a single
+ * vwmul, and 64-bit ones scaled in place. Scatters use the ordered vsoxei
+ * so that, as on x86, the highest lane wins when two indices collide. */
+FORCE_INLINE avx512_off32_t _avx512_off_epi32(avx512_i32_t vindex, int scale) {
+    return AVX2RVV_CAT(__riscv_vreinterpret_u64, AVX512_WIDE)(__riscv_vwmul(vindex, scale, 16));
+}
+
+FORCE_INLINE avx256_off32_t _avx256_off_epi32(avx256_i32_t vindex, int scale) {
+    return AVX2RVV_CAT(__riscv_vreinterpret_u64, AVX256_WIDE)(__riscv_vwmul(vindex, scale, 8));
+}
+
+FORCE_INLINE avx512_u64_t _avx512_off_epi64(avx512_i64_t vindex, int scale) {
+    return _avx512_rvv(vreinterpret_u64)(__riscv_vmul(vindex, scale, 8));
+}
+
+FORCE_INLINE avx256_u64_t _avx256_off_epi64(avx256_i64_t vindex, int scale) {
+    return _avx256_rvv(vreinterpret_u64)(__riscv_vmul(vindex, scale, 4));
+}
+
+/* Eight lanes whose index and data widths differ: the offsets must have the
+ * LMUL the data's EEW calls for. Below VLEN=512 the 256-bit offsets and the
+ * 512-bit group coincide; from VLEN=512 both types are m1 and the offsets
+ * are resized to match. */
+FORCE_INLINE avx512_u64_t _avx512_off_epi32_64(avx256_i32_t vindex, int scale) {
+#if AVX2RVV_VLEN >= 512
+    return __riscv_vlmul_trunc_u64m1(_avx256_off_epi32(vindex, scale));
+#else
+    return _avx256_off_epi32(vindex, scale);
+#endif
+}
+
+FORCE_INLINE avx256_off32_t _avx512_off_epi64_32(avx512_i64_t vindex, int scale) {
+#if AVX2RVV_VLEN >= 512
+    return __riscv_vlmul_ext_u64m2(_avx512_off_epi64(vindex, scale));
+#else
+    return _avx512_off_epi64(vindex, scale);
+#endif
+}
+
+/* AVX2 forms whose index or result is a 128-bit register. Four 32-bit
+ * indices in an m1 __m128i widen to offsets for 256 bits of 64-bit data,
+ * which have the data's LMUL; four 64-bit indices address a 128-bit m1
+ * result, whose 64-bit offsets are m2. */
+FORCE_INLINE avx256_u64_t _avx256_off_epi32_64(__m128i vindex, int scale) {
+    vuint64m2_t off = __riscv_vreinterpret_u64m2(__riscv_vwmul(vindex, scale, 4));
+#if AVX2RVV_VLEN >= 256
+    return __riscv_vlmul_trunc_u64m1(off);
+#else
+    return off;
+#endif
+}
+
+FORCE_INLINE vuint64m2_t _avx256_off_epi64_32(__m256i vindex, int scale) {
+#if AVX2RVV_VLEN >= 256
+    return __riscv_vlmul_ext_u64m2(_avx256_off_epi64(vindex, scale));
+#else
+    return _avx256_off_epi64(vindex, scale);
+#endif
+}
+
+/* AVX2 gathers take a vector mask and load the lanes whose sign bit is set */
+FORCE_INLINE __m256i _mm256_i32gather_epi32(int const* base_addr, __m256i vindex, const int scale) {
+    avx256_off32_t off = _avx256_off_epi32(vreinterpret_i32_m256i(vindex), scale);
+    return vreinterpret_m256i_i32(__riscv_vluxei64((const int32_t*)base_addr, off, 8));
+}
+
+FORCE_INLINE __m256i _mm256_mask_i32gather_epi32(__m256i src, int const* base_addr, __m256i vindex,
+                                                 __m256i mask, const int scale) {
+    avx256_off32_t off = _avx256_off_epi32(vreinterpret_i32_m256i(vindex), scale);
+    avx256_b32_t m = __riscv_vmslt(vreinterpret_i32_m256i(mask), 0, 8);
+    return vreinterpret_m256i_i32(
+        __riscv_vluxei64_mu(m, vreinterpret_i32_m256i(src), (const int32_t*)base_addr, off, 8));
+}
+
+FORCE_INLINE __m256 _mm256_i32gather_ps(float const* base_addr, __m256i vindex, const int scale) {
+    avx256_off32_t off = _avx256_off_epi32(vreinterpret_i32_m256i(vindex), scale);
+    return __riscv_vluxei64(base_addr, off, 8);
+}
+
+FORCE_INLINE __m256 _mm256_mask_i32gather_ps(__m256 src, float const* base_addr, __m256i vindex,
+                                             __m256 mask, const int scale) {
+    avx256_off32_t off = _avx256_off_epi32(vreinterpret_i32_m256i(vindex), scale);
+    avx256_b32_t m = __riscv_vmslt(vreinterpret_i32_m256(mask), 0, 8);
+    return __riscv_vluxei64_mu(m, src, base_addr, off, 8);
+}
+
+FORCE_INLINE __m256i _mm256_i64gather_epi64(long long const* base_addr, __m256i vindex, const int scale) {
+    avx256_u64_t off = _avx256_off_epi64(vindex, scale);
+    return __riscv_vluxei64((const int64_t*)base_addr, off, 4);
+}
+
+FORCE_INLINE __m256i _mm256_mask_i64gather_epi64(__m256i src, long long const* base_addr, __m256i vindex,
+                                                 __m256i mask, const int scale) {
+    avx256_u64_t off = _avx256_off_epi64(vindex, scale);
+    avx256_b64_t m = __riscv_vmslt(mask, 0, 4);
+    return __riscv_vluxei64_mu(m, src, (const int64_t*)base_addr, off, 4);
+}
+
+FORCE_INLINE __m256d _mm256_i64gather_pd(double const* base_addr, __m256i vindex, const int scale) {
+    avx256_u64_t off = _avx256_off_epi64(vindex, scale);
+    return __riscv_vluxei64(base_addr, off, 4);
+}
+
+FORCE_INLINE __m256d _mm256_mask_i64gather_pd(__m256d src, double const* base_addr, __m256i vindex,
+                                              __m256d mask, const int scale) {
+    avx256_u64_t off = _avx256_off_epi64(vindex, scale);
+    avx256_b64_t m = __riscv_vmslt(vreinterpret_i64_m256d(mask), 0, 4);
+    return __riscv_vluxei64_mu(m, src, base_addr, off, 4);
+}
+
+FORCE_INLINE __m256i _mm256_i32gather_epi64(long long const* base_addr, __m128i vindex, const int scale) {
+    avx256_u64_t off = _avx256_off_epi32_64(vindex, scale);
+    return __riscv_vluxei64((const int64_t*)base_addr, off, 4);
+}
+
+FORCE_INLINE __m256i _mm256_mask_i32gather_epi64(__m256i src, long long const* base_addr, __m128i vindex,
+                                                 __m256i mask, const int scale) {
+    avx256_u64_t off = _avx256_off_epi32_64(vindex, scale);
+    avx256_b64_t m = __riscv_vmslt(mask, 0, 4);
+    return __riscv_vluxei64_mu(m, src, (const int64_t*)base_addr, off, 4);
+}
+
+FORCE_INLINE __m256d _mm256_i32gather_pd(double const* base_addr, __m128i vindex, const int scale) {
+    avx256_u64_t off = _avx256_off_epi32_64(vindex, scale);
+    return __riscv_vluxei64(base_addr, off, 4);
+}
+
+FORCE_INLINE __m256d _mm256_mask_i32gather_pd(__m256d src, double const* base_addr, __m128i vindex,
+                                              __m256d mask, const int scale) {
+    avx256_u64_t off = _avx256_off_epi32_64(vindex, scale);
+    avx256_b64_t m = __riscv_vmslt(vreinterpret_i64_m256d(mask), 0, 4);
+    return __riscv_vluxei64_mu(m, src, base_addr, off, 4);
+}
+
+FORCE_INLINE __m128i _mm256_i64gather_epi32(int const* base_addr, __m256i vindex, const int scale) {
+    vuint64m2_t off = _avx256_off_epi64_32(vindex, scale);
+    return __riscv_vluxei64((const int32_t*)base_addr, off, 4);
+}
+
+FORCE_INLINE __m128i _mm256_mask_i64gather_epi32(__m128i src, int const* base_addr, __m256i vindex,
+                                                 __m128i mask, const int scale) {
+    vuint64m2_t off = _avx256_off_epi64_32(vindex, scale);
+    return __riscv_vluxei64_mu(__riscv_vmslt(mask, 0, 4), src, (const int32_t*)base_addr, off, 4);
+}
+
+FORCE_INLINE __m128 _mm256_i64gather_ps(float const* base_addr, __m256i vindex, const int scale) {
+    vuint64m2_t off = _avx256_off_epi64_32(vindex, scale);
+    return __riscv_vluxei64(base_addr, off, 4);
+}
+
+FORCE_INLINE __m128 _mm256_mask_i64gather_ps(__m128 src, float const* base_addr, __m256i vindex,
+                                             __m128 mask, const int scale) {
+    vuint64m2_t off = _avx256_off_epi64_32(vindex, scale);
+    vbool32_t m = __riscv_vmslt(__riscv_vreinterpret_i32m1(mask), 0, 4);
+    return __riscv_vluxei64_mu(m, src, base_addr, off, 4);
+}
+
+FORCE_INLINE __m512i _mm512_i32gather_epi32(__m512i vindex, void const* base_addr, int scale) {
+    avx512_off32_t off = _avx512_off_epi32(vreinterpret_i32_m512i(vindex), scale);
+    return vreinterpret_m512i_i32(__riscv_vluxei64((const int32_t*)base_addr, off, 16));
+}
+
+FORCE_INLINE __m512i _mm512_mask_i32gather_epi32(__m512i src, __mmask16 k, __m512i vindex,
+                                                 void const* base_addr, int scale) {
+    avx512_off32_t off = _avx512_off_epi32(vreinterpret_i32_m512i(vindex), scale);
+    return vreinterpret_m512i_i32(__riscv_vluxei64_mu(
+        _avx512_mask_to_b32(k), vreinterpret_i32_m512i(src), (const int32_t*)base_addr, off, 16));
+}
+
+FORCE_INLINE __m512 _mm512_i32gather_ps(__m512i vindex, void const* base_addr, int scale) {
+    avx512_off32_t off = _avx512_off_epi32(vreinterpret_i32_m512i(vindex), scale);
+    return __riscv_vluxei64((const float*)base_addr, off, 16);
+}
+
+FORCE_INLINE __m512 _mm512_mask_i32gather_ps(__m512 src, __mmask16 k, __m512i vindex,
+                                             void const* base_addr, int scale) {
+    avx512_off32_t off = _avx512_off_epi32(vreinterpret_i32_m512i(vindex), scale);
+    return __riscv_vluxei64_mu(_avx512_mask_to_b32(k), src, (const float*)base_addr, off, 16);
+}
+
+FORCE_INLINE __m512i _mm512_i32gather_epi64(__m256i vindex, void const* base_addr, int scale) {
+    avx512_u64_t off = _avx512_off_epi32_64(vreinterpret_i32_m256i(vindex), scale);
+    return __riscv_vluxei64((const int64_t*)base_addr, off, 8);
+}
+
+FORCE_INLINE __m512i _mm512_mask_i32gather_epi64(__m512i src, __mmask8 k, __m256i vindex,
+                                                 void const* base_addr, int scale) {
+    avx512_u64_t off = _avx512_off_epi32_64(vreinterpret_i32_m256i(vindex), scale);
+    return __riscv_vluxei64_mu(_avx512_mask_to_b64(k), src, (const int64_t*)base_addr, off, 8);
+}
+
+FORCE_INLINE __m512d _mm512_i32gather_pd(__m256i vindex, void const* base_addr, int scale) {
+    avx512_u64_t off = _avx512_off_epi32_64(vreinterpret_i32_m256i(vindex), scale);
+    return __riscv_vluxei64((const double*)base_addr, off, 8);
+}
+
+FORCE_INLINE __m512d _mm512_mask_i32gather_pd(__m512d src, __mmask8 k, __m256i vindex,
+                                              void const* base_addr, int scale) {
+    avx512_u64_t off = _avx512_off_epi32_64(vreinterpret_i32_m256i(vindex), scale);
+    return __riscv_vluxei64_mu(_avx512_mask_to_b64(k), src, (const double*)base_addr, off, 8);
+}
+
+FORCE_INLINE __m512i _mm512_i64gather_epi64(__m512i vindex, void const* base_addr, int scale) {
+    avx512_u64_t off = _avx512_off_epi64(vindex, scale);
+    return __riscv_vluxei64((const int64_t*)base_addr, off, 8);
+}
+
+FORCE_INLINE __m512i _mm512_mask_i64gather_epi64(__m512i src, __mmask8 k, __m512i vindex,
+                                                 void const* base_addr, int scale) {
+    avx512_u64_t off = _avx512_off_epi64(vindex, scale);
+    return __riscv_vluxei64_mu(_avx512_mask_to_b64(k), src, (const int64_t*)base_addr, off, 8);
+}
+
+FORCE_INLINE __m512d _mm512_i64gather_pd(__m512i vindex, void const* base_addr, int scale) {
+    avx512_u64_t off = _avx512_off_epi64(vindex, scale);
+    return __riscv_vluxei64((const double*)base_addr, off, 8);
+}
+
+FORCE_INLINE __m512d _mm512_mask_i64gather_pd(__m512d src, __mmask8 k, __m512i vindex,
+                                              void const* base_addr, int scale) {
+    avx512_u64_t off = _avx512_off_epi64(vindex, scale);
+    return __riscv_vluxei64_mu(_avx512_mask_to_b64(k), src, (const double*)base_addr, off, 8);
+}
+
+FORCE_INLINE __m256i _mm512_i64gather_epi32(__m512i vindex, void const* base_addr, int scale) {
+    avx256_off32_t off = _avx512_off_epi64_32(vindex, scale);
+    return vreinterpret_m256i_i32(__riscv_vluxei64((const int32_t*)base_addr, off, 8));
+}
+
+FORCE_INLINE __m256i _mm512_mask_i64gather_epi32(__m256i src, __mmask8 k, __m512i vindex,
+                                                 void const* base_addr, int scale) {
+    avx256_off32_t off = _avx512_off_epi64_32(vindex, scale);
+    avx256_b32_t m = _avx_k_to_bool(AVX256_MASK32, k);
+    return vreinterpret_m256i_i32(
+        __riscv_vluxei64_mu(m, vreinterpret_i32_m256i(src), (const int32_t*)base_addr, off, 8));
+}
+
+FORCE_INLINE __m256 _mm512_i64gather_ps(__m512i vindex, void const* base_addr, int scale) {
+    avx256_off32_t off = _avx512_off_epi64_32(vindex, scale);
+    return __riscv_vluxei64((const float*)base_addr, off, 8);
+}
+
+FORCE_INLINE __m256 _mm512_mask_i64gather_ps(__m256 src, __mmask8 k, __m512i vindex,
+                                             void const* base_addr, int scale) {
+    avx256_off32_t off = _avx512_off_epi64_32(vindex, scale);
+    return __riscv_vluxei64_mu(_avx_k_to_bool(AVX256_MASK32, k), src, (const float*)base_addr, off, 8);
+}
+
+FORCE_INLINE void _mm512_i32scatter_epi32(void* base_addr, __m512i vindex, __m512i a, int scale) {
+    avx512_off32_t off = _avx512_off_epi32(vreinterpret_i32_m512i(vindex), scale);
+    __riscv_vsoxei64((int32_t*)base_addr, off, vreinterpret_i32_m512i(a), 16);
+}
+
+FORCE_INLINE void _mm512_mask_i32scatter_epi32(void* base_addr, __mmask16 k, __m512i vindex,
+                                               __m512i a, int scale) {
+    avx512_off32_t off = _avx512_off_epi32(vreinterpret_i32_m512i(vindex), scale);
+    __riscv_vsoxei64(_avx512_mask_to_b32(k), (int32_t*)base_addr, off, vreinterpret_i32_m512i(a), 16);
+}
+
+FORCE_INLINE void _mm512_i32scatter_ps(void* base_addr, __m512i vindex, __m512 a, int scale) {
+    avx512_off32_t off = _avx512_off_epi32(vreinterpret_i32_m512i(vindex), scale);
+    __riscv_vsoxei64((float*)base_addr, off, a, 16);
+}
+
+FORCE_INLINE void _mm512_mask_i32scatter_ps(void* base_addr, __mmask16 k, __m512i vindex,
+                                            __m512 a, int scale) {
+    avx512_off32_t off = _avx512_off_epi32(vreinterpret_i32_m512i(vindex), scale);
+    __riscv_vsoxei64(_avx512_mask_to_b32(k), (float*)base_addr, off, a, 16);
+}
+
+FORCE_INLINE void _mm512_i32scatter_epi64(void* base_addr, __m256i vindex, __m512i a, int scale) {
+    avx512_u64_t off = _avx512_off_epi32_64(vreinterpret_i32_m256i(vindex), scale);
+    __riscv_vsoxei64((int64_t*)base_addr, off, a, 8);
+}
+
+FORCE_INLINE void _mm512_mask_i32scatter_epi64(void* base_addr, __mmask8 k, __m256i vindex,
+                                               __m512i a, int scale) {
+    avx512_u64_t off = _avx512_off_epi32_64(vreinterpret_i32_m256i(vindex), scale);
+    __riscv_vsoxei64(_avx512_mask_to_b64(k), (int64_t*)base_addr, off, a, 8);
+}
+
+FORCE_INLINE void _mm512_i32scatter_pd(void* base_addr, __m256i vindex, __m512d a, int scale) {
+    avx512_u64_t off = _avx512_off_epi32_64(vreinterpret_i32_m256i(vindex), scale);
+    __riscv_vsoxei64((double*)base_addr, off, a, 8);
+}
+
+FORCE_INLINE void _mm512_mask_i32scatter_pd(void* base_addr, __mmask8 k, __m256i vindex,
+                                            __m512d a, int scale) {
+    avx512_u64_t off = _avx512_off_epi32_64(vreinterpret_i32_m256i(vindex), scale);
+    __riscv_vsoxei64(_avx512_mask_to_b64(k), (double*)base_addr, off, a, 8);
+}
+
+FORCE_INLINE void _mm512_i64scatter_epi64(void* base_addr, __m512i vindex, __m512i a, int scale) {
+    __riscv_vsoxei64((int64_t*)base_addr, _avx512_off_epi64(vindex, scale), a, 8);
+}
+
+FORCE_INLINE void _mm512_mask_i64scatter_epi64(void* base_addr, __mmask8 k, __m512i vindex,
+                                               __m512i a, int scale) {
+    __riscv_vsoxei64(_avx512_mask_to_b64(k), (int64_t*)base_addr, _avx512_off_epi64(vindex, scale), a, 8);
+}
+
+FORCE_INLINE void _mm512_i64scatter_pd(void* base_addr, __m512i vindex, __m512d a, int scale) {
+    __riscv_vsoxei64((double*)base_addr, _avx512_off_epi64(vindex, scale), a, 8);
+}
+
+FORCE_INLINE void _mm512_mask_i64scatter_pd(void* base_addr, __mmask8 k, __m512i vindex,
+                                            __m512d a, int scale) {
+    __riscv_vsoxei64(_avx512_mask_to_b64(k), (double*)base_addr, _avx512_off_epi64(vindex, scale), a, 8);
+}
+
+FORCE_INLINE void _mm512_i64scatter_epi32(void* base_addr, __m512i vindex, __m256i a, int scale) {
+    avx256_off32_t off = _avx512_off_epi64_32(vindex, scale);
+    __riscv_vsoxei64((int32_t*)base_addr, off, vreinterpret_i32_m256i(a), 8);
+}
+
+FORCE_INLINE void _mm512_mask_i64scatter_epi32(void* base_addr, __mmask8 k, __m512i vindex,
+                                               __m256i a, int scale) {
+    avx256_off32_t off = _avx512_off_epi64_32(vindex, scale);
+    __riscv_vsoxei64(_avx_k_to_bool(AVX256_MASK32, k), (int32_t*)base_addr, off,
+                     vreinterpret_i32_m256i(a), 8);
+}
+
+FORCE_INLINE void _mm512_i64scatter_ps(void* base_addr, __m512i vindex, __m256 a, int scale) {
+    avx256_off32_t off = _avx512_off_epi64_32(vindex, scale);
+    __riscv_vsoxei64((float*)base_addr, off, a, 8);
+}
+
+FORCE_INLINE void _mm512_mask_i64scatter_ps(void* base_addr, __mmask8 k, __m512i vindex,
+                                            __m256 a, int scale) {
+    avx256_off32_t off = _avx512_off_epi64_32(vindex, scale);
+    __riscv_vsoxei64(_avx_k_to_bool(AVX256_MASK32, k), (float*)base_addr, off, a, 8);
+}
+
+/* ===== Compress and expand ===== */
+/* Compress is vcompress with the tail undisturbed, so lanes past popcnt(k)
+ * keep src. Expand routes lane j to element viota(k)[j] of the packed
+ * source with a masked vrgather. The memory forms move exactly popcnt(k)
+ * elements: vl is set to the vcpop of the mask. */
+FORCE_INLINE __m512i _mm512_mask_compress_epi8(__m512i src, __mmask64 k, __m512i a) {
+    avx512_i8_t vsrc = vreinterpret_i8_m512i(src);
+    avx512_i8_t va = vreinterpret_i8_m512i(a);
+    return vreinterpret_m512i_i8(__riscv_vcompress_tu(vsrc, va, _avx512_mask_to_b8(k), 64));
+}
+
+FORCE_INLINE __m512i _mm512_maskz_compress_epi8(__mmask64 k, __m512i a) {
+    return _mm512_mask_compress_epi8(_mm512_setzero_si512(), k, a);
+}
+
+FORCE_INLINE void _mm512_mask_compressstoreu_epi8(void* base_addr, __mmask64 k, __m512i a) {
+    avx512_b8_t m = _avx512_mask_to_b8(k);
+    avx512_i8_t packed = __riscv_vcompress(vreinterpret_i8_m512i(a), m, 64);
+    __riscv_vse8((int8_t*)base_addr, packed, __riscv_vcpop(m, 64));
+}
+
+FORCE_INLINE __m512i _mm512_mask_expand_epi8(__m512i src, __mmask64 k, __m512i a) {
+    avx512_b8_t m = _avx512_mask_to_b8(k);
+    avx512_u8_t idx = _avx512_rvv(viota_m_u8)(m, 64);
+    avx512_i8_t vsrc = vreinterpret_i8_m512i(src);
+    return vreinterpret_m512i_i8(__riscv_vrgather_mu(m, vsrc, vreinterpret_i8_m512i(a), idx, 64));
+}
+
+FORCE_INLINE __m512i _mm512_maskz_expand_epi8(__mmask64 k, __m512i a) {
+    return _mm512_mask_expand_epi8(_mm512_setzero_si512(), k, a);
+}
+
+FORCE_INLINE __m512i _mm512_mask_expandloadu_epi8(__m512i src, __mmask64 k, void const* mem_addr) {
+    avx512_b8_t m = _avx512_mask_to_b8(k);
+    avx512_i8_t packed = _avx512_rvv(vle8_v_i8)((const int8_t*)mem_addr, __riscv_vcpop(m, 64));
+    avx512_u8_t idx = _avx512_rvv(viota_m_u8)(m, 64);
+    avx512_i8_t vsrc = vreinterpret_i8_m512i(src);
+    return vreinterpret_m512i_i8(__riscv_vrgather_mu(m, vsrc, packed, idx, 64));
+}
+
+FORCE_INLINE __m512i _mm512_maskz_expandloadu_epi8(__mmask64 k, void const* mem_addr) {
+    return _mm512_mask_expandloadu_epi8(_mm512_setzero_si512(), k, mem_addr);
+}
+
+FORCE_INLINE __m512i _mm512_mask_compress_epi16(__m512i src, __mmask32 k, __m512i a) {
+    avx512_i16_t vsrc = vreinterpret_i16_m512i(src);
+    avx512_i16_t va = vreinterpret_i16_m512i(a);
+    return vreinterpret_m512i_i16(__riscv_vcompress_tu(vsrc, va, _avx512_mask_to_b16(k), 32));
+}
+
+FORCE_INLINE __m512i _mm512_maskz_compress_epi16(__mmask32 k, __m512i a) {
+    return _mm512_mask_compress_epi16(_mm512_setzero_si512(), k, a);
+}
+
+FORCE_INLINE void _mm512_mask_compressstoreu_epi16(void* base_addr, __mmask32 k, __m512i a) {
+    avx512_b16_t m = _avx512_mask_to_b16(k);
+    avx512_i16_t packed = __riscv_vcompress(vreinterpret_i16_m512i(a), m, 32);
+    __riscv_vse16((int16_t*)base_addr, packed, __riscv_vcpop(m, 32));
+}
+
+FORCE_INLINE __m512i _mm512_mask_expand_epi16(__m512i src, __mmask32 k, __m512i a) {
+    avx512_b16_t m = _avx512_mask_to_b16(k);
+    avx512_u16_t idx = _avx512_rvv(viota_m_u16)(m, 32);
+    avx512_i16_t vsrc = vreinterpret_i16_m512i(src);
+    return vreinterpret_m512i_i16(__riscv_vrgather_mu(m, vsrc, vreinterpret_i16_m512i(a), idx, 32));
+}
+
+FORCE_INLINE __m512i _mm512_maskz_expand_epi16(__mmask32 k, __m512i a) {
+    return _mm512_mask_expand_epi16(_mm512_setzero_si512(), k, a);
+}
+
+FORCE_INLINE __m512i _mm512_mask_expandloadu_epi16(__m512i src, __mmask32 k, void const* mem_addr) {
+    avx512_b16_t m = _avx512_mask_to_b16(k);
+    avx512_i16_t packed = _avx512_rvv(vle16_v_i16)((const int16_t*)mem_addr, __riscv_vcpop(m, 32));
+    avx512_u16_t idx = _avx512_rvv(viota_m_u16)(m, 32);
+    avx512_i16_t vsrc = vreinterpret_i16_m512i(src);
+    return vreinterpret_m512i_i16(__riscv_vrgather_mu(m, vsrc, packed, idx, 32));
+}
+
+FORCE_INLINE __m512i _mm512_maskz_expandloadu_epi16(__mmask32 k, void const* mem_addr) {
+    return _mm512_mask_expandloadu_epi16(_mm512_setzero_si512(), k, mem_addr);
+}
+
+FORCE_INLINE __m512i _mm512_mask_compress_epi32(__m512i src, __mmask16 k, __m512i a) {
+    avx512_i32_t vsrc = vreinterpret_i32_m512i(src);
+    avx512_i32_t va = vreinterpret_i32_m512i(a);
+    return vreinterpret_m512i_i32(__riscv_vcompress_tu(vsrc, va, _avx512_mask_to_b32(k), 16));
+}
+
+FORCE_INLINE __m512i _mm512_maskz_compress_epi32(__mmask16 k, __m512i a) {
+    return _mm512_mask_compress_epi32(_mm512_setzero_si512(), k, a);
+}
+
+FORCE_INLINE void _mm512_mask_compressstoreu_epi32(void* base_addr, __mmask16 k, __m512i a) {
+    avx512_b32_t m = _avx512_mask_to_b32(k);
+    avx512_i32_t packed = __riscv_vcompress(vreinterpret_i32_m512i(a), m, 16);
+    __riscv_vse32((int32_t*)base_addr, packed, __riscv_vcpop(m, 16));
+}
+
+FORCE_INLINE __m512i _mm512_mask_expand_epi32(__m512i src, __mmask16 k, __m512i a) {
+    avx512_b32_t m = _avx512_mask_to_b32(k);
+    avx512_u32_t idx = _avx512_rvv(viota_m_u32)(m, 16);
+    avx512_i32_t vsrc = vreinterpret_i32_m512i(src);
+    return vreinterpret_m512i_i32(__riscv_vrgather_mu(m, vsrc, vreinterpret_i32_m512i(a), idx, 16));
+}
+
+FORCE_INLINE __m512i _mm512_maskz_expand_epi32(__mmask16 k, __m512i a) {
+    return _mm512_mask_expand_epi32(_mm512_setzero_si512(), k, a);
+}
+
+FORCE_INLINE __m512i _mm512_mask_expandloadu_epi32(__m512i src, __mmask16 k, void const* mem_addr) {
+    avx512_b32_t m = _avx512_mask_to_b32(k);
+    avx512_i32_t packed = _avx512_rvv(vle32_v_i32)((const int32_t*)mem_addr, __riscv_vcpop(m, 16));
+    avx512_u32_t idx = _avx512_rvv(viota_m_u32)(m, 16);
+    avx512_i32_t vsrc = vreinterpret_i32_m512i(src);
+    return vreinterpret_m512i_i32(__riscv_vrgather_mu(m, vsrc, packed, idx, 16));
+}
+
+FORCE_INLINE __m512i _mm512_maskz_expandloadu_epi32(__mmask16 k, void const* mem_addr) {
+    return _mm512_mask_expandloadu_epi32(_mm512_setzero_si512(), k, mem_addr);
+}
+
+FORCE_INLINE __m512i _mm512_mask_compress_epi64(__m512i src, __mmask8 k, __m512i a) {
+    avx512_i64_t vsrc = vreinterpret_i64_m512i(src);
+    avx512_i64_t va = vreinterpret_i64_m512i(a);
+    return vreinterpret_m512i_i64(__riscv_vcompress_tu(vsrc, va, _avx512_mask_to_b64(k), 8));
+}
+
+FORCE_INLINE __m512i _mm512_maskz_compress_epi64(__mmask8 k, __m512i a) {
+    return _mm512_mask_compress_epi64(_mm512_setzero_si512(), k, a);
+}
+
+FORCE_INLINE void _mm512_mask_compressstoreu_epi64(void* base_addr, __mmask8 k, __m512i a) {
+    avx512_b64_t m = _avx512_mask_to_b64(k);
+    avx512_i64_t packed = __riscv_vcompress(vreinterpret_i64_m512i(a), m, 8);
+    __riscv_vse64((int64_t*)base_addr, packed, __riscv_vcpop(m, 8));
+}
+
+FORCE_INLINE __m512i _mm512_mask_expand_epi64(__m512i src, __mmask8 k, __m512i a) {
+    avx512_b64_t m = _avx512_mask_to_b64(k);
+    avx512_u64_t idx = _avx512_rvv(viota_m_u64)(m, 8);
+    avx512_i64_t vsrc = vreinterpret_i64_m512i(src);
+    return vreinterpret_m512i_i64(__riscv_vrgather_mu(m, vsrc, vreinterpret_i64_m512i(a), idx, 8));
+}
+
+FORCE_INLINE __m512i _mm512_maskz_expand_epi64(__mmask8 k, __m512i a) {
+    return _mm512_mask_expand_epi64(_mm512_setzero_si512(), k, a);
+}
+
+FORCE_INLINE __m512i _mm512_mask_expandloadu_epi64(__m512i src, __mmask8 k, void const* mem_addr) {
+    avx512_b64_t m = _avx512_mask_to_b64(k);
+    avx512_i64_t packed = _avx512_rvv(vle64_v_i64)((const int64_t*)mem_addr, __riscv_vcpop(m, 8));
+    avx512_u64_t idx = _avx512_rvv(viota_m_u64)(m, 8);
+    avx512_i64_t vsrc = vreinterpret_i64_m512i(src);
+    return vreinterpret_m512i_i64(__riscv_vrgather_mu(m, vsrc, packed, idx, 8));
+}
+
+FORCE_INLINE __m512i _mm512_maskz_expandloadu_epi64(__mmask8 k, void const* mem_addr) {
+    return _mm512_mask_expandloadu_epi64(_mm512_setzero_si512(), k, mem_addr);
+}
+
+FORCE_INLINE __m512 _mm512_mask_compress_ps(__m512 src, __mmask16 k, __m512 a) {
+    return __riscv_vcompress_tu(src, a, _avx512_mask_to_b32(k), 16);
+}
+
+FORCE_INLINE __m512 _mm512_maskz_compress_ps(__mmask16 k, __m512 a) {
+    return _mm512_mask_compress_ps(_mm512_setzero_ps(), k, a);
+}
+
+FORCE_INLINE void _mm512_mask_compressstoreu_ps(void* base_addr, __mmask16 k, __m512 a) {
+    avx512_b32_t m = _avx512_mask_to_b32(k);
+    __riscv_vse32((float*)base_addr, __riscv_vcompress(a, m, 16), __riscv_vcpop(m, 16));
+}
+
+FORCE_INLINE __m512 _mm512_mask_expand_ps(__m512 src, __mmask16 k, __m512 a) {
+    avx512_b32_t m = _avx512_mask_to_b32(k);
+    avx512_u32_t idx = _avx512_rvv(viota_m_u32)(m, 16);
+    return __riscv_vrgather_mu(m, src, a, idx, 16);
+}
+
+FORCE_INLINE __m512 _mm512_maskz_expand_ps(__mmask16 k, __m512 a) {
+    return _mm512_mask_expand_ps(_mm512_setzero_ps(), k, a);
+}
+
+FORCE_INLINE __m512 _mm512_mask_expandloadu_ps(__m512 src, __mmask16 k, void const* mem_addr) {
+    avx512_b32_t m = _avx512_mask_to_b32(k);
+    avx512_f32_t packed = _avx512_rvv(vle32_v_f32)((const float*)mem_addr, __riscv_vcpop(m, 16));
+    avx512_u32_t idx = _avx512_rvv(viota_m_u32)(m, 16);
+    return __riscv_vrgather_mu(m, src, packed, idx, 16);
+}
+
+FORCE_INLINE __m512 _mm512_maskz_expandloadu_ps(__mmask16 k, void const* mem_addr) {
+    return _mm512_mask_expandloadu_ps(_mm512_setzero_ps(), k, mem_addr);
+}
+
+FORCE_INLINE __m512d _mm512_mask_compress_pd(__m512d src, __mmask8 k, __m512d a) {
+    return __riscv_vcompress_tu(src, a, _avx512_mask_to_b64(k), 8);
+}
+
+FORCE_INLINE __m512d _mm512_maskz_compress_pd(__mmask8 k, __m512d a) {
+    return _mm512_mask_compress_pd(_mm512_setzero_pd(), k, a);
+}
+
+FORCE_INLINE void _mm512_mask_compressstoreu_pd(void* base_addr, __mmask8 k, __m512d a) {
+    avx512_b64_t m = _avx512_mask_to_b64(k);
+    __riscv_vse64((double*)base_addr, __riscv_vcompress(a, m, 8), __riscv_vcpop(m, 8));
+}
+
+FORCE_INLINE __m512d _mm512_mask_expand_pd(__m512d src, __mmask8 k, __m512d a) {
+    avx512_b64_t m = _avx512_mask_to_b64(k);
+    avx512_u64_t idx = _avx512_rvv(viota_m_u64)(m, 8);
+    return __riscv_vrgather_mu(m, src, a, idx, 8);
+}
+
+FORCE_INLINE __m512d _mm512_maskz_expand_pd(__mmask8 k, __m512d a) {
+    return _mm512_mask_expand_pd(_mm512_setzero_pd(), k, a);
+}
+
+FORCE_INLINE __m512d _mm512_mask_expandloadu_pd(__m512d src, __mmask8 k, void const* mem_addr) {
+    avx512_b64_t m = _avx512_mask_to_b64(k);
+    avx512_f64_t packed = _avx512_rvv(vle64_v_f64)((const double*)mem_addr, __riscv_vcpop(m, 8));
+    avx512_u64_t idx = _avx512_rvv(viota_m_u64)(m, 8);
+    return __riscv_vrgather_mu(m, src, packed, idx, 8);
+}
+
+FORCE_INLINE __m512d _mm512_maskz_expandloadu_pd(__mmask8 k, void const* mem_addr) {
+    return _mm512_mask_expandloadu_pd(_mm512_setzero_pd(), k, mem_addr);
+}
+
+/* ===== Full-width permutes ===== */
+/* Unlike most AVX2 shuffles these index across the whole 512-bit value, so
+ * each one is a vrgather over the full register group. permutex2var picks
+ * from a or b with the bit just above the lane index: gather from a, then
+ * a second gather from b under that bit. */
+FORCE_INLINE __m512i _mm512_permutexvar_epi8(__m512i idx, __m512i a) {
+    avx512_u8_t i = __riscv_vand(vreinterpret_u8_m512i(idx), 63, 64);
+    return vreinterpret_m512i_i8(__riscv_vrgather(vreinterpret_i8_m512i(a), i, 64));
+}
+
+FORCE_INLINE __m512i _mm512_permutex2var_epi8(__m512i a, __m512i idx, __m512i b) {
+    avx512_u8_t vidx = vreinterpret_u8_m512i(idx);
+    avx512_u8_t i = __riscv_vand(vidx, 63, 64);
+    avx512_b8_t from_b = __riscv_vmsne(__riscv_vand(vidx, 64, 64), 0, 64);
+    avx512_i8_t r = __riscv_vrgather(vreinterpret_i8_m512i(a), i, 64);
+    return vreinterpret_m512i_i8(__riscv_vrgather_mu(from_b, r, vreinterpret_i8_m512i(b), i, 64));
+}
+
+FORCE_INLINE __m512i _mm512_mask_permutexvar_epi8(__m512i src, __mmask64 k, __m512i idx, __m512i a) {
+    return _mm512_mask_mov_epi8(src, k, _mm512_permutexvar_epi8(idx, a));
+}
+
+FORCE_INLINE __m512i _mm512_maskz_permutexvar_epi8(__mmask64 k, __m512i idx, __m512i a) {
+    return _mm512_maskz_mov_epi8(k, _mm512_permutexvar_epi8(idx, a));
+}
+
+FORCE_INLINE __m512i _mm512_mask_permutex2var_epi8(__m512i a, __mmask64 k, __m512i idx, __m512i b) {
+    return _mm512_mask_mov_epi8(a, k, _mm512_permutex2var_epi8(a, idx, b));
+}
+
+FORCE_INLINE __m512i _mm512_mask2_permutex2var_epi8(__m512i a, __m512i idx, __mmask64 k, __m512i b) {
+    return _mm512_mask_mov_epi8(idx, k, _mm512_permutex2var_epi8(a, idx, b));
+}
+
+FORCE_INLINE __m512i _mm512_maskz_permutex2var_epi8(__mmask64 k, __m512i a, __m512i idx, __m512i b) {
+    return _mm512_maskz_mov_epi8(k, _mm512_permutex2var_epi8(a, idx, b));
+}
+
+/* Each byte of multishift is the 8 bits of its qword of b that start at bit
+ * a & 63, wrapping around the qword. That bit sits in byte (a & 63) >> 3 at
+ * offset a & 7, so the byte and its successor within the qword are gathered
+ * and funnel-shifted right by the offset. The successor is shifted left in
+ * two steps, as an 8-bit shift by 8 would shift by 0. */
+FORCE_INLINE __m512i _mm512_multishift_epi64_epi8(__m512i a, __m512i b) {
+    avx512_u8_t vb = vreinterpret_u8_m512i(b);
+    avx512_u8_t ctrl = vreinterpret_u8_m512i(a);
+    avx512_u8_t qword = __riscv_vand(_avx512_rvv(vid_v_u8)(64), 0xf8, 64);
+    avx512_u8_t byte = __riscv_vand(__riscv_vsrl(ctrl, 3, 64), 7, 64);
+    avx512_u8_t next = __riscv_vand(__riscv_vadd(byte, 1, 64), 7, 64);
+    avx512_u8_t shift = __riscv_vand(ctrl, 7, 64);
+    avx512_u8_t lo = __riscv_vrgather(vb, __riscv_vadd(qword, byte, 64), 64);
+    avx512_u8_t hi = __riscv_vrgather(vb, __riscv_vadd(qword, next, 64), 64);
+    hi = __riscv_vsll(__riscv_vsll(hi, 1, 64), __riscv_vrsub(shift, 7, 64), 64);
+    return vreinterpret_m512i_u8(__riscv_vor(__riscv_vsrl(lo, shift, 64), hi, 64));
+}
+
+FORCE_INLINE __m512i _mm512_mask_multishift_epi64_epi8(__m512i src, __mmask64 k, __m512i a, __m512i b) {
+    return _mm512_mask_mov_epi8(src, k, _mm512_multishift_epi64_epi8(a, b));
+}
+
+FORCE_INLINE __m512i _mm512_maskz_multishift_epi64_epi8(__mmask64 k, __m512i a, __m512i b) {
+    return _mm512_maskz_mov_epi8(k, _mm512_multishift_epi64_epi8(a, b));
+}
+
+FORCE_INLINE __m256i _mm256_permutexvar_epi8(__m256i idx, __m256i a) {
+    avx256_u8_t i = __riscv_vand(vreinterpret_u8_m256i(idx), 31, 32);
+    return vreinterpret_m256i_i8(__riscv_vrgather(vreinterpret_i8_m256i(a), i, 32));
+}
+
+FORCE_INLINE __m256i _mm256_permutex2var_epi8(__m256i a, __m256i idx, __m256i b) {
+    avx256_u8_t vidx = vreinterpret_u8_m256i(idx);
+    avx256_u8_t i = __riscv_vand(vidx, 31, 32);
+    avx256_b8_t from_b = __riscv_vmsne(__riscv_vand(vidx, 32, 32), 0, 32);
+    avx256_i8_t r = __riscv_vrgather(vreinterpret_i8_m256i(a), i, 32);
+    return vreinterpret_m256i_i8(__riscv_vrgather_mu(from_b, r, vreinterpret_i8_m256i(b), i, 32));
+}
+
+FORCE_INLINE __m256i _mm256_multishift_epi64_epi8(__m256i a, __m256i b) {
+    avx256_u8_t vb = vreinterpret_u8_m256i(b);
+    avx256_u8_t ctrl = vreinterpret_u8_m256i(a);
+    avx256_u8_t qword = __riscv_vand(_avx256_rvv(vid_v_u8)(32), 0xf8, 32);
+    avx256_u8_t byte = __riscv_vand(__riscv_vsrl(ctrl, 3, 32), 7, 32);
+    avx256_u8_t next = __riscv_vand(__riscv_vadd(byte, 1, 32), 7, 32);
+    avx256_u8_t shift = __riscv_vand(ctrl, 7, 32);
+    avx256_u8_t lo = __riscv_vrgather(vb, __riscv_vadd(qword, byte, 32), 32);
+    avx256_u8_t hi = __riscv_vrgather(vb, __riscv_vadd(qword, next, 32), 32);
+    hi = __riscv_vsll(__riscv_vsll(hi, 1, 32), __riscv_vrsub(shift, 7, 32), 32);
+    return vreinterpret_m256i_u8(__riscv_vor(__riscv_vsrl(lo, shift, 32), hi, 32));
+}
+
+FORCE_INLINE __m512i _mm512_permutexvar_epi16(__m512i idx, __m512i a) {
+    avx512_u16_t i = __riscv_vand(vreinterpret_u16_m512i(idx), 31, 32);
+    return vreinterpret_m512i_i16(__riscv_vrgather(vreinterpret_i16_m512i(a), i, 32));
+}
+
+FORCE_INLINE __m512i _mm512_permutex2var_epi16(__m512i a, __m512i idx, __m512i b) {
+    avx512_u16_t vidx = vreinterpret_u16_m512i(idx);
+    avx512_u16_t i = __riscv_vand(vidx, 31, 32);
+    avx512_b16_t from_b = __riscv_vmsne(__riscv_vand(vidx, 32, 32), 0, 32);
+    avx512_i16_t r = __riscv_vrgather(vreinterpret_i16_m512i(a), i, 32);
+    return vreinterpret_m512i_i16(__riscv_vrgather_mu(from_b, r, vreinterpret_i16_m512i(b), i, 32));
+}
+
+FORCE_INLINE __m512i _mm512_permutexvar_epi32(__m512i idx, __m512i a) {
+    avx512_u32_t i = __riscv_vand(vreinterpret_u32_m512i(idx), 15, 16);
+    return vreinterpret_m512i_i32(__riscv_vrgather(vreinterpret_i32_m512i(a), i, 16));
+}
+
+FORCE_INLINE __m512i _mm512_permutex2var_epi32(__m512i a, __m512i idx, __m512i b) {
+    avx512_u32_t vidx = vreinterpret_u32_m512i(idx);
+    avx512_u32_t i = __riscv_vand(vidx, 15, 16);
+    avx512_b32_t from_b = __riscv_vmsne(__riscv_vand(vidx, 16, 16), 0, 16);
+    avx512_i32_t r = __riscv_vrgather(vreinterpret_i32_m512i(a), i, 16);
+    return vreinterpret_m512i_i32(__riscv_vrgather_mu(from_b, r, vreinterpret_i32_m512i(b), i, 16));
+}
+
+FORCE_INLINE __m512i _mm512_permutexvar_epi64(__m512i idx, __m512i a) {
+    avx512_u64_t i = __riscv_vand(vreinterpret_u64_m512i(idx), 7, 8);
+    return vreinterpret_m512i_i64(__riscv_vrgather(vreinterpret_i64_m512i(a), i, 8));
+}
+
+FORCE_INLINE __m512i _mm512_permutex2var_epi64(__m512i a, __m512i idx, __m512i b) {
+    avx512_u64_t vidx = vreinterpret_u64_m512i(idx);
+    avx512_u64_t i = __riscv_vand(vidx, 7, 8);
+    avx512_b64_t from_b = __riscv_vmsne(__riscv_vand(vidx, 8, 8), 0, 8);
+    avx512_i64_t r = __riscv_vrgather(vreinterpret_i64_m512i(a), i, 8);
+    return vreinterpret_m512i_i64(__riscv_vrgather_mu(from_b, r, vreinterpret_i64_m512i(b), i, 8));
+}
+
+FORCE_INLINE __m512 _mm512_permutexvar_ps(__m512i idx, __m512 a) {
+    avx512_u32_t i = __riscv_vand(vreinterpret_u32_m512i(idx), 15, 16);
+    return __riscv_vrgather(a, i, 16);
+}
+
+FORCE_INLINE __m512 _mm512_permutex2var_ps(__m512 a, __m512i idx, __m512 b) {
+    avx512_u32_t vidx = vreinterpret_u32_m512i(idx);
+    avx512_u32_t i = __riscv_vand(vidx, 15, 16);
+    avx512_b32_t from_b = __riscv_vmsne(__riscv_vand(vidx, 16, 16), 0, 16);
+    return __riscv_vrgather_mu(from_b, __riscv_vrgather(a, i, 16), b, i, 16);
+}
+
+FORCE_INLINE __m512d _mm512_permutexvar_pd(__m512i idx, __m512d a) {
+    avx512_u64_t i = __riscv_vand(vreinterpret_u64_m512i(idx), 7, 8);
+    return __riscv_vrgather(a, i, 8);
+}
+
+FORCE_INLINE __m512d _mm512_permutex2var_pd(__m512d a, __m512i idx, __m512d b) {
+    avx512_u64_t vidx = vreinterpret_u64_m512i(idx);
+    avx512_u64_t i = __riscv_vand(vidx, 7, 8);
+    avx512_b64_t from_b = __riscv_vmsne(__riscv_vand(vidx, 8, 8), 0, 8);
+    return __riscv_vrgather_mu(from_b, __riscv_vrgather(a, i, 8), b, i, 8);
+}
+
+/* ===== Carry-less multiply ===== */
+/* Every lane j gets the operands of its 128-bit lane, x = a[2*(j/2) + sel_a]
+ * and y likewise, so a single vclmul/vclmulh pair over all eight lanes yields
+ * the low product in the even lanes and the high one in the odd lanes. */
+FORCE_INLINE __m512i _mm512_clmulepi64_epi128(__m512i a, __m512i b, const int imm8) {
+    avx512_u64_t lane = __riscv_vsll(__riscv_vsrl(_avx512_rvv(vid_v_u64)(8), 1, 8), 1, 8);
+    avx512_u64_t x = __riscv_vrgather(vreinterpret_u64_m512i(a), __riscv_vadd(lane, imm8 & 1, 8), 8);
+    avx512_u64_t y = __riscv_vrgather(vreinterpret_u64_m512i(b), __riscv_vadd(lane, (imm8 >> 4) & 1, 8), 8);
+#if defined(__riscv_zbc) && !defined(__riscv_zvbc)
+    uint64_t xs[8], ys[8], r[8];
+    __riscv_vse64(xs, x, 8);
+    __riscv_vse64(ys, y, 8);
+    for (int i = 0; i < 8; i += 2) {
+        r[i] = __riscv_clmul_64(xs[i], ys[i]);
+        r[i + 1] = __riscv_clmulh_64(xs[i], ys[i]);
+    }
+    return vreinterpret_m512i_u64(_avx512_rvv(vle64_v_u64)(r, 8));
+#else
+#if defined(__riscv_zvbc)
+    avx512_u64_t lo = __riscv_vclmul(x, y, 8);
+    avx512_u64_t hi = __riscv_vclmulh(x, y, 8);
+#else
+    /* Shift-xor over the 64 bits of x; y >> (64 - i) is split in two shifts
+     * so that i == 0 contributes nothing to the high half */
+    avx512_u64_t lo = _avx512_rvv(vmv_v_x_u64)(0, 8);
+    avx512_u64_t hi = _avx512_rvv(vmv_v_x_u64)(0, 8);
+    avx512_u64_t y_hi = __riscv_vsrl(y, 1, 8);
+    for (int i = 0; i < 64; i++) {
+        avx512_b64_t m = __riscv_vmsne(__riscv_vand(__riscv_vsrl(x, i, 8), 1, 8), 0, 8);
+        lo = __riscv_vxor_mu(m, lo, lo, __riscv_vsll(y, i, 8), 8);
+        hi = __riscv_vxor_mu(m, hi, hi, __riscv_vsrl(y_hi, 63 - i, 8), 8);
+    }
+#endif
+    avx512_b64_t odd = __riscv_vmsne(__riscv_vand(_avx512_rvv(vid_v_u64)(8), 1, 8), 0, 8);
+    return vreinterpret_m512i_u64(__riscv_vmerge(lo, hi, odd, 8));
+#endif
+}
+
+/* ===== VNNI ===== */
+/* The products are formed at twice the LMUL by a widening multiply. A
+ * narrowing shift of the doubled-width view by 0 or by the element width
+ * picks the even or the odd element of every pair, so adding the two folds
+ * pairs together: twice for the four u8*s8 products of a dword, once for
+ * the two s16*s16 products. Every intermediate sum is exact. */
+FORCE_INLINE avx512_i32_t _avx512_dpbusd(__m512i a, __m512i b) {
+    avx512_i32w_t p = _avx512_wide(vreinterpret_i32)(
+        __riscv_vwmulsu(vreinterpret_i8_m512i(b), vreinterpret_u8_m512i(a), 64));
+    avx512_i64w_t pair = _avx512_wide(vreinterpret_i64)(
+        __riscv_vwadd(__riscv_vnsra(p, 0, 32), __riscv_vnsra(p, 16, 32), 32));
+    return __riscv_vadd(__riscv_vnsra(pair, 0, 16), __riscv_vnsra(pair, 32, 16), 16);
+}
+
+FORCE_INLINE avx512_i64w_t _avx512_dpwssd(__m512i a, __m512i b) {
+    return _avx512_wide(vreinterpret_i64)(
+        __riscv_vwmul(vreinterpret_i16_m512i(a), vreinterpret_i16_m512i(b), 32));
+}
+
+FORCE_INLINE __m512i _mm512_dpbusd_epi32(__m512i src, __m512i a, __m512i b) {
+    return vreinterpret_m512i_i32(
+        __riscv_vadd(vreinterpret_i32_m512i(src), _avx512_dpbusd(a, b), 16));
+}
+
+/* The four products sum to at most 4 * 255 * 128, so only the final add
+ * can overflow */
+FORCE_INLINE __m512i _mm512_dpbusds_epi32(__m512i src, __m512i a, __m512i b) {
+    return vreinterpret_m512i_i32(
+        __riscv_vsadd(vreinterpret_i32_m512i(src), _avx512_dpbusd(a, b), 16));
+}
+
+FORCE_INLINE __m512i _mm512_dpwssd_epi32(__m512i src, __m512i a, __m512i b) {
+    avx512_i64w_t p = _avx512_dpwssd(a, b);
+    avx512_i32_t r = __riscv_vadd(vreinterpret_i32_m512i(src), __riscv_vnsra(p, 0, 16), 16);
+    return vreinterpret_m512i_i32(__riscv_vadd(r, __riscv_vnsra(p, 32, 16), 16));
+}
+
+/* Two products of -32768 * -32768 already sum to 2^31, so the saturating
+ * form adds in 64 bits and clips once */
+FORCE_INLINE __m512i _mm512_dpwssds_epi32(__m512i src, __m512i a, __m512i b) {
+    avx512_i64w_t p = _avx512_dpwssd(a, b);
+    avx512_i64w_t sum = __riscv_vwadd(__riscv_vnsra(p, 0, 16), __riscv_vnsra(p, 32, 16), 16);
+    sum = __riscv_vwadd_wv(sum, vreinterpret_i32_m512i(src), 16);
+    return vreinterpret_m512i_i32(__riscv_vnclip(sum, 0, __RISCV_VXRM_RDN, 16));
+}
+
+FORCE_INLINE avx256_i32_t _avx256_dpbusd(__m256i a, __m256i b) {
+    avx256_i32w_t p = _avx256_wide(vreinterpret_i32)(
+        __riscv_vwmulsu(vreinterpret_i8_m256i(b), vreinterpret_u8_m256i(a), 32));
+    avx256_i64w_t pair = _avx256_wide(vreinterpret_i64)(
+        __riscv_vwadd(__riscv_vnsra(p, 0, 16), __riscv_vnsra(p, 16, 16), 16));
+    return __riscv_vadd(__riscv_vnsra(pair, 0, 8), __riscv_vnsra(pair, 32, 8), 8);
+}
+
+FORCE_INLINE avx256_i64w_t _avx256_dpwssd(__m256i a, __m256i b) {
+    return _avx256_wide(vreinterpret_i64)(
+        __riscv_vwmul(vreinterpret_i16_m256i(a), vreinterpret_i16_m256i(b), 16));
+}
+
+FORCE_INLINE __m256i _mm256_dpbusd_epi32(__m256i src, __m256i a, __m256i b) {
+    return vreinterpret_m256i_i32(
+        __riscv_vadd(vreinterpret_i32_m256i(src), _avx256_dpbusd(a, b), 8));
+}
+
+FORCE_INLINE __m256i _mm256_dpbusds_epi32(__m256i src, __m256i a, __m256i b) {
+    return vreinterpret_m256i_i32(
+        __riscv_vsadd(vreinterpret_i32_m256i(src), _avx256_dpbusd(a, b), 8));
+}
+
+FORCE_INLINE __m256i _mm256_dpwssd_epi32(__m256i src, __m256i a, __m256i b) {
+    avx256_i64w_t p = _avx256_dpwssd(a, b);
+    avx256_i32_t r = __riscv_vadd(vreinterpret_i32_m256i(src), __riscv_vnsra(p, 0, 8), 8);
+    return vreinterpret_m256i_i32(__riscv_vadd(r, __riscv_vnsra(p, 32, 8), 8));
+}
+
+FORCE_INLINE __m256i _mm256_dpwssds_epi32(__m256i src, __m256i a, __m256i b) {
+    avx256_i64w_t p = _avx256_dpwssd(a, b);
+    avx256_i64w_t sum = __riscv_vwadd(__riscv_vnsra(p, 0, 8), __riscv_vnsra(p, 32, 8), 8);
+    sum = __riscv_vwadd_wv(sum, vreinterpret_i32_m256i(src), 8);
+    return vreinterpret_m256i_i32(__riscv_vnclip(sum, 0, __RISCV_VXRM_RDN, 8));
+}
+
+/* AVX-VNNI: the same operations under VEX encoding */
+FORCE_INLINE __m256i _mm256_dpbusd_avx_epi32(__m256i src, __m256i a, __m256i b) {
+    return _mm256_dpbusd_epi32(src, a, b);
+}
+
+FORCE_INLINE __m256i _mm256_dpbusds_avx_epi32(__m256i src, __m256i a, __m256i b) {
+    return _mm256_dpbusds_epi32(src, a, b);
+}
+
+FORCE_INLINE __m256i _mm256_dpwssd_avx_epi32(__m256i src, __m256i a, __m256i b) {
+    return _mm256_dpwssd_epi32(src, a, b);
+}
+
+FORCE_INLINE __m256i _mm256_dpwssds_avx_epi32(__m256i src, __m256i a, __m256i b) {
+    return _mm256_dpwssds_epi32(src, a, b);
+}
+
+/* ===== BF16 ===== */
+/* Sixteen bf16 values, the narrowed form of a __m512, sit one LMUL step
+ * below AVX512_LMUL. That is the __m256bh layout except from VLEN=512 on,
+ * where a __m256bh is a whole register and the narrowed value its low
+ * half. */
+#if AVX2RVV_VLEN >= 512
+#define AVX512_HALF mf2
+#define _avx512_half_m256bh(x) __riscv_vlmul_ext_u16m1(x)
+#define _avx512_m256bh_half(x) __riscv_vlmul_trunc_u16mf2(x)
+#else
+#define AVX512_HALF AVX256_LMUL
+#define _avx512_half_m256bh(x) (x)
+#define _avx512_m256bh_half(x) (x)
+#endif
+typedef AVX2RVV_CAT(AVX2RVV_CAT(vuint16, AVX512_HALF), _t) avx512_u16h_t;
+
+/* Round to nearest even, flushing denormal inputs to a signed zero and
+ * quieting NaNs with their payload kept, as x86 does regardless of MXCSR.
+ * Zvfbfmin narrows in one instruction but returns the canonical NaN. */
+FORCE_INLINE avx512_u16h_t _avx512_cvtneps_bf16(__m512 a) {
+    avx512_u32_t x = vreinterpret_u32_m512(a);
+    avx512_u32_t mag = __riscv_vand(x, 0x7fffffff, 16);
+    x = __riscv_vand_mu(__riscv_vmsltu(mag, 0x00800000, 16), x, x, 0x80000000, 16);
+#if defined(__riscv_zvfbfmin)
+    return AVX2RVV_CAT(__riscv_vreinterpret_u16, AVX512_HALF)(
+        AVX2RVV_CAT(AVX2RVV_CAT(__riscv_vfncvtbf16_f_f_w_bf16, AVX512_HALF), _rm)(
+            vreinterpret_m512_u32(x), __RISCV_FRM_RNE, 16));
+#else
+    avx512_u32_t bias = __riscv_vadd(__riscv_vand(__riscv_vsrl(x, 16, 16), 1, 16), 0x7fff, 16);
+    avx512_u16h_t r = __riscv_vnsrl(__riscv_vadd(x, bias, 16), 16, 16);
+    avx512_u16h_t nan = __riscv_vor(__riscv_vnsrl(x, 16, 16), 0x40, 16);
+    return __riscv_vmerge(r, nan, __riscv_vmsgtu(mag, 0x7f800000, 16), 16);
+#endif
+}
+
+FORCE_INLINE __m256bh _mm512_cvtneps_pbh(__m512 a) {
+    return _avx512_half_m256bh(_avx512_cvtneps_bf16(a));
+}
+
+/* b fills the low 16 elements and a the high 16 */
+FORCE_INLINE __m512bh _mm512_cvtne2ps_pbh(__m512 a, __m512 b) {
+    avx512_u16_t lo = AVX2RVV_CAT(__riscv_vlmul_ext_u16, AVX512_LMUL)(_avx512_cvtneps_bf16(b));
+    avx512_u16_t hi = AVX2RVV_CAT(__riscv_vlmul_ext_u16, AVX512_LMUL)(_avx512_cvtneps_bf16(a));
+    return __riscv_vslideup(lo, hi, 16, 32);
+}
+
+FORCE_INLINE __m512 _mm512_cvtpbh_ps(__m256bh a) {
+    avx512_u32_t x = __riscv_vzext_vf2(_avx512_m256bh_half(a), 16);
+    return vreinterpret_m512_u32(__riscv_vsll(x, 16, 16));
+}
+
+/* A bf16 value widens to fp32 by a 16-bit shift, and each 32-bit lane holds
+ * an (even, odd) pair, so masking or shifting the lane gives the odd or the
+ * even element already widened. That is cheaper than splitting the pairs
+ * for Zvfbfwma's vfwmaccbf16. The products are exact in fp32, and the two
+ * fused multiply-adds accumulate in the x86 order: odd element first, with
+ * x86's fixed round-to-nearest. Unlike x86, denormals are not flushed to
+ * zero. */
+FORCE_INLINE __m512 _mm512_dpbf16_ps(__m512 src, __m512bh a, __m512bh b) {
+    avx512_u32_t va = AVX2RVV_CAT(__riscv_vreinterpret_u32, AVX512_LMUL)(a);
+    avx512_u32_t vb = AVX2RVV_CAT(__riscv_vreinterpret_u32, AVX512_LMUL)(b);
+    __m512 a_odd = vreinterpret_m512_u32(__riscv_vand(va, 0xffff0000, 16));
+    __m512 b_odd = vreinterpret_m512_u32(__riscv_vand(vb, 0xffff0000, 16));
+    __m512 a_even = vreinterpret_m512_u32(__riscv_vsll(va, 16, 16));
+    __m512 b_even = vreinterpret_m512_u32(__riscv_vsll(vb, 16, 16));
+    __m512 r = AVX2RVV_CAT(_avx512_rvv(vfmacc_vv_f32), _rm)(src, a_odd, b_odd, __RISCV_FRM_RNE, 16);
+    return AVX2RVV_CAT(_avx512_rvv(vfmacc_vv_f32), _rm)(r, a_even, b_even, __RISCV_FRM_RNE, 16);
+}
+
+FORCE_INLINE __m512 _mm512_mask_dpbf16_ps(__m512 src, __mmask16 k, __m512bh a, __m512bh b) {
+    return __riscv_vmerge(src, _mm512_dpbf16_ps(src, a, b), _avx512_mask_to_b32(k), 16);
+}
+
+FORCE_INLINE __m512 _mm512_maskz_dpbf16_ps(__mmask16 k, __m512 src, __m512bh a, __m512bh b) {
+    return __riscv_vmerge(_mm512_setzero_ps(), _mm512_dpbf16_ps(src, a, b), _avx512_mask_to_b32(k), 16);
+}
+
+/* ===== IFMA52 ===== */
+/* The 104-bit product of the low 52 bits of b and c is split by vmul (bits
+ * 63:0) and vmulhu (bits 127:64). The low form keeps bits 51:0 and the high
+ * form reassembles bits 103:52, and both add into a modulo 2^64. A 64-bit
+ * vmulhu needs the full V extension; Zve64* leaves it out. */
+#define AVX2RVV_MASK52 0x000fffffffffffffull
+
+FORCE_INLINE avx512_u64_t _avx512_madd52(__m512i a, __m512i b, __m512i c, bool high) {
+    avx512_u64_t vb = __riscv_vand(vreinterpret_u64_m512i(b), AVX2RVV_MASK52, 8);
+    avx512_u64_t vc = __riscv_vand(vreinterpret_u64_m512i(c), AVX2RVV_MASK52, 8);
+    avx512_u64_t lo = __riscv_vmul(vb, vc, 8);
+    avx512_u64_t p;
+    if (high) {
+        p = __riscv_vor(__riscv_vsrl(lo, 52, 8), __riscv_vsll(__riscv_vmulhu(vb, vc, 8), 12, 8), 8);
+    } else {
+        p = __riscv_vand(lo, AVX2RVV_MASK52, 8);
+    }
+    return __riscv_vadd(vreinterpret_u64_m512i(a), p, 8);
+}
+
+FORCE_INLINE __m512i _mm512_madd52lo_epu64(__m512i a, __m512i b, __m512i c) {
+    return vreinterpret_m512i_u64(_avx512_madd52(a, b, c, false));
+}
+
+FORCE_INLINE __m512i _mm512_madd52hi_epu64(__m512i a, __m512i b, __m512i c) {
+    return vreinterpret_m512i_u64(_avx512_madd52(a, b, c, true));
+}
+
+FORCE_INLINE __m512i _mm512_mask_madd52lo_epu64(__m512i a, __mmask8 k, __m512i b, __m512i c) {
+    return __riscv_vmerge(a, _mm512_madd52lo_epu64(a, b, c), _avx512_mask_to_b64(k), 8);
+}
+
+FORCE_INLINE __m512i _mm512_mask_madd52hi_epu64(__m512i a, __mmask8 k, __m512i b, __m512i c) {
+    return __riscv_vmerge(a, _mm512_madd52hi_epu64(a, b, c), _avx512_mask_to_b64(k), 8);
+}
+
+FORCE_INLINE __m512i _mm512_maskz_madd52lo_epu64(__mmask8 k, __m512i a, __m512i b, __m512i c) {
+    return __riscv_vmerge(_mm512_setzero_si512(), _mm512_madd52lo_epu64(a, b, c), _avx512_mask_to_b64(k), 8);
+}
+
+FORCE_INLINE __m512i _mm512_maskz_madd52hi_epu64(__mmask8 k, __m512i a, __m512i b, __m512i c) {
+    return __riscv_vmerge(_mm512_setzero_si512(), _mm512_madd52hi_epu64(a, b, c), _avx512_mask_to_b64(k), 8);
+}
+
+FORCE_INLINE avx256_u64_t _avx256_madd52(__m256i a, __m256i b, __m256i c, bool high) {
+    avx256_u64_t vb = __riscv_vand(vreinterpret_u64_m256i(b), AVX2RVV_MASK52, 4);
+    avx256_u64_t vc = __riscv_vand(vreinterpret_u64_m256i(c), AVX2RVV_MASK52, 4);
+    avx256_u64_t lo = __riscv_vmul(vb, vc, 4);
+    avx256_u64_t p;
+    if (high) {
+        p = __riscv_vor(__riscv_vsrl(lo, 52, 4), __riscv_vsll(__riscv_vmulhu(vb, vc, 4), 12, 4), 4);
+    } else {
+        p = __riscv_vand(lo, AVX2RVV_MASK52, 4);
+    }
+    return __riscv_vadd(vreinterpret_u64_m256i(a), p, 4);
+}
+
+FORCE_INLINE __m256i _mm256_madd52lo_epu64(__m256i a, __m256i b, __m256i c) {
+    return vreinterpret_m256i_u64(_avx256_madd52(a, b, c, false));
+}
+
+FORCE_INLINE __m256i _mm256_madd52hi_epu64(__m256i a, __m256i b, __m256i c) {
+    return vreinterpret_m256i_u64(_avx256_madd52(a, b, c, true));
+}
+
+/* AVX-IFMA: the same operations under VEX encoding */
+FORCE_INLINE __m256i _mm256_madd52lo_avx_epu64(__m256i a, __m256i b, __m256i c) {
+    return _mm256_madd52lo_epu64(a, b, c);
+}
+
+FORCE_INLINE __m256i _mm256_madd52hi_avx_epu64(__m256i a, __m256i b, __m256i c) {
+    return _mm256_madd52hi_epu64(a, b, c);
+}
+
+/* ===== Bit manipulation ===== */
+/* VPOPCNT, VPLZCNT and VPROL/VPROR are single Zvbb instructions (vcpop.v,
+ * vclz.v, vrol/vror). Without Zvbb they fall back to base V sequences:
+ * a SWAR count per byte, a float conversion for the leading-zero count and a
+ * pair of shifts for the rotates. */
+#if defined(__riscv_zvbb)
+#define _avx512_rol_vx(x, n, vl) __riscv_vrol(x, n, vl)
+#define _avx512_ror_vx(x, n, vl) __riscv_vror(x, n, vl)
+#define _avx512_rol_vv(x, n, vl) __riscv_vrol(x, n, vl)
+#define _avx512_ror_vv(x, n, vl) __riscv_vror(x, n, vl)
+#else
+/* Shifts only read the low log2(SEW) bits of the count, so shifting right by
+ * -n is shifting by SEW - n and a rotate by 0 ORs x with itself. */
+#define _avx512_rol_vx(x, n, vl)                                              \
+    __riscv_vor(__riscv_vsll(x, n, vl), __riscv_vsrl(x, -(size_t)(n), vl), vl)
+#define _avx512_ror_vx(x, n, vl)                                              \
+    __riscv_vor(__riscv_vsrl(x, n, vl), __riscv_vsll(x, -(size_t)(n), vl), vl)
+#define _avx512_rol_vv(x, n, vl)                                              \
+    __riscv_vor(__riscv_vsll(x, n, vl), __riscv_vsrl(x, __riscv_vrsub(n, 0, vl), vl), vl)
+#define _avx512_ror_vv(x, n, vl)                                              \
+    __riscv_vor(__riscv_vsrl(x, n, vl), __riscv_vsll(x, __riscv_vrsub(n, 0, vl), vl), vl)
+
+/* Bit count of every byte; the wider forms multiply by 0x01..01, which sums
+ * the byte counts into the top byte of the element. */
+FORCE_INLINE avx512_u8_t _avx512_popcnt_u8(avx512_u8_t x) {
+    x = __riscv_vsub(x, __riscv_vand(__riscv_vsrl(x, 1, 64), 0x55, 64), 64);
+    x = __riscv_vadd(__riscv_vand(x, 0x33, 64), __riscv_vand(__riscv_vsrl(x, 2, 64), 0x33, 64), 64);
+    return __riscv_vand(__riscv_vadd(x, __riscv_vsrl(x, 4, 64), 64), 0x0f, 64);
+}
+#endif
+
+FORCE_INLINE __m512i _mm512_popcnt_epi8(__m512i a) {
+#if defined(__riscv_zvbb)
+    return vreinterpret_m512i_u8(__riscv_vcpop(vreinterpret_u8_m512i(a), 64));
+#else
+    return vreinterpret_m512i_u8(_avx512_popcnt_u8(vreinterpret_u8_m512i(a)));
+#endif
+}
+
+FORCE_INLINE __m512i _mm512_popcnt_epi16(__m512i a) {
+#if defined(__riscv_zvbb)
+    return vreinterpret_m512i_u16(__riscv_vcpop(vreinterpret_u16_m512i(a), 32));
+#else
+    avx512_u8_t c = _avx512_popcnt_u8(vreinterpret_u8_m512i(a));
+    avx512_u16_t w = vreinterpret_u16_m512i(vreinterpret_m512i_u8(c));
+    return vreinterpret_m512i_u16(__riscv_vsrl(__riscv_vmul(w, 0x0101, 32), 8, 32));
+#endif
+}
+
+FORCE_INLINE __m512i _mm512_popcnt_epi32(__m512i a) {
+#if defined(__riscv_zvbb)
+    return vreinterpret_m512i_u32(__riscv_vcpop(vreinterpret_u32_m512i(a), 16));
+#else
+    avx512_u8_t c = _avx512_popcnt_u8(vreinterpret_u8_m512i(a));
+    avx512_u32_t w = vreinterpret_u32_m512i(vreinterpret_m512i_u8(c));
+    return vreinterpret_m512i_u32(__riscv_vsrl(__riscv_vmul(w, 0x01010101, 16), 24, 16));
+#endif
+}
+
+FORCE_INLINE __m512i _mm512_popcnt_epi64(__m512i a) {
+#if defined(__riscv_zvbb)
+    return vreinterpret_m512i_u64(__riscv_vcpop(vreinterpret_u64_m512i(a), 8));
+#else
+    avx512_u8_t c = _avx512_popcnt_u8(vreinterpret_u8_m512i(a));
+    avx512_u64_t w = vreinterpret_u64_m512i(vreinterpret_m512i_u8(c));
+    return vreinterpret_m512i_u64(__riscv_vsrl(__riscv_vmul(w, 0x0101010101010101ull, 8), 56, 8));
+#endif
+}
+
+/* Without Zvbb the count comes from the exponent of the value converted
+ * toward zero, which never rounds up into the next power of two. Zero
+ * converts to +0.0 and is clamped to the element width. */
+FORCE_INLINE __m512i _mm512_lzcnt_epi32(__m512i a) {
+    avx512_u32_t x = vreinterpret_u32_m512i(a);
+#if defined(__riscv_zvbb)
+    return vreinterpret_m512i_u32(__riscv_vclz(x, 16));
+#else
+    __m512 f = __riscv_vfcvt_f_rm(x, __RISCV_FRM_RTZ, 16);
+    avx512_u32_t e = __riscv_vsrl(vreinterpret_u32_m512(f), 23, 16);
+    return vreinterpret_m512i_u32(__riscv_vminu(__riscv_vrsub(e, 158, 16), 32, 16));
+#endif
+}
+
+FORCE_INLINE __m512i _mm512_lzcnt_epi64(__m512i a) {
+    avx512_u64_t x = vreinterpret_u64_m512i(a);
+#if defined(__riscv_zvbb)
+    return vreinterpret_m512i_u64(__riscv_vclz(x, 8));
+#else
+    __m512d f = __riscv_vfcvt_f_rm(x, __RISCV_FRM_RTZ, 8);
+    avx512_u64_t e = __riscv_vsrl(vreinterpret_u64_m512d(f), 52, 8);
+    return vreinterpret_m512i_u64(__riscv_vminu(__riscv_vrsub(e, 1086, 8), 64, 8));
+#endif
+}
+
+FORCE_INLINE __m512i _mm512_rol_epi32(__m512i a, const int imm8) {
+    return vreinterpret_m512i_u32(_avx512_rol_vx(vreinterpret_u32_m512i(a), imm8 & 31, 16));
+}
+
+FORCE_INLINE __m512i _mm512_rol_epi64(__m512i a, const int imm8) {
+    return vreinterpret_m512i_u64(_avx512_rol_vx(vreinterpret_u64_m512i(a), imm8 & 63, 8));
+}
+
+FORCE_INLINE __m512i _mm512_ror_epi32(__m512i a, const int imm8) {
+    return vreinterpret_m512i_u32(_avx512_ror_vx(vreinterpret_u32_m512i(a), imm8 & 31, 16));
+}
+
+FORCE_INLINE __m512i _mm512_ror_epi64(__m512i a, const int imm8) {
+    return vreinterpret_m512i_u64(_avx512_ror_vx(vreinterpret_u64_m512i(a), imm8 & 63, 8));
+}
+
+FORCE_INLINE __m512i _mm512_rolv_epi32(__m512i a, __m512i b) {
+    return vreinterpret_m512i_u32(_avx512_rol_vv(vreinterpret_u32_m512i(a), vreinterpret_u32_m512i(b), 16));
+}
+
+FORCE_INLINE __m512i _mm512_rolv_epi64(__m512i a, __m512i b) {
+    return vreinterpret_m512i_u64(_avx512_rol_vv(vreinterpret_u64_m512i(a), vreinterpret_u64_m512i(b), 8));
+}
+
+FORCE_INLINE __m512i _mm512_rorv_epi32(__m512i a, __m512i b) {
+    return vreinterpret_m512i_u32(_avx512_ror_vv(vreinterpret_u32_m512i(a), vreinterpret_u32_m512i(b), 16));
+}
+
+FORCE_INLINE __m512i _mm512_rorv_epi64(__m512i a, __m512i b) {
+    return vreinterpret_m512i_u64(_avx512_ror_vv(vreinterpret_u64_m512i(a), vreinterpret_u64_m512i(b), 8));
+}
+
+/* Byte j of c selects bit c[j] & 63 of qword j / 8 of b: gather the byte that
+ * holds it (bits 5:3 pick the byte within the qword) and shift it down, the
+ * shift itself reading only bits 2:0. */
+FORCE_INLINE __mmask64 _mm512_bitshuffle_epi64_mask(__m512i b, __m512i c) {
+    avx512_u8_t ctrl = vreinterpret_u8_m512i(c);
+    avx512_u8_t qword = __riscv_vand(_avx512_rvv(vid_v_u8)(64), 0xf8, 64);
+    avx512_u8_t idx = __riscv_vadd(qword, __riscv_vand(__riscv_vsrl(ctrl, 3, 64), 7, 64), 64);
+    avx512_u8_t byte = __riscv_vrgather(vreinterpret_u8_m512i(b), idx, 64);
+    avx512_u8_t bit = __riscv_vand(__riscv_vsrl(byte, ctrl, 64), 1, 64);
+    return _avx512_b8_to_mask(__riscv_vmsne(bit, 0, 64));
+}
+
+/* ===== Conflict detection ===== */
+/* Lane i of the result has bit j set for every j < i with a[j] == a[i].
+ * Sliding a up by d lines a[i - d] up against a[i], so n - 1 compares cover
+ * every pair without sorting. The bit to set, 1 << (i - d), is kept per lane
+ * and halved each step; it is already zero in the lanes i < d that the slide
+ * left without an earlier element. */
+FORCE_INLINE __m512i _mm512_conflict_epi32(__m512i a) {
+    avx512_u32_t va = vreinterpret_u32_m512i(a);
+    avx512_u32_t bit = __riscv_vsll(_avx512_rvv(vmv_v_x_u32)(1, 16), _avx512_rvv(vid_v_u32)(16), 16);
+    avx512_u32_t r = _avx512_rvv(vmv_v_x_u32)(0, 16);
+    for (size_t d = 1; d < 16; d++) {
+        avx512_b32_t eq = __riscv_vmseq(va, __riscv_vslideup(va, va, d, 16), 16);
+        bit = __riscv_vsrl(bit, 1, 16);
+        r = __riscv_vor_mu(eq, r, r, bit, 16);
+    }
+    return vreinterpret_m512i_u32(r);
+}
+
+FORCE_INLINE __m512i _mm512_conflict_epi64(__m512i a) {
+    avx512_u64_t va = vreinterpret_u64_m512i(a);
+    avx512_u64_t bit = __riscv_vsll(_avx512_rvv(vmv_v_x_u64)(1, 8), _avx512_rvv(vid_v_u64)(8), 8);
+    avx512_u64_t r = _avx512_rvv(vmv_v_x_u64)(0, 8);
+    for (size_t d = 1; d < 8; d++) {
+        avx512_b64_t eq = __riscv_vmseq(va, __riscv_vslideup(va, va, d, 8), 8);
+        bit = __riscv_vsrl(bit, 1, 8);
+        r = __riscv_vor_mu(eq, r, r, bit, 8);
+    }
+    return vreinterpret_m512i_u64(r);
+}
+
+FORCE_INLINE __m512i _mm512_mask_conflict_epi32(__m512i src, __mmask16 k, __m512i a) {
+    avx512_u32_t r = vreinterpret_u32_m512i(_mm512_conflict_epi32(a));
+    return vreinterpret_m512i_u32(__riscv_vmerge(vreinterpret_u32_m512i(src), r, _avx512_mask_to_b32(k), 16));
+}
+
+FORCE_INLINE __m512i _mm512_mask_conflict_epi64(__m512i src, __mmask8 k, __m512i a) {
+    return __riscv_vmerge(src, _mm512_conflict_epi64(a), _avx512_mask_to_b64(k), 8);
+}
+
+FORCE_INLINE __m512i _mm512_maskz_conflict_epi32(__mmask16 k, __m512i a) {
+    return _mm512_mask_conflict_epi32(_mm512_setzero_si512(), k, a);
+}
+
+FORCE_INLINE __m512i _mm512_maskz_conflict_epi64(__mmask8 k, __m512i a) {
+    return _mm512_mask_conflict_epi64(_mm512_setzero_si512(), k, a);
+}
+#endif
@@ -72,6 +72,10 @@
 #include <riscv_vector.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
+#if defined(__riscv_zbb) || defined(__riscv_zbc)
+#include <riscv_bitmanip.h>
+#endif
 
 /* A few intrinsics accept traditional data types like ints or floats, but
  * most operate on data types that are specific to SSE.
@@ -308,6 +312,24 @@ typedef struct {
 #define _MM_ROUND_UP 0x4000
 #define _MM_ROUND_TOWARD_ZERO 0x6000
 
+/* String compare mode macros. */
+#define _SIDD_UBYTE_OPS 0x00
+#define _SIDD_UWORD_OPS 0x01
+#define _SIDD_SBYTE_OPS 0x02
+#define _SIDD_SWORD_OPS 0x03
+#define _SIDD_CMP_EQUAL_ANY 0x00
+#define _SIDD_CMP_RANGES 0x04
+#define _SIDD_CMP_EQUAL_EACH 0x08
+#define _SIDD_CMP_EQUAL_ORDERED 0x0C
+#define _SIDD_POSITIVE_POLARITY 0x00
+#define _SIDD_NEGATIVE_POLARITY 0x10
+#define _SIDD_MASKED_POSITIVE_POLARITY 0x20
+#define _SIDD_MASKED_NEGATIVE_POLARITY 0x30
+#define _SIDD_LEAST_SIGNIFICANT 0x00
+#define _SIDD_MOST_SIGNIFICANT 0x40
+#define _SIDD_BIT_MASK 0x00
+#define _SIDD_UNIT_MASK 0x40
+
 // forward declaration
 FORCE_INLINE int _mm_extract_pi16(__m64 a, int imm8);
 FORCE_INLINE __m64 _mm_sad_pu8(__m64 a, __m64 b);
@@ -750,26 +772,265 @@ FORCE_INLINE __m128 _mm_cmpeq_ss(__m128 a, __m128 b) {
       __riscv_vreinterpret_v_f32m1_i32m1(_a), cmp_res_i32, 0, 1));
 }
 
-// FORCE_INLINE int _mm_cmpestra (__m128i a, int la, __m128i b, int lb, const
-// int imm8) {}
-
-// FORCE_INLINE int _mm_cmpestrc (__m128i a, int la, __m128i b, int lb, const
-// int imm8) {}
-
-// FORCE_INLINE int _mm_cmpestri (__m128i a, int la, __m128i b, int lb, const
-// int imm8) {}
-
-// FORCE_INLINE __m128i _mm_cmpestrm (__m128i a, int la, __m128i b, int lb,
-// const int imm8) {}
-
-// FORCE_INLINE int _mm_cmpestro (__m128i a, int la, __m128i b, int lb, const
-// int imm8) {}
-
-// FORCE_INLINE int _mm_cmpestrs (__m128i a, int la, __m128i b, int lb, const
-// int imm8) {}
-
-// FORCE_INLINE int _mm_cmpestrz (__m128i a, int la, __m128i b, int lb, const
-// int imm8) {}
+// The string comparisons run both element sizes in e16m2 with vl = 16 or 8:
+// bytes are widened (sign- or zero-extended as imm8 says) and words are used
+// as they are. imm8 is a constant at every call site and these helpers are
+// always inlined, so the branches on it fold away and each call keeps only
+// the compares and reductions of its own mode.
+#define _sse2rvv_sidd_n(imm8) ((imm8) & _SIDD_UWORD_OPS ? 8 : 16)
+
+FORCE_INLINE vuint16m2_t _sse2rvv_sidd_load(__m128i a, const int imm8) {
+  if (imm8 & _SIDD_UWORD_OPS)
+    return __riscv_vlmul_ext_v_u16m1_u16m2(vreinterpretq_m128i_u16(a));
+  if (imm8 & _SIDD_SBYTE_OPS)
+    return __riscv_vreinterpret_v_i16m2_u16m2(
+        __riscv_vsext_vf2_i16m2(vreinterpretq_m128i_i8(a), 16));
+  return __riscv_vzext_vf2_u16m2(vreinterpretq_m128i_u8(a), 16);
+}
+
+// Length of an explicit string: |l| saturated to the element count. The
+// saturation comes first so that INT_MIN is never negated.
+FORCE_INLINE int _sse2rvv_sidd_len(int l, int n) {
+  return (l <= -n || l >= n) ? n : (l < 0 ? -l : l);
+}
+
+// Length of an implicit string: the index of its first null element.
+FORCE_INLINE int _sse2rvv_sidd_strlen(vuint16m2_t a, int n) {
+  long len = __riscv_vfirst_m_b8(__riscv_vmseq_vx_u16m2_b8(a, 0, n), n);
+  return len < 0 ? n : (int)len;
+}
+
+// The n x n compare matrix as one n-bit row per element of a: bit j of row i
+// is set when b[j] == a[i] or, for ranges, when b[j] >= a[i] on even rows and
+// b[j] <= a[i] on odd rows. The pairs are compared 64 at a time in e16m8,
+// with a repeated along each row and b along each column, and every compare
+// mask is read back as n-bit row fields: bytes take four blocks, words one.
+FORCE_INLINE vuint16m2_t _sse2rvv_sidd_matrix(vuint16m2_t a, vuint16m2_t b,
+                                              const int imm8) {
+  const int n = _sse2rvv_sidd_n(imm8);
+  vuint16m8_t id = __riscv_vid_v_u16m8(64);
+  vuint16m8_t row = __riscv_vsrl_vx_u16m8(id, n == 16 ? 4 : 3, 64);
+  vuint16m8_t bt =
+      __riscv_vrgather_vv_u16m8(__riscv_vlmul_ext_v_u16m2_u16m8(b),
+                                __riscv_vand_vx_u16m8(id, n - 1, 64), 64);
+  vbool2_t odd = __riscv_vmsne_vx_u16m8_b2(
+      __riscv_vand_vx_u16m8(row, 1, 64), 0, 64);
+  vuint16m2_t rows = __riscv_vmv_v_x_u16m2(0, n);
+  for (int c = 0; c < n * n / 64; c++) {
+    vuint16m8_t at = __riscv_vrgather_vv_u16m8(
+        __riscv_vlmul_ext_v_u16m2_u16m8(a),
+        __riscv_vadd_vx_u16m8(row, c * 64 / n, 64), 64);
+    vbool2_t m;
+    if ((imm8 & 0x0c) == _SIDD_CMP_RANGES) {
+      // b >= a everywhere, then b <= a over it on the odd rows
+      if (imm8 & _SIDD_SBYTE_OPS) {
+        vint16m8_t _a = __riscv_vreinterpret_v_u16m8_i16m8(at);
+        vint16m8_t _b = __riscv_vreinterpret_v_u16m8_i16m8(bt);
+        m = __riscv_vmsle_vv_i16m8_b2_mu(
+            odd, __riscv_vmsge_vv_i16m8_b2(_b, _a, 64), _b, _a, 64);
+      } else {
+        m = __riscv_vmsleu_vv_u16m8_b2_mu(
+            odd, __riscv_vmsgeu_vv_u16m8_b2(bt, at, 64), bt, at, 64);
+      }
+    } else {
+      m = __riscv_vmseq_vv_u16m8_b2(at, bt, 64);
+    }
+    vuint8m1_t bits = __riscv_vreinterpret_v_b2_u8m1(m);
+    if (n == 16)
+      rows = __riscv_vslideup_vx_u16m2_tu(
+          rows,
+          __riscv_vlmul_ext_v_u16m1_u16m2(
+              __riscv_vreinterpret_v_u8m1_u16m1(bits)),
+          4 * c, 4 * c + 4);
+    else
+      rows = __riscv_vzext_vf2_u16m2(bits, 8);
+  }
+  return rows;
+}
+
+// IntRes2: the aggregation of imm8[3:2] over elements of a and b, followed by
+// the polarity of imm8[5:4], as one mask bit per element of b. Apart from
+// equal-each, every mode reduces the rows of the compare matrix, with the
+// rows past la masked off, so no step depends on the string lengths.
+FORCE_INLINE vbool8_t _sse2rvv_sidd_cmp(vuint16m2_t a, int la, vuint16m2_t b,
+                                        int lb, const int imm8) {
+  const int n = _sse2rvv_sidd_n(imm8);
+  vuint16m2_t id = __riscv_vid_v_u16m2(n);
+  vbool8_t b_valid = __riscv_vmsltu_vx_u16m2_b8(id, lb, n);
+  vbool8_t res;
+  if ((imm8 & 0x0c) == _SIDD_CMP_EQUAL_EACH) {
+    // equal where both are valid, true where both have ended
+    vbool8_t a_valid = __riscv_vmsltu_vx_u16m2_b8(id, la, n);
+    res = __riscv_vmand_mm_b8(__riscv_vmseq_vv_u16m2_b8(a, b, n),
+                              __riscv_vmand_mm_b8(a_valid, b_valid, n), n);
+    res = __riscv_vmor_mm_b8(res, __riscv_vmnor_mm_b8(a_valid, b_valid, n),
+                             n);
+  } else {
+    const uint16_t all = (uint16_t)((1u << n) - 1);
+    const uint16_t b_bits = (uint16_t)((1u << lb) - 1);
+    vuint16m2_t rows = _sse2rvv_sidd_matrix(a, b, imm8);
+    vbool8_t a_valid = __riscv_vmsltu_vx_u16m2_b8(id, la, n);
+    vuint16m1_t zero = __riscv_vmv_s_x_u16m1(0, 1);
+    uint16_t bits;
+    switch (imm8 & 0x0c) {
+    case _SIDD_CMP_EQUAL_ANY:
+      bits = b_bits & __riscv_vmv_x_s_u16m1_u16(__riscv_vredor_vs_u16m2_u16m1_m(
+                          a_valid, rows, zero, n));
+      break;
+    case _SIDD_CMP_RANGES: {
+      // a holds inclusive [lo, hi] pairs; an odd trailing element is ignored
+      vuint16m2_t pair = __riscv_vand_vv_u16m2(
+          rows, __riscv_vslidedown_vx_u16m2(rows, 1, n), n);
+      vbool8_t lo = __riscv_vmand_mm_b8(
+          __riscv_vmseq_vx_u16m2_b8(__riscv_vand_vx_u16m2(id, 1, n), 0, n),
+          __riscv_vmsltu_vx_u16m2_b8(__riscv_vadd_vx_u16m2(id, 1, n), la, n),
+          n);
+      bits = b_bits & __riscv_vmv_x_s_u16m1_u16(
+                          __riscv_vredor_vs_u16m2_u16m1_m(lo, pair, zero, n));
+      break;
+    }
+    default: { // _SIDD_CMP_EQUAL_ORDERED
+      // a matches at j when row i has bit j + i set for every i < la, with b
+      // cleared from lb on and padded with ones past the end of the vector
+      vuint16m2_t pad = __riscv_vand_vx_u16m2(
+          __riscv_vnot_v_u16m2(
+              __riscv_vsrl_vv_u16m2(__riscv_vmv_v_x_u16m2(all, n), id, n), n),
+          all, n);
+      rows = __riscv_vor_vv_u16m2(
+          __riscv_vsrl_vv_u16m2(__riscv_vand_vx_u16m2(rows, b_bits, n), id, n),
+          pad, n);
+      bits = __riscv_vmv_x_s_u16m1_u16(__riscv_vredand_vs_u16m2_u16m1_m(
+          a_valid, rows, __riscv_vmv_s_x_u16m1(all, 1), n));
+      break;
+    }
+    }
+    res = __riscv_vreinterpret_v_u8m1_b8(__riscv_vreinterpret_v_u16m1_u8m1(
+        __riscv_vmv_s_x_u16m1(bits, 1)));
+  }
+  if ((imm8 & 0x30) == _SIDD_NEGATIVE_POLARITY)
+    res = __riscv_vmnot_m_b8(res, n);
+  else if ((imm8 & 0x30) == _SIDD_MASKED_NEGATIVE_POLARITY)
+    res = __riscv_vmxor_mm_b8(res, b_valid, n);
+  return res;
+}
+
+FORCE_INLINE vbool8_t _sse2rvv_sidd_cmpestr(__m128i a, int la, __m128i b,
+                                            int lb, const int imm8) {
+  const int n = _sse2rvv_sidd_n(imm8);
+  return _sse2rvv_sidd_cmp(_sse2rvv_sidd_load(a, imm8),
+                           _sse2rvv_sidd_len(la, n),
+                           _sse2rvv_sidd_load(b, imm8),
+                           _sse2rvv_sidd_len(lb, n), imm8);
+}
+
+FORCE_INLINE vbool8_t _sse2rvv_sidd_cmpistr(__m128i a, __m128i b,
+                                            const int imm8) {
+  const int n = _sse2rvv_sidd_n(imm8);
+  vuint16m2_t _a = _sse2rvv_sidd_load(a, imm8);
+  vuint16m2_t _b = _sse2rvv_sidd_load(b, imm8);
+  return _sse2rvv_sidd_cmp(_a, _sse2rvv_sidd_strlen(_a, n), _b,
+                           _sse2rvv_sidd_strlen(_b, n), imm8);
+}
+
+// The index of the least or most significant bit of IntRes2, or the element
+// count when it is empty.
+FORCE_INLINE int _sse2rvv_sidd_index(vbool8_t res, const int imm8) {
+  const int n = _sse2rvv_sidd_n(imm8);
+  if (imm8 & _SIDD_MOST_SIGNIFICANT) {
+    // reduce over id + 1 so that an empty mask gives 0
+    vuint16m2_t pos = __riscv_vadd_vx_u16m2(__riscv_vid_v_u16m2(n), 1, n);
+    uint16_t last = __riscv_vmv_x_s_u16m1_u16(__riscv_vredmaxu_vs_u16m2_u16m1_m(
+        res, pos, __riscv_vmv_s_x_u16m1(0, 1), n));
+    return last ? last - 1 : n;
+  }
+  long first = __riscv_vfirst_m_b8(res, n);
+  return first < 0 ? n : (int)first;
+}
+
+// IntRes2 as a bit mask in the low bits, or expanded to byte or word elements.
+FORCE_INLINE __m128i _sse2rvv_sidd_mask(vbool8_t res, const int imm8) {
+  const int n = _sse2rvv_sidd_n(imm8);
+  if (imm8 & _SIDD_UNIT_MASK) {
+    if (imm8 & _SIDD_UWORD_OPS)
+      return vreinterpretq_u16_m128i(__riscv_vlmul_trunc_v_u16m2_u16m1(
+          __riscv_vmerge_vxm_u16m2(__riscv_vmv_v_x_u16m2(0, 8), UINT16_MAX,
+                                   res, 8)));
+    return vreinterpretq_u8_m128i(__riscv_vmerge_vxm_u8m1(
+        __riscv_vmv_v_x_u8m1(0, 16), UINT8_MAX, res, 16));
+  }
+  uint16_t bits = __riscv_vmv_x_s_u16m1_u16(
+      __riscv_vreinterpret_v_u8m1_u16m1(__riscv_vreinterpret_v_b8_u8m1(res)));
+  bits &= (1 << n) - 1;
+  return vreinterpretq_u16_m128i(
+      __riscv_vmv_s_x_u16m1_tu(__riscv_vmv_v_x_u16m1(0, 8), bits, 8));
+}
+
+// Compare packed strings in a and b with lengths la and lb using the control in
+// imm8, and returns 1 if b did not contain a null character and the resulting
+// mask was zero, and 0 otherwise.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_mm_cmpestra
+FORCE_INLINE int _mm_cmpestra(__m128i a, int la, __m128i b, int lb,
+                              const int imm8) {
+  const int n = _sse2rvv_sidd_n(imm8);
+  vbool8_t res = _sse2rvv_sidd_cmpestr(a, la, b, lb, imm8);
+  return __riscv_vfirst_m_b8(res, n) < 0 && _sse2rvv_sidd_len(lb, n) == n;
+}
+
+// Compare packed strings in a and b with lengths la and lb using the control in
+// imm8, and returns 1 if the resulting mask was non-zero, and 0 otherwise.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_mm_cmpestrc
+FORCE_INLINE int _mm_cmpestrc(__m128i a, int la, __m128i b, int lb,
+                              const int imm8) {
+  const int n = _sse2rvv_sidd_n(imm8);
+  vbool8_t res = _sse2rvv_sidd_cmpestr(a, la, b, lb, imm8);
+  return __riscv_vfirst_m_b8(res, n) >= 0;
+}
+
+// Compare packed strings in a and b with lengths la and lb using the control in
+// imm8, and store the generated index in dst.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_mm_cmpestri
+FORCE_INLINE int _mm_cmpestri(__m128i a, int la, __m128i b, int lb,
+                              const int imm8) {
+  vbool8_t res = _sse2rvv_sidd_cmpestr(a, la, b, lb, imm8);
+  return _sse2rvv_sidd_index(res, imm8);
+}
+
+// Compare packed strings in a and b with lengths la and lb using the control in
+// imm8, and store the generated mask in dst.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_mm_cmpestrm
+FORCE_INLINE __m128i _mm_cmpestrm(__m128i a, int la, __m128i b, int lb,
+                                  const int imm8) {
+  vbool8_t res = _sse2rvv_sidd_cmpestr(a, la, b, lb, imm8);
+  return _sse2rvv_sidd_mask(res, imm8);
+}
+
+// Compare packed strings in a and b with lengths la and lb using the control in
+// imm8, and returns bit 0 of the resulting bit mask.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_mm_cmpestro
+FORCE_INLINE int _mm_cmpestro(__m128i a, int la, __m128i b, int lb,
+                              const int imm8) {
+  const int n = _sse2rvv_sidd_n(imm8);
+  vbool8_t res = _sse2rvv_sidd_cmpestr(a, la, b, lb, imm8);
+  return __riscv_vfirst_m_b8(res, n) == 0;
+}
+
+// Compare packed strings in a and b with lengths la and lb using the control in
+// imm8, and returns 1 if any character in a was null, and 0 otherwise.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_mm_cmpestrs
+FORCE_INLINE int _mm_cmpestrs(__m128i a, int la, __m128i b, int lb,
+                              const int imm8) {
+  const int n = _sse2rvv_sidd_n(imm8);
+  return _sse2rvv_sidd_len(la, n) < n;
+}
+
+// Compare packed strings in a and b with lengths la and lb using the control in
+// imm8, and returns 1 if any character in b was null, and 0 otherwise.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_mm_cmpestrz
+FORCE_INLINE int _mm_cmpestrz(__m128i a, int la, __m128i b, int lb,
+                              const int imm8) {
+  const int n = _sse2rvv_sidd_n(imm8);
+  return _sse2rvv_sidd_len(lb, n) < n;
+}
 
 FORCE_INLINE __m128d _mm_cmpge_pd(__m128d a, __m128d b) {
   vfloat64m1_t _a = vreinterpretq_m128d_f64(a);
@@ -875,19 +1136,66 @@ FORCE_INLINE __m128 _mm_cmpgt_ss(__m128 a, __m128 b) {
       __riscv_vreinterpret_v_f32m1_i32m1(_a), cmp_res_i32, 0, 1));
 }
 
-// FORCE_INLINE int _mm_cmpistra (__m128i a, __m128i b, const int imm8) {}
+// Compare packed strings with implicit lengths in a and b using the control in
+// imm8, and returns 1 if b did not contain a null character and the resulting
+// mask was zero, and 0 otherwise.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_mm_cmpistra
+FORCE_INLINE int _mm_cmpistra(__m128i a, __m128i b, const int imm8) {
+  const int n = _sse2rvv_sidd_n(imm8);
+  vbool8_t res = _sse2rvv_sidd_cmpistr(a, b, imm8);
+  return __riscv_vfirst_m_b8(res, n) < 0 &&
+         _sse2rvv_sidd_strlen(_sse2rvv_sidd_load(b, imm8), n) == n;
+}
 
-// FORCE_INLINE int _mm_cmpistrc (__m128i a, __m128i b, const int imm8) {}
+// Compare packed strings with implicit lengths in a and b using the control in
+// imm8, and returns 1 if the resulting mask was non-zero, and 0 otherwise.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_mm_cmpistrc
+FORCE_INLINE int _mm_cmpistrc(__m128i a, __m128i b, const int imm8) {
+  const int n = _sse2rvv_sidd_n(imm8);
+  vbool8_t res = _sse2rvv_sidd_cmpistr(a, b, imm8);
+  return __riscv_vfirst_m_b8(res, n) >= 0;
+}
 
-// FORCE_INLINE int _mm_cmpistri (__m128i a, __m128i b, const int imm8) {}
+// Compare packed strings with implicit lengths in a and b using the control in
+// imm8, and store the generated index in dst.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_mm_cmpistri
+FORCE_INLINE int _mm_cmpistri(__m128i a, __m128i b, const int imm8) {
+  vbool8_t res = _sse2rvv_sidd_cmpistr(a, b, imm8);
+  return _sse2rvv_sidd_index(res, imm8);
+}
 
-// FORCE_INLINE __m128i _mm_cmpistrm (__m128i a, __m128i b, const int imm8) {}
+// Compare packed strings with implicit lengths in a and b using the control in
+// imm8, and store the generated mask in dst.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_mm_cmpistrm
+FORCE_INLINE __m128i _mm_cmpistrm(__m128i a, __m128i b, const int imm8) {
+  vbool8_t res = _sse2rvv_sidd_cmpistr(a, b, imm8);
+  return _sse2rvv_sidd_mask(res, imm8);
+}
 
-// FORCE_INLINE int _mm_cmpistro (__m128i a, __m128i b, const int imm8) {}
+// Compare packed strings with implicit lengths in a and b using the control in
+// imm8, and returns bit 0 of the resulting bit mask.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_mm_cmpistro
+FORCE_INLINE int _mm_cmpistro(__m128i a, __m128i b, const int imm8) {
+  const int n = _sse2rvv_sidd_n(imm8);
+  vbool8_t res = _sse2rvv_sidd_cmpistr(a, b, imm8);
+  return __riscv_vfirst_m_b8(res, n) == 0;
+}
 
-// FORCE_INLINE int _mm_cmpistrs (__m128i a, __m128i b, const int imm8) {}
+// Compare packed strings with implicit lengths in a and b using the control in
+// imm8, and returns 1 if any character in a was null, and 0 otherwise.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_mm_cmpistrs
+FORCE_INLINE int _mm_cmpistrs(__m128i a, __m128i b, const int imm8) {
+  const int n = _sse2rvv_sidd_n(imm8);
+  return _sse2rvv_sidd_strlen(_sse2rvv_sidd_load(a, imm8), n) < n;
+}
 
-// FORCE_INLINE int _mm_cmpistrz (__m128i a, __m128i b, const int imm8) {}
+// Compare packed strings with implicit lengths in a and b using the control in
+// imm8, and returns 1 if any character in b was null, and 0 otherwise.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_mm_cmpistrz
+FORCE_INLINE int _mm_cmpistrz(__m128i a, __m128i b, const int imm8) {
+  const int n = _sse2rvv_sidd_n(imm8);
+  return _sse2rvv_sidd_strlen(_sse2rvv_sidd_load(b, imm8), n) < n;
+}
 
 FORCE_INLINE __m128d _mm_cmple_pd(__m128d a, __m128d b) {
   vfloat64m1_t _a = vreinterpretq_m128d_f64(a);
@@ -1349,32 +1657,481 @@ FORCE_INLINE int _mm_comineq_ss(__m128 a, __m128 b) {
          0x1;
 }
 
+// CRC32C. With Zbc each update is a Barrett reduction of the data (shifted to
+// the top of a 64-bit word) by two carry-less multiplies; the quotient
+// constant is floor(x^64 / P), bit-reflected. Without Zbc, slicing-by-8
+// tables consume one byte per lookup and all bytes of a word in parallel.
+#if defined(__riscv_zbc)
+FORCE_INLINE uint32_t _sse2rvv_crc32c_zbc(uint64_t s) {
+  uint64_t t = __riscv_clmul_64(s, UINT64_C(0xa434f61c6f5389f8)) << 1;
+  return (uint32_t)(__riscv_clmulr_64(t ^ s, UINT64_C(0x82f63b78) << 32) >>
+                    32);
+}
+#else
+static const uint32_t _sse2rvv_crc32c_table[8][256] = {
+    {
+        0x00000000, 0xf26b8303, 0xe13b70f7, 0x1350f3f4, 0xc79a971f, 0x35f1141c,
+        0x26a1e7e8, 0xd4ca64eb, 0x8ad958cf, 0x78b2dbcc, 0x6be22838, 0x9989ab3b,
+        0x4d43cfd0, 0xbf284cd3, 0xac78bf27, 0x5e133c24, 0x105ec76f, 0xe235446c,
+        0xf165b798, 0x030e349b, 0xd7c45070, 0x25afd373, 0x36ff2087, 0xc494a384,
+        0x9a879fa0, 0x68ec1ca3, 0x7bbcef57, 0x89d76c54, 0x5d1d08bf, 0xaf768bbc,
+        0xbc267848, 0x4e4dfb4b, 0x20bd8ede, 0xd2d60ddd, 0xc186fe29, 0x33ed7d2a,
+        0xe72719c1, 0x154c9ac2, 0x061c6936, 0xf477ea35, 0xaa64d611, 0x580f5512,
+        0x4b5fa6e6, 0xb93425e5, 0x6dfe410e, 0x9f95c20d, 0x8cc531f9, 0x7eaeb2fa,
+        0x30e349b1, 0xc288cab2, 0xd1d83946, 0x23b3ba45, 0xf779deae, 0x05125dad,
+        0x1642ae59, 0xe4292d5a, 0xba3a117e, 0x4851927d, 0x5b016189, 0xa96ae28a,
+        0x7da08661, 0x8fcb0562, 0x9c9bf696, 0x6ef07595, 0x417b1dbc, 0xb3109ebf,
+        0xa0406d4b, 0x522bee48, 0x86e18aa3, 0x748a09a0, 0x67dafa54, 0x95b17957,
+        0xcba24573, 0x39c9c670, 0x2a993584, 0xd8f2b687, 0x0c38d26c, 0xfe53516f,
+        0xed03a29b, 0x1f682198, 0x5125dad3, 0xa34e59d0, 0xb01eaa24, 0x42752927,
+        0x96bf4dcc, 0x64d4cecf, 0x77843d3b, 0x85efbe38, 0xdbfc821c, 0x2997011f,
+        0x3ac7f2eb, 0xc8ac71e8, 0x1c661503, 0xee0d9600, 0xfd5d65f4, 0x0f36e6f7,
+        0x61c69362, 0x93ad1061, 0x80fde395, 0x72966096, 0xa65c047d, 0x5437877e,
+        0x4767748a, 0xb50cf789, 0xeb1fcbad, 0x197448ae, 0x0a24bb5a, 0xf84f3859,
+        0x2c855cb2, 0xdeeedfb1, 0xcdbe2c45, 0x3fd5af46, 0x7198540d, 0x83f3d70e,
+        0x90a324fa, 0x62c8a7f9, 0xb602c312, 0x44694011, 0x5739b3e5, 0xa55230e6,
+        0xfb410cc2, 0x092a8fc1, 0x1a7a7c35, 0xe811ff36, 0x3cdb9bdd, 0xceb018de,
+        0xdde0eb2a, 0x2f8b6829, 0x82f63b78, 0x709db87b, 0x63cd4b8f, 0x91a6c88c,
+        0x456cac67, 0xb7072f64, 0xa457dc90, 0x563c5f93, 0x082f63b7, 0xfa44e0b4,
+        0xe9141340, 0x1b7f9043, 0xcfb5f4a8, 0x3dde77ab, 0x2e8e845f, 0xdce5075c,
+        0x92a8fc17, 0x60c37f14, 0x73938ce0, 0x81f80fe3, 0x55326b08, 0xa759e80b,
+        0xb4091bff, 0x466298fc, 0x1871a4d8, 0xea1a27db, 0xf94ad42f, 0x0b21572c,
+        0xdfeb33c7, 0x2d80b0c4, 0x3ed04330, 0xccbbc033, 0xa24bb5a6, 0x502036a5,
+        0x4370c551, 0xb11b4652, 0x65d122b9, 0x97baa1ba, 0x84ea524e, 0x7681d14d,
+        0x2892ed69, 0xdaf96e6a, 0xc9a99d9e, 0x3bc21e9d, 0xef087a76, 0x1d63f975,
+        0x0e330a81, 0xfc588982, 0xb21572c9, 0x407ef1ca, 0x532e023e, 0xa145813d,
+        0x758fe5d6, 0x87e466d5, 0x94b49521, 0x66df1622, 0x38cc2a06, 0xcaa7a905,
+        0xd9f75af1, 0x2b9cd9f2, 0xff56bd19, 0x0d3d3e1a, 0x1e6dcdee, 0xec064eed,
+        0xc38d26c4, 0x31e6a5c7, 0x22b65633, 0xd0ddd530, 0x0417b1db, 0xf67c32d8,
+        0xe52cc12c, 0x1747422f, 0x49547e0b, 0xbb3ffd08, 0xa86f0efc, 0x5a048dff,
+        0x8ecee914, 0x7ca56a17, 0x6ff599e3, 0x9d9e1ae0, 0xd3d3e1ab, 0x21b862a8,
+        0x32e8915c, 0xc083125f, 0x144976b4, 0xe622f5b7, 0xf5720643, 0x07198540,
+        0x590ab964, 0xab613a67, 0xb831c993, 0x4a5a4a90, 0x9e902e7b, 0x6cfbad78,
+        0x7fab5e8c, 0x8dc0dd8f, 0xe330a81a, 0x115b2b19, 0x020bd8ed, 0xf0605bee,
+        0x24aa3f05, 0xd6c1bc06, 0xc5914ff2, 0x37faccf1, 0x69e9f0d5, 0x9b8273d6,
+        0x88d28022, 0x7ab90321, 0xae7367ca, 0x5c18e4c9, 0x4f48173d, 0xbd23943e,
+        0xf36e6f75, 0x0105ec76, 0x12551f82, 0xe03e9c81, 0x34f4f86a, 0xc69f7b69,
+        0xd5cf889d, 0x27a40b9e, 0x79b737ba, 0x8bdcb4b9, 0x988c474d, 0x6ae7c44e,
+        0xbe2da0a5, 0x4c4623a6, 0x5f16d052, 0xad7d5351,
+    },
+    {
+        0x00000000, 0x13a29877, 0x274530ee, 0x34e7a899, 0x4e8a61dc, 0x5d28f9ab,
+        0x69cf5132, 0x7a6dc945, 0x9d14c3b8, 0x8eb65bcf, 0xba51f356, 0xa9f36b21,
+        0xd39ea264, 0xc03c3a13, 0xf4db928a, 0xe7790afd, 0x3fc5f181, 0x2c6769f6,
+        0x1880c16f, 0x0b225918, 0x714f905d, 0x62ed082a, 0x560aa0b3, 0x45a838c4,
+        0xa2d13239, 0xb173aa4e, 0x859402d7, 0x96369aa0, 0xec5b53e5, 0xfff9cb92,
+        0xcb1e630b, 0xd8bcfb7c, 0x7f8be302, 0x6c297b75, 0x58ced3ec, 0x4b6c4b9b,
+        0x310182de, 0x22a31aa9, 0x1644b230, 0x05e62a47, 0xe29f20ba, 0xf13db8cd,
+        0xc5da1054, 0xd6788823, 0xac154166, 0xbfb7d911, 0x8b507188, 0x98f2e9ff,
+        0x404e1283, 0x53ec8af4, 0x670b226d, 0x74a9ba1a, 0x0ec4735f, 0x1d66eb28,
+        0x298143b1, 0x3a23dbc6, 0xdd5ad13b, 0xcef8494c, 0xfa1fe1d5, 0xe9bd79a2,
+        0x93d0b0e7, 0x80722890, 0xb4958009, 0xa737187e, 0xff17c604, 0xecb55e73,
+        0xd852f6ea, 0xcbf06e9d, 0xb19da7d8, 0xa23f3faf, 0x96d89736, 0x857a0f41,
+        0x620305bc, 0x71a19dcb, 0x45463552, 0x56e4ad25, 0x2c896460, 0x3f2bfc17,
+        0x0bcc548e, 0x186eccf9, 0xc0d23785, 0xd370aff2, 0xe797076b, 0xf4359f1c,
+        0x8e585659, 0x9dface2e, 0xa91d66b7, 0xbabffec0, 0x5dc6f43d, 0x4e646c4a,
+        0x7a83c4d3, 0x69215ca4, 0x134c95e1, 0x00ee0d96, 0x3409a50f, 0x27ab3d78,
+        0x809c2506, 0x933ebd71, 0xa7d915e8, 0xb47b8d9f, 0xce1644da, 0xddb4dcad,
+        0xe9537434, 0xfaf1ec43, 0x1d88e6be, 0x0e2a7ec9, 0x3acdd650, 0x296f4e27,
+        0x53028762, 0x40a01f15, 0x7447b78c, 0x67e52ffb, 0xbf59d487, 0xacfb4cf0,
+        0x981ce469, 0x8bbe7c1e, 0xf1d3b55b, 0xe2712d2c, 0xd69685b5, 0xc5341dc2,
+        0x224d173f, 0x31ef8f48, 0x050827d1, 0x16aabfa6, 0x6cc776e3, 0x7f65ee94,
+        0x4b82460d, 0x5820de7a, 0xfbc3faf9, 0xe861628e, 0xdc86ca17, 0xcf245260,
+        0xb5499b25, 0xa6eb0352, 0x920cabcb, 0x81ae33bc, 0x66d73941, 0x7575a136,
+        0x419209af, 0x523091d8, 0x285d589d, 0x3bffc0ea, 0x0f186873, 0x1cbaf004,
+        0xc4060b78, 0xd7a4930f, 0xe3433b96, 0xf0e1a3e1, 0x8a8c6aa4, 0x992ef2d3,
+        0xadc95a4a, 0xbe6bc23d, 0x5912c8c0, 0x4ab050b7, 0x7e57f82e, 0x6df56059,
+        0x1798a91c, 0x043a316b, 0x30dd99f2, 0x237f0185, 0x844819fb, 0x97ea818c,
+        0xa30d2915, 0xb0afb162, 0xcac27827, 0xd960e050, 0xed8748c9, 0xfe25d0be,
+        0x195cda43, 0x0afe4234, 0x3e19eaad, 0x2dbb72da, 0x57d6bb9f, 0x447423e8,
+        0x70938b71, 0x63311306, 0xbb8de87a, 0xa82f700d, 0x9cc8d894, 0x8f6a40e3,
+        0xf50789a6, 0xe6a511d1, 0xd242b948, 0xc1e0213f, 0x26992bc2, 0x353bb3b5,
+        0x01dc1b2c, 0x127e835b, 0x68134a1e, 0x7bb1d269, 0x4f567af0, 0x5cf4e287,
+        0x04d43cfd, 0x1776a48a, 0x23910c13, 0x30339464, 0x4a5e5d21, 0x59fcc556,
+        0x6d1b6dcf, 0x7eb9f5b8, 0x99c0ff45, 0x8a626732, 0xbe85cfab, 0xad2757dc,
+        0xd74a9e99, 0xc4e806ee, 0xf00fae77, 0xe3ad3600, 0x3b11cd7c, 0x28b3550b,
+        0x1c54fd92, 0x0ff665e5, 0x759baca0, 0x663934d7, 0x52de9c4e, 0x417c0439,
+        0xa6050ec4, 0xb5a796b3, 0x81403e2a, 0x92e2a65d, 0xe88f6f18, 0xfb2df76f,
+        0xcfca5ff6, 0xdc68c781, 0x7b5fdfff, 0x68fd4788, 0x5c1aef11, 0x4fb87766,
+        0x35d5be23, 0x26772654, 0x12908ecd, 0x013216ba, 0xe64b1c47, 0xf5e98430,
+        0xc10e2ca9, 0xd2acb4de, 0xa8c17d9b, 0xbb63e5ec, 0x8f844d75, 0x9c26d502,
+        0x449a2e7e, 0x5738b609, 0x63df1e90, 0x707d86e7, 0x0a104fa2, 0x19b2d7d5,
+        0x2d557f4c, 0x3ef7e73b, 0xd98eedc6, 0xca2c75b1, 0xfecbdd28, 0xed69455f,
+        0x97048c1a, 0x84a6146d, 0xb041bcf4, 0xa3e32483,
+    },
+    {
+        0x00000000, 0xa541927e, 0x4f6f520d, 0xea2ec073, 0x9edea41a, 0x3b9f3664,
+        0xd1b1f617, 0x74f06469, 0x38513ec5, 0x9d10acbb, 0x773e6cc8, 0xd27ffeb6,
+        0xa68f9adf, 0x03ce08a1, 0xe9e0c8d2, 0x4ca15aac, 0x70a27d8a, 0xd5e3eff4,
+        0x3fcd2f87, 0x9a8cbdf9, 0xee7cd990, 0x4b3d4bee, 0xa1138b9d, 0x045219e3,
+        0x48f3434f, 0xedb2d131, 0x079c1142, 0xa2dd833c, 0xd62de755, 0x736c752b,
+        0x9942b558, 0x3c032726, 0xe144fb14, 0x4405696a, 0xae2ba919, 0x0b6a3b67,
+        0x7f9a5f0e, 0xdadbcd70, 0x30f50d03, 0x95b49f7d, 0xd915c5d1, 0x7c5457af,
+        0x967a97dc, 0x333b05a2, 0x47cb61cb, 0xe28af3b5, 0x08a433c6, 0xade5a1b8,
+        0x91e6869e, 0x34a714e0, 0xde89d493, 0x7bc846ed, 0x0f382284, 0xaa79b0fa,
+        0x40577089, 0xe516e2f7, 0xa9b7b85b, 0x0cf62a25, 0xe6d8ea56, 0x43997828,
+        0x37691c41, 0x92288e3f, 0x78064e4c, 0xdd47dc32, 0xc76580d9, 0x622412a7,
+        0x880ad2d4, 0x2d4b40aa, 0x59bb24c3, 0xfcfab6bd, 0x16d476ce, 0xb395e4b0,
+        0xff34be1c, 0x5a752c62, 0xb05bec11, 0x151a7e6f, 0x61ea1a06, 0xc4ab8878,
+        0x2e85480b, 0x8bc4da75, 0xb7c7fd53, 0x12866f2d, 0xf8a8af5e, 0x5de93d20,
+        0x29195949, 0x8c58cb37, 0x66760b44, 0xc337993a, 0x8f96c396, 0x2ad751e8,
+        0xc0f9919b, 0x65b803e5, 0x1148678c, 0xb409f5f2, 0x5e273581, 0xfb66a7ff,
+        0x26217bcd, 0x8360e9b3, 0x694e29c0, 0xcc0fbbbe, 0xb8ffdfd7, 0x1dbe4da9,
+        0xf7908dda, 0x52d11fa4, 0x1e704508, 0xbb31d776, 0x511f1705, 0xf45e857b,
+        0x80aee112, 0x25ef736c, 0xcfc1b31f, 0x6a802161, 0x56830647, 0xf3c29439,
+        0x19ec544a, 0xbcadc634, 0xc85da25d, 0x6d1c3023, 0x8732f050, 0x2273622e,
+        0x6ed23882, 0xcb93aafc, 0x21bd6a8f, 0x84fcf8f1, 0xf00c9c98, 0x554d0ee6,
+        0xbf63ce95, 0x1a225ceb, 0x8b277743, 0x2e66e53d, 0xc448254e, 0x6109b730,
+        0x15f9d359, 0xb0b84127, 0x5a968154, 0xffd7132a, 0xb3764986, 0x1637dbf8,
+        0xfc191b8b, 0x595889f5, 0x2da8ed9c, 0x88e97fe2, 0x62c7bf91, 0xc7862def,
+        0xfb850ac9, 0x5ec498b7, 0xb4ea58c4, 0x11abcaba, 0x655baed3, 0xc01a3cad,
+        0x2a34fcde, 0x8f756ea0, 0xc3d4340c, 0x6695a672, 0x8cbb6601, 0x29faf47f,
+        0x5d0a9016, 0xf84b0268, 0x1265c21b, 0xb7245065, 0x6a638c57, 0xcf221e29,
+        0x250cde5a, 0x804d4c24, 0xf4bd284d, 0x51fcba33, 0xbbd27a40, 0x1e93e83e,
+        0x5232b292, 0xf77320ec, 0x1d5de09f, 0xb81c72e1, 0xccec1688, 0x69ad84f6,
+        0x83834485, 0x26c2d6fb, 0x1ac1f1dd, 0xbf8063a3, 0x55aea3d0, 0xf0ef31ae,
+        0x841f55c7, 0x215ec7b9, 0xcb7007ca, 0x6e3195b4, 0x2290cf18, 0x87d15d66,
+        0x6dff9d15, 0xc8be0f6b, 0xbc4e6b02, 0x190ff97c, 0xf321390f, 0x5660ab71,
+        0x4c42f79a, 0xe90365e4, 0x032da597, 0xa66c37e9, 0xd29c5380, 0x77ddc1fe,
+        0x9df3018d, 0x38b293f3, 0x7413c95f, 0xd1525b21, 0x3b7c9b52, 0x9e3d092c,
+        0xeacd6d45, 0x4f8cff3b, 0xa5a23f48, 0x00e3ad36, 0x3ce08a10, 0x99a1186e,
+        0x738fd81d, 0xd6ce4a63, 0xa23e2e0a, 0x077fbc74, 0xed517c07, 0x4810ee79,
+        0x04b1b4d5, 0xa1f026ab, 0x4bdee6d8, 0xee9f74a6, 0x9a6f10cf, 0x3f2e82b1,
+        0xd50042c2, 0x7041d0bc, 0xad060c8e, 0x08479ef0, 0xe2695e83, 0x4728ccfd,
+        0x33d8a894, 0x96993aea, 0x7cb7fa99, 0xd9f668e7, 0x9557324b, 0x3016a035,
+        0xda386046, 0x7f79f238, 0x0b899651, 0xaec8042f, 0x44e6c45c, 0xe1a75622,
+        0xdda47104, 0x78e5e37a, 0x92cb2309, 0x378ab177, 0x437ad51e, 0xe63b4760,
+        0x0c158713, 0xa954156d, 0xe5f54fc1, 0x40b4ddbf, 0xaa9a1dcc, 0x0fdb8fb2,
+        0x7b2bebdb, 0xde6a79a5, 0x3444b9d6, 0x91052ba8,
+    },
+    {
+        0x00000000, 0xdd45aab8, 0xbf672381, 0x62228939, 0x7b2231f3, 0xa6679b4b,
+        0xc4451272, 0x1900b8ca, 0xf64463e6, 0x2b01c95e, 0x49234067, 0x9466eadf,
+        0x8d665215, 0x5023f8ad, 0x32017194, 0xef44db2c, 0xe964b13d, 0x34211b85,
+        0x560392bc, 0x8b463804, 0x924680ce, 0x4f032a76, 0x2d21a34f, 0xf06409f7,
+        0x1f20d2db, 0xc2657863, 0xa047f15a, 0x7d025be2, 0x6402e328, 0xb9474990,
+        0xdb65c0a9, 0x06206a11, 0xd725148b, 0x0a60be33, 0x6842370a, 0xb5079db2,
+        0xac072578, 0x71428fc0, 0x136006f9, 0xce25ac41, 0x2161776d, 0xfc24ddd5,
+        0x9e0654ec, 0x4343fe54, 0x5a43469e, 0x8706ec26, 0xe524651f, 0x3861cfa7,
+        0x3e41a5b6, 0xe3040f0e, 0x81268637, 0x5c632c8f, 0x45639445, 0x98263efd,
+        0xfa04b7c4, 0x27411d7c, 0xc805c650, 0x15406ce8, 0x7762e5d1, 0xaa274f69,
+        0xb327f7a3, 0x6e625d1b, 0x0c40d422, 0xd1057e9a, 0xaba65fe7, 0x76e3f55f,
+        0x14c17c66, 0xc984d6de, 0xd0846e14, 0x0dc1c4ac, 0x6fe34d95, 0xb2a6e72d,
+        0x5de23c01, 0x80a796b9, 0xe2851f80, 0x3fc0b538, 0x26c00df2, 0xfb85a74a,
+        0x99a72e73, 0x44e284cb, 0x42c2eeda, 0x9f874462, 0xfda5cd5b, 0x20e067e3,
+        0x39e0df29, 0xe4a57591, 0x8687fca8, 0x5bc25610, 0xb4868d3c, 0x69c32784,
+        0x0be1aebd, 0xd6a40405, 0xcfa4bccf, 0x12e11677, 0x70c39f4e, 0xad8635f6,
+        0x7c834b6c, 0xa1c6e1d4, 0xc3e468ed, 0x1ea1c255, 0x07a17a9f, 0xdae4d027,
+        0xb8c6591e, 0x6583f3a6, 0x8ac7288a, 0x57828232, 0x35a00b0b, 0xe8e5a1b3,
+        0xf1e51979, 0x2ca0b3c1, 0x4e823af8, 0x93c79040, 0x95e7fa51, 0x48a250e9,
+        0x2a80d9d0, 0xf7c57368, 0xeec5cba2, 0x3380611a, 0x51a2e823, 0x8ce7429b,
+        0x63a399b7, 0xbee6330f, 0xdcc4ba36, 0x0181108e, 0x1881a844, 0xc5c402fc,
+        0xa7e68bc5, 0x7aa3217d, 0x52a0c93f, 0x8fe56387, 0xedc7eabe, 0x30824006,
+        0x2982f8cc, 0xf4c75274, 0x96e5db4d, 0x4ba071f5, 0xa4e4aad9, 0x79a10061,
+        0x1b838958, 0xc6c623e0, 0xdfc69b2a, 0x02833192, 0x60a1b8ab, 0xbde41213,
+        0xbbc47802, 0x6681d2ba, 0x04a35b83, 0xd9e6f13b, 0xc0e649f1, 0x1da3e349,
+        0x7f816a70, 0xa2c4c0c8, 0x4d801be4, 0x90c5b15c, 0xf2e73865, 0x2fa292dd,
+        0x36a22a17, 0xebe780af, 0x89c50996, 0x5480a32e, 0x8585ddb4, 0x58c0770c,
+        0x3ae2fe35, 0xe7a7548d, 0xfea7ec47, 0x23e246ff, 0x41c0cfc6, 0x9c85657e,
+        0x73c1be52, 0xae8414ea, 0xcca69dd3, 0x11e3376b, 0x08e38fa1, 0xd5a62519,
+        0xb784ac20, 0x6ac10698, 0x6ce16c89, 0xb1a4c631, 0xd3864f08, 0x0ec3e5b0,
+        0x17c35d7a, 0xca86f7c2, 0xa8a47efb, 0x75e1d443, 0x9aa50f6f, 0x47e0a5d7,
+        0x25c22cee, 0xf8878656, 0xe1873e9c, 0x3cc29424, 0x5ee01d1d, 0x83a5b7a5,
+        0xf90696d8, 0x24433c60, 0x4661b559, 0x9b241fe1, 0x8224a72b, 0x5f610d93,
+        0x3d4384aa, 0xe0062e12, 0x0f42f53e, 0xd2075f86, 0xb025d6bf, 0x6d607c07,
+        0x7460c4cd, 0xa9256e75, 0xcb07e74c, 0x16424df4, 0x106227e5, 0xcd278d5d,
+        0xaf050464, 0x7240aedc, 0x6b401616, 0xb605bcae, 0xd4273597, 0x09629f2f,
+        0xe6264403, 0x3b63eebb, 0x59416782, 0x8404cd3a, 0x9d0475f0, 0x4041df48,
+        0x22635671, 0xff26fcc9, 0x2e238253, 0xf36628eb, 0x9144a1d2, 0x4c010b6a,
+        0x5501b3a0, 0x88441918, 0xea669021, 0x37233a99, 0xd867e1b5, 0x05224b0d,
+        0x6700c234, 0xba45688c, 0xa345d046, 0x7e007afe, 0x1c22f3c7, 0xc167597f,
+        0xc747336e, 0x1a0299d6, 0x782010ef, 0xa565ba57, 0xbc65029d, 0x6120a825,
+        0x0302211c, 0xde478ba4, 0x31035088, 0xec46fa30, 0x8e647309, 0x5321d9b1,
+        0x4a21617b, 0x9764cbc3, 0xf54642fa, 0x2803e842,
+    },
+    {
+        0x00000000, 0x38116fac, 0x7022df58, 0x4833b0f4, 0xe045beb0, 0xd854d11c,
+        0x906761e8, 0xa8760e44, 0xc5670b91, 0xfd76643d, 0xb545d4c9, 0x8d54bb65,
+        0x2522b521, 0x1d33da8d, 0x55006a79, 0x6d1105d5, 0x8f2261d3, 0xb7330e7f,
+        0xff00be8b, 0xc711d127, 0x6f67df63, 0x5776b0cf, 0x1f45003b, 0x27546f97,
+        0x4a456a42, 0x725405ee, 0x3a67b51a, 0x0276dab6, 0xaa00d4f2, 0x9211bb5e,
+        0xda220baa, 0xe2336406, 0x1ba8b557, 0x23b9dafb, 0x6b8a6a0f, 0x539b05a3,
+        0xfbed0be7, 0xc3fc644b, 0x8bcfd4bf, 0xb3debb13, 0xdecfbec6, 0xe6ded16a,
+        0xaeed619e, 0x96fc0e32, 0x3e8a0076, 0x069b6fda, 0x4ea8df2e, 0x76b9b082,
+        0x948ad484, 0xac9bbb28, 0xe4a80bdc, 0xdcb96470, 0x74cf6a34, 0x4cde0598,
+        0x04edb56c, 0x3cfcdac0, 0x51eddf15, 0x69fcb0b9, 0x21cf004d, 0x19de6fe1,
+        0xb1a861a5, 0x89b90e09, 0xc18abefd, 0xf99bd151, 0x37516aae, 0x0f400502,
+        0x4773b5f6, 0x7f62da5a, 0xd714d41e, 0xef05bbb2, 0xa7360b46, 0x9f2764ea,
+        0xf236613f, 0xca270e93, 0x8214be67, 0xba05d1cb, 0x1273df8f, 0x2a62b023,
+        0x625100d7, 0x5a406f7b, 0xb8730b7d, 0x806264d1, 0xc851d425, 0xf040bb89,
+        0x5836b5cd, 0x6027da61, 0x28146a95, 0x10050539, 0x7d1400ec, 0x45056f40,
+        0x0d36dfb4, 0x3527b018, 0x9d51be5c, 0xa540d1f0, 0xed736104, 0xd5620ea8,
+        0x2cf9dff9, 0x14e8b055, 0x5cdb00a1, 0x64ca6f0d, 0xccbc6149, 0xf4ad0ee5,
+        0xbc9ebe11, 0x848fd1bd, 0xe99ed468, 0xd18fbbc4, 0x99bc0b30, 0xa1ad649c,
+        0x09db6ad8, 0x31ca0574, 0x79f9b580, 0x41e8da2c, 0xa3dbbe2a, 0x9bcad186,
+        0xd3f96172, 0xebe80ede, 0x439e009a, 0x7b8f6f36, 0x33bcdfc2, 0x0badb06e,
+        0x66bcb5bb, 0x5eadda17, 0x169e6ae3, 0x2e8f054f, 0x86f90b0b, 0xbee864a7,
+        0xf6dbd453, 0xcecabbff, 0x6ea2d55c, 0x56b3baf0, 0x1e800a04, 0x269165a8,
+        0x8ee76bec, 0xb6f60440, 0xfec5b4b4, 0xc6d4db18, 0xabc5decd, 0x93d4b161,
+        0xdbe70195, 0xe3f66e39, 0x4b80607d, 0x73910fd1, 0x3ba2bf25, 0x03b3d089,
+        0xe180b48f, 0xd991db23, 0x91a26bd7, 0xa9b3047b, 0x01c50a3f, 0x39d46593,
+        0x71e7d567, 0x49f6bacb, 0x24e7bf1e, 0x1cf6d0b2, 0x54c56046, 0x6cd40fea,
+        0xc4a201ae, 0xfcb36e02, 0xb480def6, 0x8c91b15a, 0x750a600b, 0x4d1b0fa7,
+        0x0528bf53, 0x3d39d0ff, 0x954fdebb, 0xad5eb117, 0xe56d01e3, 0xdd7c6e4f,
+        0xb06d6b9a, 0x887c0436, 0xc04fb4c2, 0xf85edb6e, 0x5028d52a, 0x6839ba86,
+        0x200a0a72, 0x181b65de, 0xfa2801d8, 0xc2396e74, 0x8a0ade80, 0xb21bb12c,
+        0x1a6dbf68, 0x227cd0c4, 0x6a4f6030, 0x525e0f9c, 0x3f4f0a49, 0x075e65e5,
+        0x4f6dd511, 0x777cbabd, 0xdf0ab4f9, 0xe71bdb55, 0xaf286ba1, 0x9739040d,
+        0x59f3bff2, 0x61e2d05e, 0x29d160aa, 0x11c00f06, 0xb9b60142, 0x81a76eee,
+        0xc994de1a, 0xf185b1b6, 0x9c94b463, 0xa485dbcf, 0xecb66b3b, 0xd4a70497,
+        0x7cd10ad3, 0x44c0657f, 0x0cf3d58b, 0x34e2ba27, 0xd6d1de21, 0xeec0b18d,
+        0xa6f30179, 0x9ee26ed5, 0x36946091, 0x0e850f3d, 0x46b6bfc9, 0x7ea7d065,
+        0x13b6d5b0, 0x2ba7ba1c, 0x63940ae8, 0x5b856544, 0xf3f36b00, 0xcbe204ac,
+        0x83d1b458, 0xbbc0dbf4, 0x425b0aa5, 0x7a4a6509, 0x3279d5fd, 0x0a68ba51,
+        0xa21eb415, 0x9a0fdbb9, 0xd23c6b4d, 0xea2d04e1, 0x873c0134, 0xbf2d6e98,
+        0xf71ede6c, 0xcf0fb1c0, 0x6779bf84, 0x5f68d028, 0x175b60dc, 0x2f4a0f70,
+        0xcd796b76, 0xf56804da, 0xbd5bb42e, 0x854adb82, 0x2d3cd5c6, 0x152dba6a,
+        0x5d1e0a9e, 0x650f6532, 0x081e60e7, 0x300f0f4b, 0x783cbfbf, 0x402dd013,
+        0xe85bde57, 0xd04ab1fb, 0x9879010f, 0xa0686ea3,
+    },
+    {
+        0x00000000, 0xef306b19, 0xdb8ca0c3, 0x34bccbda, 0xb2f53777, 0x5dc55c6e,
+        0x697997b4, 0x8649fcad, 0x6006181f, 0x8f367306, 0xbb8ab8dc, 0x54bad3c5,
+        0xd2f32f68, 0x3dc34471, 0x097f8fab, 0xe64fe4b2, 0xc00c303e, 0x2f3c5b27,
+        0x1b8090fd, 0xf4b0fbe4, 0x72f90749, 0x9dc96c50, 0xa975a78a, 0x4645cc93,
+        0xa00a2821, 0x4f3a4338, 0x7b8688e2, 0x94b6e3fb, 0x12ff1f56, 0xfdcf744f,
+        0xc973bf95, 0x2643d48c, 0x85f4168d, 0x6ac47d94, 0x5e78b64e, 0xb148dd57,
+        0x370121fa, 0xd8314ae3, 0xec8d8139, 0x03bdea20, 0xe5f20e92, 0x0ac2658b,
+        0x3e7eae51, 0xd14ec548, 0x570739e5, 0xb83752fc, 0x8c8b9926, 0x63bbf23f,
+        0x45f826b3, 0xaac84daa, 0x9e748670, 0x7144ed69, 0xf70d11c4, 0x183d7add,
+        0x2c81b107, 0xc3b1da1e, 0x25fe3eac, 0xcace55b5, 0xfe729e6f, 0x1142f576,
+        0x970b09db, 0x783b62c2, 0x4c87a918, 0xa3b7c201, 0x0e045beb, 0xe13430f2,
+        0xd588fb28, 0x3ab89031, 0xbcf16c9c, 0x53c10785, 0x677dcc5f, 0x884da746,
+        0x6e0243f4, 0x813228ed, 0xb58ee337, 0x5abe882e, 0xdcf77483, 0x33c71f9a,
+        0x077bd440, 0xe84bbf59, 0xce086bd5, 0x213800cc, 0x1584cb16, 0xfab4a00f,
+        0x7cfd5ca2, 0x93cd37bb, 0xa771fc61, 0x48419778, 0xae0e73ca, 0x413e18d3,
+        0x7582d309, 0x9ab2b810, 0x1cfb44bd, 0xf3cb2fa4, 0xc777e47e, 0x28478f67,
+        0x8bf04d66, 0x64c0267f, 0x507ceda5, 0xbf4c86bc, 0x39057a11, 0xd6351108,
+        0xe289dad2, 0x0db9b1cb, 0xebf65579, 0x04c63e60, 0x307af5ba, 0xdf4a9ea3,
+        0x5903620e, 0xb6330917, 0x828fc2cd, 0x6dbfa9d4, 0x4bfc7d58, 0xa4cc1641,
+        0x9070dd9b, 0x7f40b682, 0xf9094a2f, 0x16392136, 0x2285eaec, 0xcdb581f5,
+        0x2bfa6547, 0xc4ca0e5e, 0xf076c584, 0x1f46ae9d, 0x990f5230, 0x763f3929,
+        0x4283f2f3, 0xadb399ea, 0x1c08b7d6, 0xf338dccf, 0xc7841715, 0x28b47c0c,
+        0xaefd80a1, 0x41cdebb8, 0x75712062, 0x9a414b7b, 0x7c0eafc9, 0x933ec4d0,
+        0xa7820f0a, 0x48b26413, 0xcefb98be, 0x21cbf3a7, 0x1577387d, 0xfa475364,
+        0xdc0487e8, 0x3334ecf1, 0x0788272b, 0xe8b84c32, 0x6ef1b09f, 0x81c1db86,
+        0xb57d105c, 0x5a4d7b45, 0xbc029ff7, 0x5332f4ee, 0x678e3f34, 0x88be542d,
+        0x0ef7a880, 0xe1c7c399, 0xd57b0843, 0x3a4b635a, 0x99fca15b, 0x76ccca42,
+        0x42700198, 0xad406a81, 0x2b09962c, 0xc439fd35, 0xf08536ef, 0x1fb55df6,
+        0xf9fab944, 0x16cad25d, 0x22761987, 0xcd46729e, 0x4b0f8e33, 0xa43fe52a,
+        0x90832ef0, 0x7fb345e9, 0x59f09165, 0xb6c0fa7c, 0x827c31a6, 0x6d4c5abf,
+        0xeb05a612, 0x0435cd0b, 0x308906d1, 0xdfb96dc8, 0x39f6897a, 0xd6c6e263,
+        0xe27a29b9, 0x0d4a42a0, 0x8b03be0d, 0x6433d514, 0x508f1ece, 0xbfbf75d7,
+        0x120cec3d, 0xfd3c8724, 0xc9804cfe, 0x26b027e7, 0xa0f9db4a, 0x4fc9b053,
+        0x7b757b89, 0x94451090, 0x720af422, 0x9d3a9f3b, 0xa98654e1, 0x46b63ff8,
+        0xc0ffc355, 0x2fcfa84c, 0x1b736396, 0xf443088f, 0xd200dc03, 0x3d30b71a,
+        0x098c7cc0, 0xe6bc17d9, 0x60f5eb74, 0x8fc5806d, 0xbb794bb7, 0x544920ae,
+        0xb206c41c, 0x5d36af05, 0x698a64df, 0x86ba0fc6, 0x00f3f36b, 0xefc39872,
+        0xdb7f53a8, 0x344f38b1, 0x97f8fab0, 0x78c891a9, 0x4c745a73, 0xa344316a,
+        0x250dcdc7, 0xca3da6de, 0xfe816d04, 0x11b1061d, 0xf7fee2af, 0x18ce89b6,
+        0x2c72426c, 0xc3422975, 0x450bd5d8, 0xaa3bbec1, 0x9e87751b, 0x71b71e02,
+        0x57f4ca8e, 0xb8c4a197, 0x8c786a4d, 0x63480154, 0xe501fdf9, 0x0a3196e0,
+        0x3e8d5d3a, 0xd1bd3623, 0x37f2d291, 0xd8c2b988, 0xec7e7252, 0x034e194b,
+        0x8507e5e6, 0x6a378eff, 0x5e8b4525, 0xb1bb2e3c,
+    },
+    {
+        0x00000000, 0x68032cc8, 0xd0065990, 0xb8057558, 0xa5e0c5d1, 0xcde3e919,
+        0x75e69c41, 0x1de5b089, 0x4e2dfd53, 0x262ed19b, 0x9e2ba4c3, 0xf628880b,
+        0xebcd3882, 0x83ce144a, 0x3bcb6112, 0x53c84dda, 0x9c5bfaa6, 0xf458d66e,
+        0x4c5da336, 0x245e8ffe, 0x39bb3f77, 0x51b813bf, 0xe9bd66e7, 0x81be4a2f,
+        0xd27607f5, 0xba752b3d, 0x02705e65, 0x6a7372ad, 0x7796c224, 0x1f95eeec,
+        0xa7909bb4, 0xcf93b77c, 0x3d5b83bd, 0x5558af75, 0xed5dda2d, 0x855ef6e5,
+        0x98bb466c, 0xf0b86aa4, 0x48bd1ffc, 0x20be3334, 0x73767eee, 0x1b755226,
+        0xa370277e, 0xcb730bb6, 0xd696bb3f, 0xbe9597f7, 0x0690e2af, 0x6e93ce67,
+        0xa100791b, 0xc90355d3, 0x7106208b, 0x19050c43, 0x04e0bcca, 0x6ce39002,
+        0xd4e6e55a, 0xbce5c992, 0xef2d8448, 0x872ea880, 0x3f2bddd8, 0x5728f110,
+        0x4acd4199, 0x22ce6d51, 0x9acb1809, 0xf2c834c1, 0x7ab7077a, 0x12b42bb2,
+        0xaab15eea, 0xc2b27222, 0xdf57c2ab, 0xb754ee63, 0x0f519b3b, 0x6752b7f3,
+        0x349afa29, 0x5c99d6e1, 0xe49ca3b9, 0x8c9f8f71, 0x917a3ff8, 0xf9791330,
+        0x417c6668, 0x297f4aa0, 0xe6ecfddc, 0x8eefd114, 0x36eaa44c, 0x5ee98884,
+        0x430c380d, 0x2b0f14c5, 0x930a619d, 0xfb094d55, 0xa8c1008f, 0xc0c22c47,
+        0x78c7591f, 0x10c475d7, 0x0d21c55e, 0x6522e996, 0xdd279cce, 0xb524b006,
+        0x47ec84c7, 0x2fefa80f, 0x97eadd57, 0xffe9f19f, 0xe20c4116, 0x8a0f6dde,
+        0x320a1886, 0x5a09344e, 0x09c17994, 0x61c2555c, 0xd9c72004, 0xb1c40ccc,
+        0xac21bc45, 0xc422908d, 0x7c27e5d5, 0x1424c91d, 0xdbb77e61, 0xb3b452a9,
+        0x0bb127f1, 0x63b20b39, 0x7e57bbb0, 0x16549778, 0xae51e220, 0xc652cee8,
+        0x959a8332, 0xfd99affa, 0x459cdaa2, 0x2d9ff66a, 0x307a46e3, 0x58796a2b,
+        0xe07c1f73, 0x887f33bb, 0xf56e0ef4, 0x9d6d223c, 0x25685764, 0x4d6b7bac,
+        0x508ecb25, 0x388de7ed, 0x808892b5, 0xe88bbe7d, 0xbb43f3a7, 0xd340df6f,
+        0x6b45aa37, 0x034686ff, 0x1ea33676, 0x76a01abe, 0xcea56fe6, 0xa6a6432e,
+        0x6935f452, 0x0136d89a, 0xb933adc2, 0xd130810a, 0xccd53183, 0xa4d61d4b,
+        0x1cd36813, 0x74d044db, 0x27180901, 0x4f1b25c9, 0xf71e5091, 0x9f1d7c59,
+        0x82f8ccd0, 0xeafbe018, 0x52fe9540, 0x3afdb988, 0xc8358d49, 0xa036a181,
+        0x1833d4d9, 0x7030f811, 0x6dd54898, 0x05d66450, 0xbdd31108, 0xd5d03dc0,
+        0x8618701a, 0xee1b5cd2, 0x561e298a, 0x3e1d0542, 0x23f8b5cb, 0x4bfb9903,
+        0xf3feec5b, 0x9bfdc093, 0x546e77ef, 0x3c6d5b27, 0x84682e7f, 0xec6b02b7,
+        0xf18eb23e, 0x998d9ef6, 0x2188ebae, 0x498bc766, 0x1a438abc, 0x7240a674,
+        0xca45d32c, 0xa246ffe4, 0xbfa34f6d, 0xd7a063a5, 0x6fa516fd, 0x07a63a35,
+        0x8fd9098e, 0xe7da2546, 0x5fdf501e, 0x37dc7cd6, 0x2a39cc5f, 0x423ae097,
+        0xfa3f95cf, 0x923cb907, 0xc1f4f4dd, 0xa9f7d815, 0x11f2ad4d, 0x79f18185,
+        0x6414310c, 0x0c171dc4, 0xb412689c, 0xdc114454, 0x1382f328, 0x7b81dfe0,
+        0xc384aab8, 0xab878670, 0xb66236f9, 0xde611a31, 0x66646f69, 0x0e6743a1,
+        0x5daf0e7b, 0x35ac22b3, 0x8da957eb, 0xe5aa7b23, 0xf84fcbaa, 0x904ce762,
+        0x2849923a, 0x404abef2, 0xb2828a33, 0xda81a6fb, 0x6284d3a3, 0x0a87ff6b,
+        0x17624fe2, 0x7f61632a, 0xc7641672, 0xaf673aba, 0xfcaf7760, 0x94ac5ba8,
+        0x2ca92ef0, 0x44aa0238, 0x594fb2b1, 0x314c9e79, 0x8949eb21, 0xe14ac7e9,
+        0x2ed97095, 0x46da5c5d, 0xfedf2905, 0x96dc05cd, 0x8b39b544, 0xe33a998c,
+        0x5b3fecd4, 0x333cc01c, 0x60f48dc6, 0x08f7a10e, 0xb0f2d456, 0xd8f1f89e,
+        0xc5144817, 0xad1764df, 0x15121187, 0x7d113d4f,
+    },
+    {
+        0x00000000, 0x493c7d27, 0x9278fa4e, 0xdb448769, 0x211d826d, 0x6821ff4a,
+        0xb3657823, 0xfa590504, 0x423b04da, 0x0b0779fd, 0xd043fe94, 0x997f83b3,
+        0x632686b7, 0x2a1afb90, 0xf15e7cf9, 0xb86201de, 0x847609b4, 0xcd4a7493,
+        0x160ef3fa, 0x5f328edd, 0xa56b8bd9, 0xec57f6fe, 0x37137197, 0x7e2f0cb0,
+        0xc64d0d6e, 0x8f717049, 0x5435f720, 0x1d098a07, 0xe7508f03, 0xae6cf224,
+        0x7528754d, 0x3c14086a, 0x0d006599, 0x443c18be, 0x9f789fd7, 0xd644e2f0,
+        0x2c1de7f4, 0x65219ad3, 0xbe651dba, 0xf759609d, 0x4f3b6143, 0x06071c64,
+        0xdd439b0d, 0x947fe62a, 0x6e26e32e, 0x271a9e09, 0xfc5e1960, 0xb5626447,
+        0x89766c2d, 0xc04a110a, 0x1b0e9663, 0x5232eb44, 0xa86bee40, 0xe1579367,
+        0x3a13140e, 0x732f6929, 0xcb4d68f7, 0x827115d0, 0x593592b9, 0x1009ef9e,
+        0xea50ea9a, 0xa36c97bd, 0x782810d4, 0x31146df3, 0x1a00cb32, 0x533cb615,
+        0x8878317c, 0xc1444c5b, 0x3b1d495f, 0x72213478, 0xa965b311, 0xe059ce36,
+        0x583bcfe8, 0x1107b2cf, 0xca4335a6, 0x837f4881, 0x79264d85, 0x301a30a2,
+        0xeb5eb7cb, 0xa262caec, 0x9e76c286, 0xd74abfa1, 0x0c0e38c8, 0x453245ef,
+        0xbf6b40eb, 0xf6573dcc, 0x2d13baa5, 0x642fc782, 0xdc4dc65c, 0x9571bb7b,
+        0x4e353c12, 0x07094135, 0xfd504431, 0xb46c3916, 0x6f28be7f, 0x2614c358,
+        0x1700aeab, 0x5e3cd38c, 0x857854e5, 0xcc4429c2, 0x361d2cc6, 0x7f2151e1,
+        0xa465d688, 0xed59abaf, 0x553baa71, 0x1c07d756, 0xc743503f, 0x8e7f2d18,
+        0x7426281c, 0x3d1a553b, 0xe65ed252, 0xaf62af75, 0x9376a71f, 0xda4ada38,
+        0x010e5d51, 0x48322076, 0xb26b2572, 0xfb575855, 0x2013df3c, 0x692fa21b,
+        0xd14da3c5, 0x9871dee2, 0x4335598b, 0x0a0924ac, 0xf05021a8, 0xb96c5c8f,
+        0x6228dbe6, 0x2b14a6c1, 0x34019664, 0x7d3deb43, 0xa6796c2a, 0xef45110d,
+        0x151c1409, 0x5c20692e, 0x8764ee47, 0xce589360, 0x763a92be, 0x3f06ef99,
+        0xe44268f0, 0xad7e15d7, 0x572710d3, 0x1e1b6df4, 0xc55fea9d, 0x8c6397ba,
+        0xb0779fd0, 0xf94be2f7, 0x220f659e, 0x6b3318b9, 0x916a1dbd, 0xd856609a,
+        0x0312e7f3, 0x4a2e9ad4, 0xf24c9b0a, 0xbb70e62d, 0x60346144, 0x29081c63,
+        0xd3511967, 0x9a6d6440, 0x4129e329, 0x08159e0e, 0x3901f3fd, 0x703d8eda,
+        0xab7909b3, 0xe2457494, 0x181c7190, 0x51200cb7, 0x8a648bde, 0xc358f6f9,
+        0x7b3af727, 0x32068a00, 0xe9420d69, 0xa07e704e, 0x5a27754a, 0x131b086d,
+        0xc85f8f04, 0x8163f223, 0xbd77fa49, 0xf44b876e, 0x2f0f0007, 0x66337d20,
+        0x9c6a7824, 0xd5560503, 0x0e12826a, 0x472eff4d, 0xff4cfe93, 0xb67083b4,
+        0x6d3404dd, 0x240879fa, 0xde517cfe, 0x976d01d9, 0x4c2986b0, 0x0515fb97,
+        0x2e015d56, 0x673d2071, 0xbc79a718, 0xf545da3f, 0x0f1cdf3b, 0x4620a21c,
+        0x9d642575, 0xd4585852, 0x6c3a598c, 0x250624ab, 0xfe42a3c2, 0xb77edee5,
+        0x4d27dbe1, 0x041ba6c6, 0xdf5f21af, 0x96635c88, 0xaa7754e2, 0xe34b29c5,
+        0x380faeac, 0x7133d38b, 0x8b6ad68f, 0xc256aba8, 0x19122cc1, 0x502e51e6,
+        0xe84c5038, 0xa1702d1f, 0x7a34aa76, 0x3308d751, 0xc951d255, 0x806daf72,
+        0x5b29281b, 0x1215553c, 0x230138cf, 0x6a3d45e8, 0xb179c281, 0xf845bfa6,
+        0x021cbaa2, 0x4b20c785, 0x906440ec, 0xd9583dcb, 0x613a3c15, 0x28064132,
+        0xf342c65b, 0xba7ebb7c, 0x4027be78, 0x091bc35f, 0xd25f4436, 0x9b633911,
+        0xa777317b, 0xee4b4c5c, 0x350fcb35, 0x7c33b612, 0x866ab316, 0xcf56ce31,
+        0x14124958, 0x5d2e347f, 0xe54c35a1, 0xac704886, 0x7734cfef, 0x3e08b2c8,
+        0xc451b7cc, 0x8d6dcaeb, 0x56294d82, 0x1f1530a5,
+    },
+};
+#endif
+
 FORCE_INLINE unsigned int _mm_crc32_u8(unsigned int crc, unsigned char v) {
-  crc ^= v;
-  for (int bit = 0; bit < 8; bit++) {
-    if (crc & 1)
-      crc = (crc >> 1) ^ UINT32_C(0x82f63b78);
-    else
-      crc = (crc >> 1);
-  }
-  return crc;
+#if defined(__riscv_zbc)
+  return _sse2rvv_crc32c_zbc((uint64_t)(uint8_t)(crc ^ v) << 56) ^ (crc >> 8);
+#else
+  return (crc >> 8) ^ _sse2rvv_crc32c_table[0][(crc ^ v) & 0xff];
+#endif
 }
 
 FORCE_INLINE unsigned int _mm_crc32_u16(unsigned int crc, unsigned short v) {
-  crc = _mm_crc32_u8(crc, v & UINT8_MAX);
-  crc = _mm_crc32_u8(crc, (v >> 8) & UINT8_MAX);
-  return crc;
+#if defined(__riscv_zbc)
+  return _sse2rvv_crc32c_zbc((uint64_t)(uint16_t)(crc ^ v) << 48) ^
+         (crc >> 16);
+#else
+  uint32_t s = crc ^ v;
+  return (crc >> 16) ^ _sse2rvv_crc32c_table[1][s & 0xff] ^
+         _sse2rvv_crc32c_table[0][(s >> 8) & 0xff];
+#endif
 }
 
 FORCE_INLINE unsigned int _mm_crc32_u32(unsigned int crc, unsigned int v) {
-  crc = _mm_crc32_u16(crc, v & UINT16_MAX);
-  crc = _mm_crc32_u16(crc, (v >> 16) & UINT16_MAX);
-  return crc;
+#if defined(__riscv_zbc)
+  return _sse2rvv_crc32c_zbc((uint64_t)(uint32_t)(crc ^ v) << 32);
+#else
+  uint32_t s = crc ^ v;
+  return _sse2rvv_crc32c_table[3][s & 0xff] ^
+         _sse2rvv_crc32c_table[2][(s >> 8) & 0xff] ^
+         _sse2rvv_crc32c_table[1][(s >> 16) & 0xff] ^
+         _sse2rvv_crc32c_table[0][s >> 24];
+#endif
 }
 
 FORCE_INLINE __int64 _mm_crc32_u64(__int64 crc, __int64 v) {
-  crc = _mm_crc32_u32((uint32_t)(crc), v & UINT32_MAX);
-  crc = _mm_crc32_u32((uint32_t)(crc), (v >> 32) & UINT32_MAX);
+  uint64_t s = (uint64_t)(uint32_t)crc ^ (uint64_t)v;
+#if defined(__riscv_zbc)
+  return _sse2rvv_crc32c_zbc(s);
+#else
+  return _sse2rvv_crc32c_table[7][s & 0xff] ^
+         _sse2rvv_crc32c_table[6][(s >> 8) & 0xff] ^
+         _sse2rvv_crc32c_table[5][(s >> 16) & 0xff] ^
+         _sse2rvv_crc32c_table[4][(s >> 24) & 0xff] ^
+         _sse2rvv_crc32c_table[3][(s >> 32) & 0xff] ^
+         _sse2rvv_crc32c_table[2][(s >> 40) & 0xff] ^
+         _sse2rvv_crc32c_table[1][(s >> 48) & 0xff] ^
+         _sse2rvv_crc32c_table[0][s >> 56];
+#endif
+}
+
+// CRC32C of len bytes at buf, continuing from crc, with the same (absent)
+// pre- and post-conditioning as _mm_crc32_*. With Zvbc, four 128-bit lanes
+// are folded 64 bytes at a time: each lane's halves are multiplied by
+// x^575 and x^511 mod P (bit-reflected) and xored into the next block, which
+// keeps the value congruent to the data consumed so far. The 64-byte
+// remainder and the tail then go through _mm_crc32_u64/_u8. Blocks are loaded
+// as bytes, since buf need not be 8-byte aligned.
+FORCE_INLINE uint32_t _sse2rvv_crc32c(uint32_t crc, const void *buf,
+                                      size_t len) {
+  const uint8_t *p = (const uint8_t *)buf;
+#if defined(__riscv_zvbc)
+  if (len >= 128) {
+    const uint64_t k[8] = {
+        UINT64_C(0x1c19243b00000000), UINT64_C(0x75bba45b00000000),
+        UINT64_C(0x1c19243b00000000), UINT64_C(0x75bba45b00000000),
+        UINT64_C(0x1c19243b00000000), UINT64_C(0x75bba45b00000000),
+        UINT64_C(0x1c19243b00000000), UINT64_C(0x75bba45b00000000),
+    };
+    vuint64m4_t _k = __riscv_vle64_v_u64m4(k, 8);
+    vuint64m4_t id = __riscv_vid_v_u64m4(8);
+    vuint64m4_t swap = __riscv_vxor_vx_u64m4(id, 1, 8);
+    vbool16_t odd = __riscv_vmsne_vx_u64m4_b16(
+        __riscv_vand_vx_u64m4(id, 1, 8), 0, 8);
+    vuint64m4_t acc =
+        __riscv_vreinterpret_v_u8m4_u64m4(__riscv_vle8_v_u8m4(p, 64));
+    acc = __riscv_vxor_vx_u64m4_tu(acc, acc, crc, 1);
+    p += 64;
+    len -= 64;
+    while (len >= 64) {
+      vuint64m4_t lo = __riscv_vclmul_vv_u64m4(acc, _k, 8);
+      vuint64m4_t hi = __riscv_vclmulh_vv_u64m4(acc, _k, 8);
+      lo = __riscv_vxor_vv_u64m4(lo, __riscv_vrgather_vv_u64m4(lo, swap, 8), 8);
+      hi = __riscv_vxor_vv_u64m4(hi, __riscv_vrgather_vv_u64m4(hi, swap, 8), 8);
+      acc = __riscv_vxor_vv_u64m4(
+          __riscv_vmerge_vvm_u64m4(lo, hi, odd, 8),
+          __riscv_vreinterpret_v_u8m4_u64m4(__riscv_vle8_v_u8m4(p, 64)), 8);
+      p += 64;
+      len -= 64;
+    }
+    uint64_t r[8];
+    __riscv_vse64_v_u64m4(r, acc, 8);
+    crc = 0;
+    for (int i = 0; i < 8; i++)
+      crc = (uint32_t)_mm_crc32_u64(crc, (__int64)r[i]);
+  }
+#endif
+  for (; len >= 8; p += 8, len -= 8) {
+    uint64_t v;
+    memcpy(&v, p, 8);
+    crc = (uint32_t)_mm_crc32_u64(crc, (__int64)v);
+  }
+  for (; len > 0; p++, len--)
+    crc = _mm_crc32_u8(crc, *p);
   return crc;
 }
 
@@ -1782,9 +2539,48 @@ FORCE_INLINE __m128 _mm_div_ss(__m128 a, __m128 b) {
   return vreinterpretq_f32_m128(__riscv_vslideup_vx_f32m1_tu(_a, div, 0, 1));
 }
 
-// FORCE_INLINE __m128d _mm_dp_pd (__m128d a, __m128d b, const int imm8) {}
+// Conditionally multiply the packed double-precision (64-bit) floating-point
+// elements in a and b using the high 4 bits in imm8, sum the two products, and
+// conditionally store the sum in dst using the low 4 bits of imm8.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_mm_dp_pd
+FORCE_INLINE __m128d _mm_dp_pd(__m128d a, __m128d b, const int imm8) {
+  vfloat64m1_t _a = vreinterpretq_m128d_f64(a);
+  vfloat64m1_t _b = vreinterpretq_m128d_f64(b);
+  vbool64_t in_mask =
+      __riscv_vreinterpret_v_u8m1_b64(__riscv_vmv_s_x_u8m1((imm8 >> 4) & 3, 2));
+  vbool64_t out_mask =
+      __riscv_vreinterpret_v_u8m1_b64(__riscv_vmv_s_x_u8m1(imm8 & 3, 2));
+  vfloat64m1_t zero = __riscv_vfmv_v_f_f64m1(0, 2);
+  vfloat64m1_t prod = __riscv_vfmul_vv_f64m1_mu(in_mask, zero, _a, _b, 2);
+  vfloat64m1_t sum =
+      __riscv_vfadd_vv_f64m1(prod, __riscv_vslidedown_vx_f64m1(prod, 1, 2), 1);
+  return vreinterpretq_f64_m128d(
+      __riscv_vrgather_vx_f64m1_mu(out_mask, zero, sum, 0, 2));
+}
 
-// FORCE_INLINE __m128 _mm_dp_ps (__m128 a, __m128 b, const int imm8) {}
+// Conditionally multiply the packed single-precision (32-bit) floating-point
+// elements in a and b using the high 4 bits in imm8, sum the four products,
+// and conditionally store the sum in dst using the low 4 bits of imm8.
+// x86 adds the products pairwise as (p0 + p1) + (p2 + p3), and neither RVV
+// float reduction is specified to, so the sum is built from two slide-adds to
+// stay bit-exact.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_mm_dp_ps
+FORCE_INLINE __m128 _mm_dp_ps(__m128 a, __m128 b, const int imm8) {
+  vfloat32m1_t _a = vreinterpretq_m128_f32(a);
+  vfloat32m1_t _b = vreinterpretq_m128_f32(b);
+  vbool32_t in_mask = __riscv_vreinterpret_v_u8m1_b32(
+      __riscv_vmv_s_x_u8m1((imm8 >> 4) & 15, 4));
+  vbool32_t out_mask =
+      __riscv_vreinterpret_v_u8m1_b32(__riscv_vmv_s_x_u8m1(imm8 & 15, 4));
+  vfloat32m1_t zero = __riscv_vfmv_v_f_f32m1(0, 4);
+  vfloat32m1_t prod = __riscv_vfmul_vv_f32m1_mu(in_mask, zero, _a, _b, 4);
+  vfloat32m1_t pair =
+      __riscv_vfadd_vv_f32m1(prod, __riscv_vslidedown_vx_f32m1(prod, 1, 4), 3);
+  vfloat32m1_t sum =
+      __riscv_vfadd_vv_f32m1(pair, __riscv_vslidedown_vx_f32m1(pair, 2, 4), 1);
+  return vreinterpretq_f32_m128(
+      __riscv_vrgather_vx_f32m1_mu(out_mask, zero, sum, 0, 4));
+}
 
 FORCE_INLINE int _mm_extract_epi16(__m128i a, int imm8) {
   vint16m1_t _a = vreinterpretq_m128i_i16(a);
@@ -1870,6 +2666,160 @@ FORCE_INLINE __m128 _mm_floor_ss(__m128 a, __m128 b) {
   return vreinterpretq_f32_m128(__riscv_vslideup_vx_f32m1_tu(_a, _arr, 0, 1));
 }
 
+FORCE_INLINE __m128d _mm_fmadd_pd(__m128d a, __m128d b, __m128d c) {
+  vfloat64m1_t _a = vreinterpretq_m128d_f64(a);
+  vfloat64m1_t _b = vreinterpretq_m128d_f64(b);
+  vfloat64m1_t _c = vreinterpretq_m128d_f64(c);
+  return vreinterpretq_f64_m128d(__riscv_vfmadd_vv_f64m1(_a, _b, _c, 2));
+}
+
+FORCE_INLINE __m128 _mm_fmadd_ps(__m128 a, __m128 b, __m128 c) {
+  vfloat32m1_t _a = vreinterpretq_m128_f32(a);
+  vfloat32m1_t _b = vreinterpretq_m128_f32(b);
+  vfloat32m1_t _c = vreinterpretq_m128_f32(c);
+  return vreinterpretq_f32_m128(__riscv_vfmadd_vv_f32m1(_a, _b, _c, 4));
+}
+
+FORCE_INLINE __m128d _mm_fmadd_sd(__m128d a, __m128d b, __m128d c) {
+  vfloat64m1_t _a = vreinterpretq_m128d_f64(a);
+  vfloat64m1_t _b = vreinterpretq_m128d_f64(b);
+  vfloat64m1_t _c = vreinterpretq_m128d_f64(c);
+  return vreinterpretq_f64_m128d(__riscv_vfmadd_vv_f64m1_tu(_a, _b, _c, 1));
+}
+
+FORCE_INLINE __m128 _mm_fmadd_ss(__m128 a, __m128 b, __m128 c) {
+  vfloat32m1_t _a = vreinterpretq_m128_f32(a);
+  vfloat32m1_t _b = vreinterpretq_m128_f32(b);
+  vfloat32m1_t _c = vreinterpretq_m128_f32(c);
+  return vreinterpretq_f32_m128(__riscv_vfmadd_vv_f32m1_tu(_a, _b, _c, 1));
+}
+
+// Negating c in the even lanes turns the fused add into a fused subtract
+// there, so each lane still rounds once.
+FORCE_INLINE __m128d _mm_fmaddsub_pd(__m128d a, __m128d b, __m128d c) {
+  vfloat64m1_t _a = vreinterpretq_m128d_f64(a);
+  vfloat64m1_t _b = vreinterpretq_m128d_f64(b);
+  vfloat64m1_t _c = vreinterpretq_m128d_f64(c);
+  vbool64_t even = __riscv_vmseq_vx_u64m1_b64(
+      __riscv_vand_vx_u64m1(__riscv_vid_v_u64m1(2), 1, 2), 0, 2);
+  vfloat64m1_t c_neg = __riscv_vfneg_v_f64m1_mu(even, _c, _c, 2);
+  return vreinterpretq_f64_m128d(__riscv_vfmadd_vv_f64m1(_a, _b, c_neg, 2));
+}
+
+FORCE_INLINE __m128 _mm_fmaddsub_ps(__m128 a, __m128 b, __m128 c) {
+  vfloat32m1_t _a = vreinterpretq_m128_f32(a);
+  vfloat32m1_t _b = vreinterpretq_m128_f32(b);
+  vfloat32m1_t _c = vreinterpretq_m128_f32(c);
+  vbool32_t even = __riscv_vmseq_vx_u32m1_b32(
+      __riscv_vand_vx_u32m1(__riscv_vid_v_u32m1(4), 1, 4), 0, 4);
+  vfloat32m1_t c_neg = __riscv_vfneg_v_f32m1_mu(even, _c, _c, 4);
+  return vreinterpretq_f32_m128(__riscv_vfmadd_vv_f32m1(_a, _b, c_neg, 4));
+}
+
+FORCE_INLINE __m128d _mm_fmsub_pd(__m128d a, __m128d b, __m128d c) {
+  vfloat64m1_t _a = vreinterpretq_m128d_f64(a);
+  vfloat64m1_t _b = vreinterpretq_m128d_f64(b);
+  vfloat64m1_t _c = vreinterpretq_m128d_f64(c);
+  return vreinterpretq_f64_m128d(__riscv_vfmsub_vv_f64m1(_a, _b, _c, 2));
+}
+
+FORCE_INLINE __m128 _mm_fmsub_ps(__m128 a, __m128 b, __m128 c) {
+  vfloat32m1_t _a = vreinterpretq_m128_f32(a);
+  vfloat32m1_t _b = vreinterpretq_m128_f32(b);
+  vfloat32m1_t _c = vreinterpretq_m128_f32(c);
+  return vreinterpretq_f32_m128(__riscv_vfmsub_vv_f32m1(_a, _b, _c, 4));
+}
+
+FORCE_INLINE __m128d _mm_fmsub_sd(__m128d a, __m128d b, __m128d c) {
+  vfloat64m1_t _a = vreinterpretq_m128d_f64(a);
+  vfloat64m1_t _b = vreinterpretq_m128d_f64(b);
+  vfloat64m1_t _c = vreinterpretq_m128d_f64(c);
+  return vreinterpretq_f64_m128d(__riscv_vfmsub_vv_f64m1_tu(_a, _b, _c, 1));
+}
+
+FORCE_INLINE __m128 _mm_fmsub_ss(__m128 a, __m128 b, __m128 c) {
+  vfloat32m1_t _a = vreinterpretq_m128_f32(a);
+  vfloat32m1_t _b = vreinterpretq_m128_f32(b);
+  vfloat32m1_t _c = vreinterpretq_m128_f32(c);
+  return vreinterpretq_f32_m128(__riscv_vfmsub_vv_f32m1_tu(_a, _b, _c, 1));
+}
+
+FORCE_INLINE __m128d _mm_fmsubadd_pd(__m128d a, __m128d b, __m128d c) {
+  vfloat64m1_t _a = vreinterpretq_m128d_f64(a);
+  vfloat64m1_t _b = vreinterpretq_m128d_f64(b);
+  vfloat64m1_t _c = vreinterpretq_m128d_f64(c);
+  vbool64_t odd = __riscv_vmsne_vx_u64m1_b64(
+      __riscv_vand_vx_u64m1(__riscv_vid_v_u64m1(2), 1, 2), 0, 2);
+  vfloat64m1_t c_neg = __riscv_vfneg_v_f64m1_mu(odd, _c, _c, 2);
+  return vreinterpretq_f64_m128d(__riscv_vfmadd_vv_f64m1(_a, _b, c_neg, 2));
+}
+
+FORCE_INLINE __m128 _mm_fmsubadd_ps(__m128 a, __m128 b, __m128 c) {
+  vfloat32m1_t _a = vreinterpretq_m128_f32(a);
+  vfloat32m1_t _b = vreinterpretq_m128_f32(b);
+  vfloat32m1_t _c = vreinterpretq_m128_f32(c);
+  vbool32_t odd = __riscv_vmsne_vx_u32m1_b32(
+      __riscv_vand_vx_u32m1(__riscv_vid_v_u32m1(4), 1, 4), 0, 4);
+  vfloat32m1_t c_neg = __riscv_vfneg_v_f32m1_mu(odd, _c, _c, 4);
+  return vreinterpretq_f32_m128(__riscv_vfmadd_vv_f32m1(_a, _b, c_neg, 4));
+}
+
+FORCE_INLINE __m128d _mm_fnmadd_pd(__m128d a, __m128d b, __m128d c) {
+  vfloat64m1_t _a = vreinterpretq_m128d_f64(a);
+  vfloat64m1_t _b = vreinterpretq_m128d_f64(b);
+  vfloat64m1_t _c = vreinterpretq_m128d_f64(c);
+  return vreinterpretq_f64_m128d(__riscv_vfnmsub_vv_f64m1(_a, _b, _c, 2));
+}
+
+FORCE_INLINE __m128 _mm_fnmadd_ps(__m128 a, __m128 b, __m128 c) {
+  vfloat32m1_t _a = vreinterpretq_m128_f32(a);
+  vfloat32m1_t _b = vreinterpretq_m128_f32(b);
+  vfloat32m1_t _c = vreinterpretq_m128_f32(c);
+  return vreinterpretq_f32_m128(__riscv_vfnmsub_vv_f32m1(_a, _b, _c, 4));
+}
+
+FORCE_INLINE __m128d _mm_fnmadd_sd(__m128d a, __m128d b, __m128d c) {
+  vfloat64m1_t _a = vreinterpretq_m128d_f64(a);
+  vfloat64m1_t _b = vreinterpretq_m128d_f64(b);
+  vfloat64m1_t _c = vreinterpretq_m128d_f64(c);
+  return vreinterpretq_f64_m128d(__riscv_vfnmsub_vv_f64m1_tu(_a, _b, _c, 1));
+}
+
+FORCE_INLINE __m128 _mm_fnmadd_ss(__m128 a, __m128 b, __m128 c) {
+  vfloat32m1_t _a = vreinterpretq_m128_f32(a);
+  vfloat32m1_t _b = vreinterpretq_m128_f32(b);
+  vfloat32m1_t _c = vreinterpretq_m128_f32(c);
+  return vreinterpretq_f32_m128(__riscv_vfnmsub_vv_f32m1_tu(_a, _b, _c, 1));
+}
+
+FORCE_INLINE __m128d _mm_fnmsub_pd(__m128d a, __m128d b, __m128d c) {
+  vfloat64m1_t _a = vreinterpretq_m128d_f64(a);
+  vfloat64m1_t _b = vreinterpretq_m128d_f64(b);
+  vfloat64m1_t _c = vreinterpretq_m128d_f64(c);
+  return vreinterpretq_f64_m128d(__riscv_vfnmadd_vv_f64m1(_a, _b, _c, 2));
+}
+
+FORCE_INLINE __m128 _mm_fnmsub_ps(__m128 a, __m128 b, __m128 c) {
+  vfloat32m1_t _a = vreinterpretq_m128_f32(a);
+  vfloat32m1_t _b = vreinterpretq_m128_f32(b);
+  vfloat32m1_t _c = vreinterpretq_m128_f32(c);
+  return vreinterpretq_f32_m128(__riscv_vfnmadd_vv_f32m1(_a, _b, _c, 4));
+}
+
+FORCE_INLINE __m128d _mm_fnmsub_sd(__m128d a, __m128d b, __m128d c) {
+  vfloat64m1_t _a = vreinterpretq_m128d_f64(a);
+  vfloat64m1_t _b = vreinterpretq_m128d_f64(b);
+  vfloat64m1_t _c = vreinterpretq_m128d_f64(c);
+  return vreinterpretq_f64_m128d(__riscv_vfnmadd_vv_f64m1_tu(_a, _b, _c, 1));
+}
+
+FORCE_INLINE __m128 _mm_fnmsub_ss(__m128 a, __m128 b, __m128 c) {
+  vfloat32m1_t _a = vreinterpretq_m128_f32(a);
+  vfloat32m1_t _b = vreinterpretq_m128_f32(b);
+  vfloat32m1_t _c = vreinterpretq_m128_f32(c);
+  return vreinterpretq_f32_m128(__riscv_vfnmadd_vv_f32m1_tu(_a, _b, _c, 1));
+}
+
 FORCE_INLINE void _mm_free(void *mem_addr) { free(mem_addr); }
 
 // FORCE_INLINE unsigned int _MM_GET_FLUSH_ZERO_MODE () {}
@@ -2551,8 +3501,31 @@ FORCE_INLINE __m128i _mm_movpi64_epi64(__m64 a) {
   return vreinterpretq_i32_m64(__riscv_vslideup_vx_i32m1_tu(zeros, _a, 0, 2));
 }
 
-// FORCE_INLINE __m128i _mm_mpsadbw_epu8 (__m128i a, __m128i b, const int imm8)
-// {}
+// Compute the sum of absolute differences (SADs) of quadruplets of unsigned
+// 8-bit integers in a compared to those in b, and store the 16-bit results in
+// dst. Eight SADs are performed using one quadruplet from b and eight
+// quadruplets from a. One quadruplet is selected from b starting at on the
+// offset specified in imm8. Eight quadruplets are formed from sequential 8-bit
+// integers selected from a starting at the offset specified in imm8.
+// Byte k of the b quadruplet meets a window of a slid down by k, so four
+// slide/absolute-difference steps accumulate all eight sums at once.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_mm_mpsadbw_epu8
+FORCE_INLINE __m128i _mm_mpsadbw_epu8(__m128i a, __m128i b, const int imm8) {
+  vuint8m1_t _a = vreinterpretq_m128i_u8(a);
+  vuint8m1_t _b = vreinterpretq_m128i_u8(b);
+  const int a_offset = ((imm8 >> 2) & 1) * 4;
+  const int b_offset = (imm8 & 3) * 4;
+  vuint16m1_t sum = __riscv_vmv_v_x_u16m1(0, 8);
+  for (int k = 0; k < 4; k++) {
+    vuint8m1_t x = __riscv_vslidedown_vx_u8m1(_a, a_offset + k, 8);
+    vuint8m1_t y = __riscv_vrgather_vx_u8m1(_b, b_offset + k, 8);
+    vuint8m1_t diff = __riscv_vsub_vv_u8m1(__riscv_vmaxu_vv_u8m1(x, y, 8),
+                                           __riscv_vminu_vv_u8m1(x, y, 8), 8);
+    sum = __riscv_vwaddu_wv_u16m1(sum, __riscv_vlmul_trunc_v_u8m1_u8mf2(diff),
+                                  8);
+  }
+  return vreinterpretq_u16_m128i(sum);
+}
 
 FORCE_INLINE __m128i _mm_mul_epi32(__m128i a, __m128i b) {
   vint64m1_t _a = vreinterpretq_m128i_i64(a);
@@ -3874,62 +4847,819 @@ FORCE_INLINE __m128i _mm_xor_si128(__m128i a, __m128i b) {
 
 /* AES */
 
-// In the absence of crypto extensions, implement aesenc using regular NEON
-// intrinsics instead. See:
-// https://www.workofard.com/2017/01/accelerated-aes-for-the-arm64-linux-kernel/
-// https://www.workofard.com/2017/07/ghash-for-low-end-cores/ and
-// for more information.
-// FORCE_INLINE __m128i _mm_aesenc_si128(__m128i a, __m128i RoundKey) {}
+// With Zvkned every round below is a single vaes* instruction on the 128-bit
+// element group. Otherwise the S-box lives in vector registers: the 256-byte
+// table is split into four 64-byte groups and each state byte is gathered
+// from all of them, so no load address or branch depends on the data and the
+// fallback stays constant time.
+#if !defined(__riscv_zvkned)
+static const uint8_t _sse2rvv_aes_sbox[256] = {
+    0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b,
+    0xfe, 0xd7, 0xab, 0x76, 0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0,
+    0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0, 0xb7, 0xfd, 0x93, 0x26,
+    0x36, 0x3f, 0xf7, 0xcc, 0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15,
+    0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a, 0x07, 0x12, 0x80, 0xe2,
+    0xeb, 0x27, 0xb2, 0x75, 0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0,
+    0x52, 0x3b, 0xd6, 0xb3, 0x29, 0xe3, 0x2f, 0x84, 0x53, 0xd1, 0x00, 0xed,
+    0x20, 0xfc, 0xb1, 0x5b, 0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf,
+    0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85, 0x45, 0xf9, 0x02, 0x7f,
+    0x50, 0x3c, 0x9f, 0xa8, 0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5,
+    0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2, 0xcd, 0x0c, 0x13, 0xec,
+    0x5f, 0x97, 0x44, 0x17, 0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73,
+    0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90, 0x88, 0x46, 0xee, 0xb8, 0x14,
+    0xde, 0x5e, 0x0b, 0xdb, 0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c,
+    0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4, 0x79, 0xe7, 0xc8, 0x37, 0x6d,
+    0x8d, 0xd5, 0x4e, 0xa9, 0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08,
+    0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4, 0xc6, 0xe8, 0xdd, 0x74, 0x1f,
+    0x4b, 0xbd, 0x8b, 0x8a, 0x70, 0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e,
+    0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e, 0xe1, 0xf8, 0x98, 0x11,
+    0x69, 0xd9, 0x8e, 0x94, 0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf,
+    0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68, 0x41, 0x99, 0x2d, 0x0f,
+    0xb0, 0x54, 0xbb, 0x16,
+};
+
+static const uint8_t _sse2rvv_aes_rsbox[256] = {
+    0x52, 0x09, 0x6a, 0xd5, 0x30, 0x36, 0xa5, 0x38, 0xbf, 0x40, 0xa3, 0x9e,
+    0x81, 0xf3, 0xd7, 0xfb, 0x7c, 0xe3, 0x39, 0x82, 0x9b, 0x2f, 0xff, 0x87,
+    0x34, 0x8e, 0x43, 0x44, 0xc4, 0xde, 0xe9, 0xcb, 0x54, 0x7b, 0x94, 0x32,
+    0xa6, 0xc2, 0x23, 0x3d, 0xee, 0x4c, 0x95, 0x0b, 0x42, 0xfa, 0xc3, 0x4e,
+    0x08, 0x2e, 0xa1, 0x66, 0x28, 0xd9, 0x24, 0xb2, 0x76, 0x5b, 0xa2, 0x49,
+    0x6d, 0x8b, 0xd1, 0x25, 0x72, 0xf8, 0xf6, 0x64, 0x86, 0x68, 0x98, 0x16,
+    0xd4, 0xa4, 0x5c, 0xcc, 0x5d, 0x65, 0xb6, 0x92, 0x6c, 0x70, 0x48, 0x50,
+    0xfd, 0xed, 0xb9, 0xda, 0x5e, 0x15, 0x46, 0x57, 0xa7, 0x8d, 0x9d, 0x84,
+    0x90, 0xd8, 0xab, 0x00, 0x8c, 0xbc, 0xd3, 0x0a, 0xf7, 0xe4, 0x58, 0x05,
+    0xb8, 0xb3, 0x45, 0x06, 0xd0, 0x2c, 0x1e, 0x8f, 0xca, 0x3f, 0x0f, 0x02,
+    0xc1, 0xaf, 0xbd, 0x03, 0x01, 0x13, 0x8a, 0x6b, 0x3a, 0x91, 0x11, 0x41,
+    0x4f, 0x67, 0xdc, 0xea, 0x97, 0xf2, 0xcf, 0xce, 0xf0, 0xb4, 0xe6, 0x73,
+    0x96, 0xac, 0x74, 0x22, 0xe7, 0xad, 0x35, 0x85, 0xe2, 0xf9, 0x37, 0xe8,
+    0x1c, 0x75, 0xdf, 0x6e, 0x47, 0xf1, 0x1a, 0x71, 0x1d, 0x29, 0xc5, 0x89,
+    0x6f, 0xb7, 0x62, 0x0e, 0xaa, 0x18, 0xbe, 0x1b, 0xfc, 0x56, 0x3e, 0x4b,
+    0xc6, 0xd2, 0x79, 0x20, 0x9a, 0xdb, 0xc0, 0xfe, 0x78, 0xcd, 0x5a, 0xf4,
+    0x1f, 0xdd, 0xa8, 0x33, 0x88, 0x07, 0xc7, 0x31, 0xb1, 0x12, 0x10, 0x59,
+    0x27, 0x80, 0xec, 0x5f, 0x60, 0x51, 0x7f, 0xa9, 0x19, 0xb5, 0x4a, 0x0d,
+    0x2d, 0xe5, 0x7a, 0x9f, 0x93, 0xc9, 0x9c, 0xef, 0xa0, 0xe0, 0x3b, 0x4d,
+    0xae, 0x2a, 0xf5, 0xb0, 0xc8, 0xeb, 0xbb, 0x3c, 0x83, 0x53, 0x99, 0x61,
+    0x17, 0x2b, 0x04, 0x7e, 0xba, 0x77, 0xd6, 0x26, 0xe1, 0x69, 0x14, 0x63,
+    0x55, 0x21, 0x0c, 0x7d,
+};
+
+static const uint8_t _sse2rvv_aes_shift_rows[16] = {
+    0, 5, 10, 15, 4, 9, 14, 3, 8, 13, 2, 7, 12, 1, 6, 11,
+};
+
+static const uint8_t _sse2rvv_aes_inv_shift_rows[16] = {
+    0, 13, 10, 7, 4, 1, 14, 11, 8, 5, 2, 15, 12, 9, 6, 3,
+};
+
+FORCE_INLINE vuint8m1_t _sse2rvv_aes_lookup(const uint8_t *table,
+                                            vuint8m1_t x) {
+  vuint8m4_t idx =
+      __riscv_vlmul_ext_v_u8m1_u8m4(__riscv_vand_vx_u8m1(x, 63, 16));
+  vuint8m1_t quarter = __riscv_vsrl_vx_u8m1(x, 6, 16);
+  vuint8m1_t r = __riscv_vmv_v_x_u8m1(0, 16);
+  for (int q = 0; q < 4; q++) {
+    vuint8m4_t t = __riscv_vle8_v_u8m4(table + 64 * q, 64);
+    vuint8m1_t g = __riscv_vlmul_trunc_v_u8m4_u8m1(
+        __riscv_vrgather_vv_u8m4(t, idx, 16));
+    vbool8_t m = __riscv_vmseq_vx_u8m1_b8(quarter, q, 16);
+    r = __riscv_vmerge_vvm_u8m1(r, g, m, 16);
+  }
+  return r;
+}
+
+FORCE_INLINE vuint8m1_t _sse2rvv_aes_permute(vuint8m1_t x,
+                                             const uint8_t *idx) {
+  return __riscv_vrgather_vv_u8m1(x, __riscv_vle8_v_u8m1(idx, 16), 16);
+}
+
+// Multiply every byte by x in GF(2^8)
+FORCE_INLINE vuint8m1_t _sse2rvv_aes_xtime(vuint8m1_t x) {
+  vuint8m1_t hi = __riscv_vsrl_vx_u8m1(x, 7, 16);
+  return __riscv_vxor_vv_u8m1(__riscv_vsll_vx_u8m1(x, 1, 16),
+                              __riscv_vmul_vx_u8m1(hi, 0x1b, 16), 16);
+}
+
+FORCE_INLINE vuint32m1_t _sse2rvv_aes_rotr(vuint32m1_t w, int n) {
+  return __riscv_vor_vv_u32m1(__riscv_vsrl_vx_u32m1(w, n, 4),
+                              __riscv_vsll_vx_u32m1(w, 32 - n, 4), 4);
+}
+
+// Each column is one little-endian 32-bit word, so the rotations of the
+// column in MixColumns are word rotations by multiples of 8 bits.
+FORCE_INLINE vuint8m1_t _sse2rvv_aes_mix_columns(vuint8m1_t x) {
+  vuint32m1_t w = __riscv_vreinterpret_v_u8m1_u32m1(x);
+  vuint32m1_t r =
+      __riscv_vreinterpret_v_u8m1_u32m1(_sse2rvv_aes_xtime(x));
+  r = __riscv_vxor_vv_u32m1(
+      r, _sse2rvv_aes_rotr(__riscv_vxor_vv_u32m1(w, r, 4), 8), 4);
+  r = __riscv_vxor_vv_u32m1(r, _sse2rvv_aes_rotr(w, 16), 4);
+  r = __riscv_vxor_vv_u32m1(r, _sse2rvv_aes_rotr(w, 24), 4);
+  return __riscv_vreinterpret_v_u32m1_u8m1(r);
+}
+
+// InvMixColumns is MixColumns after adding 4*(a0^a2) to rows 0 and 2 and
+// 4*(a1^a3) to rows 1 and 3 of every column.
+FORCE_INLINE vuint8m1_t _sse2rvv_aes_inv_mix_columns(vuint8m1_t x) {
+  vuint32m1_t w = __riscv_vreinterpret_v_u8m1_u32m1(x);
+  vuint8m1_t t = __riscv_vreinterpret_v_u32m1_u8m1(
+      __riscv_vxor_vv_u32m1(w, _sse2rvv_aes_rotr(w, 16), 4));
+  vuint8m1_t uv = _sse2rvv_aes_xtime(_sse2rvv_aes_xtime(t));
+  return _sse2rvv_aes_mix_columns(__riscv_vxor_vv_u8m1(x, uv, 16));
+}
+#endif
+
+// Perform one round of an AES encryption flow on data (state) in a using the
+// round key in RoundKey, and store the result in dst.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_mm_aesenc_si128
+FORCE_INLINE __m128i _mm_aesenc_si128(__m128i a, __m128i RoundKey) {
+#if defined(__riscv_zvkned)
+  vuint32m1_t _a = vreinterpretq_m128i_u32(a);
+  vuint32m1_t _k = vreinterpretq_m128i_u32(RoundKey);
+  return vreinterpretq_u32_m128i(__riscv_vaesem_vv_u32m1(_a, _k, 4));
+#else
+  vuint8m1_t s = _sse2rvv_aes_permute(vreinterpretq_m128i_u8(a),
+                                      _sse2rvv_aes_shift_rows);
+  s = _sse2rvv_aes_mix_columns(_sse2rvv_aes_lookup(_sse2rvv_aes_sbox, s));
+  vuint8m1_t _k = vreinterpretq_m128i_u8(RoundKey);
+  return vreinterpretq_u8_m128i(__riscv_vxor_vv_u8m1(s, _k, 16));
+#endif
+}
 
 // Perform one round of an AES decryption flow on data (state) in a using the
 // round key in RoundKey, and store the result in dst.
 // https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_mm_aesdec_si128
-// FORCE_INLINE __m128i _mm_aesdec_si128(__m128i a, __m128i RoundKey) {}
+FORCE_INLINE __m128i _mm_aesdec_si128(__m128i a, __m128i RoundKey) {
+#if defined(__riscv_zvkned)
+  // vaesdm adds the round key before InvMixColumns, x86 after it
+  vuint32m1_t _a = vreinterpretq_m128i_u32(a);
+  vuint32m1_t _k = vreinterpretq_m128i_u32(RoundKey);
+  vuint32m1_t zero = __riscv_vmv_v_x_u32m1(0, 4);
+  return vreinterpretq_u32_m128i(
+      __riscv_vxor_vv_u32m1(__riscv_vaesdm_vv_u32m1(_a, zero, 4), _k, 4));
+#else
+  vuint8m1_t s = _sse2rvv_aes_permute(vreinterpretq_m128i_u8(a),
+                                      _sse2rvv_aes_inv_shift_rows);
+  s = _sse2rvv_aes_inv_mix_columns(_sse2rvv_aes_lookup(_sse2rvv_aes_rsbox, s));
+  vuint8m1_t _k = vreinterpretq_m128i_u8(RoundKey);
+  return vreinterpretq_u8_m128i(__riscv_vxor_vv_u8m1(s, _k, 16));
+#endif
+}
 
 // Perform the last round of an AES encryption flow on data (state) in a using
 // the round key in RoundKey, and store the result in dst.
 // https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_mm_aesenclast_si128
-// FORCE_INLINE __m128i _mm_aesenclast_si128(__m128i a, __m128i RoundKey) {}
+FORCE_INLINE __m128i _mm_aesenclast_si128(__m128i a, __m128i RoundKey) {
+#if defined(__riscv_zvkned)
+  vuint32m1_t _a = vreinterpretq_m128i_u32(a);
+  vuint32m1_t _k = vreinterpretq_m128i_u32(RoundKey);
+  return vreinterpretq_u32_m128i(__riscv_vaesef_vv_u32m1(_a, _k, 4));
+#else
+  vuint8m1_t s = _sse2rvv_aes_permute(vreinterpretq_m128i_u8(a),
+                                      _sse2rvv_aes_shift_rows);
+  s = _sse2rvv_aes_lookup(_sse2rvv_aes_sbox, s);
+  vuint8m1_t _k = vreinterpretq_m128i_u8(RoundKey);
+  return vreinterpretq_u8_m128i(__riscv_vxor_vv_u8m1(s, _k, 16));
+#endif
+}
 
 // Perform the last round of an AES decryption flow on data (state) in a using
 // the round key in RoundKey, and store the result in dst.
 // https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_mm_aesdeclast_si128
-// FORCE_INLINE __m128i _mm_aesdeclast_si128(__m128i a, __m128i RoundKey) {}
+FORCE_INLINE __m128i _mm_aesdeclast_si128(__m128i a, __m128i RoundKey) {
+#if defined(__riscv_zvkned)
+  vuint32m1_t _a = vreinterpretq_m128i_u32(a);
+  vuint32m1_t _k = vreinterpretq_m128i_u32(RoundKey);
+  return vreinterpretq_u32_m128i(__riscv_vaesdf_vv_u32m1(_a, _k, 4));
+#else
+  vuint8m1_t s = _sse2rvv_aes_permute(vreinterpretq_m128i_u8(a),
+                                      _sse2rvv_aes_inv_shift_rows);
+  s = _sse2rvv_aes_lookup(_sse2rvv_aes_rsbox, s);
+  vuint8m1_t _k = vreinterpretq_m128i_u8(RoundKey);
+  return vreinterpretq_u8_m128i(__riscv_vxor_vv_u8m1(s, _k, 16));
+#endif
+}
 
 // Perform the InvMixColumns transformation on a and store the result in dst.
 // https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_mm_aesimc_si128
-// FORCE_INLINE __m128i _mm_aesimc_si128(__m128i a) {}
+FORCE_INLINE __m128i _mm_aesimc_si128(__m128i a) {
+#if defined(__riscv_zvkned)
+  // vaesdm undoes the SubBytes and ShiftRows that vaesef applies, leaving
+  // only its InvMixColumns
+  vuint32m1_t _a = vreinterpretq_m128i_u32(a);
+  vuint32m1_t zero = __riscv_vmv_v_x_u32m1(0, 4);
+  vuint32m1_t s = __riscv_vaesef_vv_u32m1(_a, zero, 4);
+  return vreinterpretq_u32_m128i(__riscv_vaesdm_vv_u32m1(s, zero, 4));
+#else
+  return vreinterpretq_u8_m128i(
+      _sse2rvv_aes_inv_mix_columns(vreinterpretq_m128i_u8(a)));
+#endif
+}
 
 // Assist in expanding the AES cipher key by computing steps towards generating
 // a round key for encryption cipher using data from a and an 8-bit round
 // constant specified in imm8, and store the result in dst.
 // https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_mm_aeskeygenassist_si128
-//
-// Emits the Advanced Encryption Standard (AES) instruction aeskeygenassist.
-// This instruction generates a round key for AES encryption. See
-// https://kazakov.life/2017/11/01/cryptocurrency-mining-on-ios-devices/
-// for details.
-// FORCE_INLINE __m128i _mm_aeskeygenassist_si128(__m128i a, const int rcon) {}
+FORCE_INLINE __m128i _mm_aeskeygenassist_si128(__m128i a, const int rcon) {
+  uint32_t r[4] = {0, (uint32_t)rcon, 0, (uint32_t)rcon};
+#if defined(__riscv_zvkned)
+  // SubWord and RotWord of words 1 and 3, picked from ShiftRows(SubBytes(a))
+  uint8_t idx[16] = {4, 1, 14, 11, 1, 14, 11, 4, 12, 9, 6, 3, 9, 6, 3, 12};
+  vuint32m1_t zero = __riscv_vmv_v_x_u32m1(0, 4);
+  vuint8m1_t s = __riscv_vreinterpret_v_u32m1_u8m1(
+      __riscv_vaesef_vv_u32m1(vreinterpretq_m128i_u32(a), zero, 4));
+#else
+  uint8_t idx[16] = {4, 5, 6, 7, 5, 6, 7, 4, 12, 13, 14, 15, 13, 14, 15, 12};
+  vuint8m1_t s =
+      _sse2rvv_aes_lookup(_sse2rvv_aes_sbox, vreinterpretq_m128i_u8(a));
+#endif
+  s = __riscv_vrgather_vv_u8m1(s, __riscv_vle8_v_u8m1(idx, 16), 16);
+  vuint32m1_t w = __riscv_vreinterpret_v_u8m1_u32m1(s);
+  return vreinterpretq_u32_m128i(
+      __riscv_vxor_vv_u32m1(w, __riscv_vle32_v_u32m1(r, 4), 4));
+}
+
+/* SHA */
+
+// With Zvknha, vsha2cl takes {A, B, E, F} and {C, D, G, H} in the same
+// element order as sha256rnds2, so two SHA-256 rounds are one instruction.
+// vsha2ms fuses both message-schedule steps, which SHA-NI splits into msg1
+// and msg2 with an add of W[t-7] in between, so those stay as vector shifts
+// and rotates (vror with Zvbb). SHA-1 has no vector-crypto instructions: its
+// message steps are vector ops, and the sequential rounds run on scalars,
+// where Zbb turns the rotates into single instructions.
+FORCE_INLINE uint32_t _sse2rvv_rotr32(uint32_t x, int n) {
+  return (x >> n) | (x << (32 - n));
+}
+
+FORCE_INLINE vuint32m1_t _sse2rvv_vror_u32(vuint32m1_t x, int n) {
+#if defined(__riscv_zvbb)
+  return __riscv_vror_vx_u32m1(x, n, 4);
+#else
+  return __riscv_vor_vv_u32m1(__riscv_vsrl_vx_u32m1(x, n, 4),
+                              __riscv_vsll_vx_u32m1(x, 32 - n, 4), 4);
+#endif
+}
+
+// Perform an intermediate calculation for the next four SHA1 message values
+// (unsigned 32-bit integers) using previous message values from a and b, and
+// store the result in dst.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_mm_sha1msg1_epu32
+FORCE_INLINE __m128i _mm_sha1msg1_epu32(__m128i a, __m128i b) {
+  vuint32m1_t _a = vreinterpretq_m128i_u32(a);
+  vuint32m1_t _b = vreinterpretq_m128i_u32(b);
+  // {b2, b3, a0, a1}: W[t+2] for each W[t] of a
+  vuint32m1_t w2 = __riscv_vslideup_vx_u32m1(
+      __riscv_vslidedown_vx_u32m1(_b, 2, 4), _a, 2, 4);
+  return vreinterpretq_u32_m128i(__riscv_vxor_vv_u32m1(_a, w2, 4));
+}
+
+// Perform the final calculation for the next four SHA1 message values
+// (unsigned 32-bit integers) using the intermediate result in a and the
+// previous message values in b, and store the result in dst.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_mm_sha1msg2_epu32
+FORCE_INLINE __m128i _mm_sha1msg2_epu32(__m128i a, __m128i b) {
+  vuint32m1_t _a = vreinterpretq_m128i_u32(a);
+  vuint32m1_t _b = vreinterpretq_m128i_u32(b);
+  // W16..W18 in lanes 3..1 only need b; W19 in lane 0 needs W16
+  vuint32m1_t w = _sse2rvv_vror_u32(
+      __riscv_vxor_vv_u32m1(_a, __riscv_vslide1up_vx_u32m1(_b, 0, 4), 4), 31);
+  vuint32m1_t w16 = __riscv_vslidedown_vx_u32m1(w, 3, 4);
+  vuint32m1_t w19 = _sse2rvv_vror_u32(__riscv_vxor_vv_u32m1(_a, w16, 4), 31);
+  return vreinterpretq_u32_m128i(__riscv_vslideup_vx_u32m1_tu(w, w19, 0, 1));
+}
+
+// Calculate SHA1 state variable E after four rounds of operation from the
+// current SHA1 state variable a, add that value to the scheduled values
+// (unsigned 32-bit integers) in b, and store the result in dst.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_mm_sha1nexte_epu32
+FORCE_INLINE __m128i _mm_sha1nexte_epu32(__m128i a, __m128i b) {
+  vuint32m1_t _a = vreinterpretq_m128i_u32(a);
+  vuint32m1_t _b = vreinterpretq_m128i_u32(b);
+  vbool32_t lane3 =
+      __riscv_vreinterpret_v_u8m1_b32(__riscv_vmv_s_x_u8m1(8, 4));
+  return vreinterpretq_u32_m128i(
+      __riscv_vadd_vv_u32m1_mu(lane3, _b, _b, _sse2rvv_vror_u32(_a, 2), 4));
+}
+
+// Perform four rounds of SHA1 operation using an initial SHA1 state (A,B,C,D)
+// from a and some pre-computed sum of the next 4 round message values
+// (unsigned 32-bit integers), and state variable E from b, and store the
+// updated SHA1 state (A,B,C,D) in dst. func contains the logic functions and
+// round constants.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_mm_sha1rnds4_epu32
+FORCE_INLINE __m128i _mm_sha1rnds4_epu32(__m128i a, __m128i b,
+                                         const int func) {
+  static const uint32_t k[4] = {0x5a827999, 0x6ed9eba1, 0x8f1bbcdc,
+                                0xca62c1d6};
+  uint32_t s[4], w[4];
+  __riscv_vse32_v_u32m1(s, vreinterpretq_m128i_u32(a), 4);
+  __riscv_vse32_v_u32m1(w, vreinterpretq_m128i_u32(b), 4);
+  uint32_t A = s[3], B = s[2], C = s[1], D = s[0], E = 0;
+  for (int i = 0; i < 4; i++) {
+    uint32_t f;
+    if ((func & 3) == 0)
+      f = (B & C) ^ (~B & D);
+    else if ((func & 3) == 2)
+      f = (B & C) ^ (B & D) ^ (C & D);
+    else
+      f = B ^ C ^ D;
+    uint32_t t = f + _sse2rvv_rotr32(A, 27) + w[3 - i] + E + k[func & 3];
+    E = D;
+    D = C;
+    C = _sse2rvv_rotr32(B, 2);
+    B = A;
+    A = t;
+  }
+  uint32_t r[4] = {D, C, B, A};
+  return vreinterpretq_u32_m128i(__riscv_vle32_v_u32m1(r, 4));
+}
+
+// Perform an intermediate calculation for the next four SHA256 message values
+// (unsigned 32-bit integers) using previous message values from a and b, and
+// store the result in dst.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_mm_sha256msg1_epu32
+FORCE_INLINE __m128i _mm_sha256msg1_epu32(__m128i a, __m128i b) {
+  vuint32m1_t _a = vreinterpretq_m128i_u32(a);
+  vuint32m1_t _b = vreinterpretq_m128i_u32(b);
+  // {a1, a2, a3, b0}: W[t+1] for each W[t] of a
+  vuint32m1_t w1 = __riscv_vslideup_vx_u32m1(
+      __riscv_vslidedown_vx_u32m1(_a, 1, 4), _b, 3, 4);
+  vuint32m1_t s0 = __riscv_vxor_vv_u32m1(
+      __riscv_vxor_vv_u32m1(_sse2rvv_vror_u32(w1, 7),
+                            _sse2rvv_vror_u32(w1, 18), 4),
+      __riscv_vsrl_vx_u32m1(w1, 3, 4), 4);
+  return vreinterpretq_u32_m128i(__riscv_vadd_vv_u32m1(_a, s0, 4));
+}
+
+FORCE_INLINE vuint32m1_t _sse2rvv_sha256_sigma1(vuint32m1_t x) {
+  return __riscv_vxor_vv_u32m1(
+      __riscv_vxor_vv_u32m1(_sse2rvv_vror_u32(x, 17),
+                            _sse2rvv_vror_u32(x, 19), 4),
+      __riscv_vsrl_vx_u32m1(x, 10, 4), 4);
+}
+
+// Perform the final calculation for the next four SHA256 message values
+// (unsigned 32-bit integers) using previous message values from a and b, and
+// store the result in dst.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_mm_sha256msg2_epu32
+FORCE_INLINE __m128i _mm_sha256msg2_epu32(__m128i a, __m128i b) {
+  vuint32m1_t _a = vreinterpretq_m128i_u32(a);
+  vuint32m1_t _b = vreinterpretq_m128i_u32(b);
+  // W16 and W17 need W14 and W15 from b; W18 and W19 need W16 and W17
+  vuint32m1_t lo = __riscv_vadd_vv_u32m1(
+      _a, _sse2rvv_sha256_sigma1(__riscv_vslidedown_vx_u32m1(_b, 2, 4)), 4);
+  vuint32m1_t hi = __riscv_vadd_vv_u32m1(
+      _a, _sse2rvv_sha256_sigma1(__riscv_vslideup_vx_u32m1(lo, lo, 2, 4)), 4);
+  return vreinterpretq_u32_m128i(__riscv_vslideup_vx_u32m1(
+      lo, __riscv_vslidedown_vx_u32m1(hi, 2, 4), 2, 4));
+}
+
+// Perform 2 rounds of SHA256 operation using an initial SHA256 state
+// (C,D,G,H) from a, an initial SHA256 state (A,B,E,F) from b, and a
+// pre-computed sum of the next 2 round message values (unsigned 32-bit
+// integers) and the corresponding round constants from k, and store the
+// updated SHA256 state (A,B,E,F) in dst.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_mm_sha256rnds2_epu32
+FORCE_INLINE __m128i _mm_sha256rnds2_epu32(__m128i a, __m128i b, __m128i k) {
+#if defined(__riscv_zvknha) || defined(__riscv_zvknhb)
+  return vreinterpretq_u32_m128i(__riscv_vsha2cl_vv_u32m1(
+      vreinterpretq_m128i_u32(a), vreinterpretq_m128i_u32(b),
+      vreinterpretq_m128i_u32(k), 4));
+#else
+  uint32_t s0[4], s1[4], w[4];
+  __riscv_vse32_v_u32m1(s0, vreinterpretq_m128i_u32(a), 4);
+  __riscv_vse32_v_u32m1(s1, vreinterpretq_m128i_u32(b), 4);
+  __riscv_vse32_v_u32m1(w, vreinterpretq_m128i_u32(k), 4);
+  uint32_t A = s1[3], B = s1[2], C = s0[3], D = s0[2];
+  uint32_t E = s1[1], F = s1[0], G = s0[1], H = s0[0];
+  for (int i = 0; i < 2; i++) {
+    uint32_t t1 = H + w[i] + ((E & F) ^ (~E & G)) +
+                  (_sse2rvv_rotr32(E, 6) ^ _sse2rvv_rotr32(E, 11) ^
+                   _sse2rvv_rotr32(E, 25));
+    uint32_t t2 = ((A & B) ^ (A & C) ^ (B & C)) +
+                  (_sse2rvv_rotr32(A, 2) ^ _sse2rvv_rotr32(A, 13) ^
+                   _sse2rvv_rotr32(A, 22));
+    H = G;
+    G = F;
+    F = E;
+    E = D + t1;
+    D = C;
+    C = B;
+    B = A;
+    A = t1 + t2;
+  }
+  uint32_t r[4] = {F, E, B, A};
+  return vreinterpretq_u32_m128i(__riscv_vle32_v_u32m1(r, 4));
+#endif
+}
+
+/* F16C */
+
+// With Zvfhmin both directions are a single vfwcvt/vfncvt. RISC-V returns the
+// canonical NaN from these conversions where x86 keeps the sign and payload
+// of a quieted NaN; everything else matches. Without Zvfhmin the conversions
+// are integer bit manipulation on 32-bit lanes.
+#if !defined(__riscv_zvfhmin) && !defined(__riscv_zvfh)
+// Half-precision bits (one per 32-bit lane) to single precision. Moving the
+// exponent and mantissa into place and multiplying by 2^112 rebiases normal
+// and denormal inputs exactly; infinities and NaNs are rebiased directly,
+// with NaNs quieted as on x86.
+FORCE_INLINE vfloat32m1_t _sse2rvv_cvtph_ps(vuint32m1_t h) {
+  vuint32m1_t o = __riscv_vsll_vx_u32m1(__riscv_vand_vx_u32m1(h, 0x7fff, 4),
+                                        13, 4);
+  vfloat32m1_t scale =
+      __riscv_vreinterpret_v_u32m1_f32m1(__riscv_vmv_v_x_u32m1(0x77800000, 4));
+  vuint32m1_t r = __riscv_vreinterpret_v_f32m1_u32m1(__riscv_vfmul_vv_f32m1(
+      __riscv_vreinterpret_v_u32m1_f32m1(o), scale, 4));
+  vbool32_t inf_nan = __riscv_vmsgeu_vx_u32m1_b32(o, 0x0f800000, 4);
+  vbool32_t nan = __riscv_vmsgtu_vx_u32m1_b32(o, 0x0f800000, 4);
+  vuint32m1_t special = __riscv_vadd_vx_u32m1(o, 0x70000000, 4);
+  special = __riscv_vor_vx_u32m1_mu(nan, special, special, 0x00400000, 4);
+  r = __riscv_vmerge_vvm_u32m1(r, special, inf_nan, 4);
+  vuint32m1_t sign = __riscv_vsll_vx_u32m1(
+      __riscv_vand_vx_u32m1(h, 0x8000, 4), 16, 4);
+  return __riscv_vreinterpret_v_u32m1_f32m1(__riscv_vor_vv_u32m1(r, sign, 4));
+}
+
+// Single precision to half-precision bits (one per 32-bit lane), rounded as
+// frm says. Normal results rebias the exponent and drop 13 mantissa bits,
+// denormal results shift the mantissa (with its implicit bit) right by up to
+// 31, and both round on the bits shifted out. A carry out of the mantissa
+// bumps the exponent, up to infinity. Larger magnitudes saturate to infinity
+// or the largest finite half depending on the rounding direction.
+FORCE_INLINE vuint32m1_t _sse2rvv_cvtps_ph(vuint32m1_t f, int frm) {
+  vuint32m1_t mag = __riscv_vand_vx_u32m1(f, 0x7fffffff, 4);
+  vbool32_t neg = __riscv_vmsgtu_vx_u32m1_b32(f, 0x7fffffff, 4);
+  vuint32m1_t e = __riscv_vsrl_vx_u32m1(mag, 23, 4);
+  vbool32_t denorm = __riscv_vmsltu_vx_u32m1_b32(mag, 113u << 23, 4);
+  vuint32m1_t m = __riscv_vand_vx_u32m1(mag, 0x7fffff, 4);
+  m = __riscv_vor_vx_u32m1_mu(__riscv_vmsne_vx_u32m1_b32(e, 0, 4), m, m,
+                              0x800000, 4);
+  vuint32m1_t src = __riscv_vmerge_vvm_u32m1(
+      __riscv_vsub_vx_u32m1(mag, 112u << 23, 4), m, denorm, 4);
+  vuint32m1_t sh = __riscv_vmerge_vvm_u32m1(
+      __riscv_vmv_v_x_u32m1(13, 4),
+      __riscv_vminu_vx_u32m1(__riscv_vrsub_vx_u32m1(e, 126, 4), 31, 4), denorm,
+      4);
+  vuint32m1_t o = __riscv_vsrl_vv_u32m1(src, sh, 4);
+  vuint32m1_t unit = __riscv_vsll_vv_u32m1(__riscv_vmv_v_x_u32m1(1, 4), sh, 4);
+  vuint32m1_t rem =
+      __riscv_vand_vv_u32m1(src, __riscv_vsub_vx_u32m1(unit, 1, 4), 4);
+  vbool32_t inexact = __riscv_vmsne_vx_u32m1_b32(rem, 0, 4);
+  // past the largest half: infinity when rounding away, 0x7bff otherwise
+  vuint32m1_t big = __riscv_vmv_v_x_u32m1(0x7bff, 4);
+  switch (frm) {
+  case __RISCV_FRM_RTZ:
+    break;
+  case __RISCV_FRM_RDN:
+    o = __riscv_vadd_vx_u32m1_mu(__riscv_vmand_mm_b32(inexact, neg, 4), o, o,
+                                 1, 4);
+    big = __riscv_vadd_vx_u32m1_mu(neg, big, big, 1, 4);
+    break;
+  case __RISCV_FRM_RUP:
+    o = __riscv_vadd_vx_u32m1_mu(__riscv_vmandn_mm_b32(inexact, neg, 4), o, o,
+                                 1, 4);
+    big = __riscv_vadd_vx_u32m1_mu(__riscv_vmnot_m_b32(neg, 4), big, big, 1, 4);
+    break;
+  default:
+    // ties to even: rem + (o & 1) exceeds half exactly when rounding up
+    o = __riscv_vadd_vx_u32m1_mu(
+        __riscv_vmsgtu_vv_u32m1_b32(
+            __riscv_vadd_vv_u32m1(rem, __riscv_vand_vx_u32m1(o, 1, 4), 4),
+            __riscv_vsrl_vx_u32m1(unit, 1, 4), 4),
+        o, o, 1, 4);
+    big = __riscv_vadd_vx_u32m1(big, 1, 4);
+    break;
+  }
+  o = __riscv_vmerge_vvm_u32m1(
+      o, big, __riscv_vmsgeu_vx_u32m1_b32(mag, 143u << 23, 4), 4);
+  o = __riscv_vmerge_vxm_u32m1(
+      o, 0x7c00, __riscv_vmseq_vx_u32m1_b32(mag, 0x7f800000, 4), 4);
+  vuint32m1_t nan = __riscv_vor_vx_u32m1(
+      __riscv_vand_vx_u32m1(__riscv_vsrl_vx_u32m1(mag, 13, 4), 0x3ff, 4),
+      0x7e00, 4);
+  o = __riscv_vmerge_vvm_u32m1(
+      o, nan, __riscv_vmsgtu_vx_u32m1_b32(mag, 0x7f800000, 4), 4);
+  return __riscv_vor_vv_u32m1(
+      o, __riscv_vand_vx_u32m1(__riscv_vsrl_vx_u32m1(f, 16, 4), 0x8000, 4), 4);
+}
+#endif
+
+// Convert packed half-precision (16-bit) floating-point elements in a to
+// packed single-precision (32-bit) floating-point elements, and store the
+// results in dst.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_mm_cvtph_ps
+FORCE_INLINE __m128 _mm_cvtph_ps(__m128i a) {
+  vuint16mf2_t h =
+      __riscv_vlmul_trunc_v_u16m1_u16mf2(vreinterpretq_m128i_u16(a));
+#if defined(__riscv_zvfhmin) || defined(__riscv_zvfh)
+  return vreinterpretq_f32_m128(
+      __riscv_vfwcvt_f_f_v_f32m1(__riscv_vreinterpret_v_u16mf2_f16mf2(h), 4));
+#else
+  return vreinterpretq_f32_m128(
+      _sse2rvv_cvtph_ps(__riscv_vzext_vf2_u32m1(h, 4)));
+#endif
+}
+
+// Convert packed single-precision (32-bit) floating-point elements in a to
+// packed half-precision (16-bit) floating-point elements, and store the
+// results in dst. Rounding is done according to the imm8[2:0] parameter.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_mm_cvtps_ph
+FORCE_INLINE __m128i _mm_cvtps_ph(__m128 a, const int imm8) {
+  vfloat32m1_t _a = vreinterpretq_m128_f32(a);
+  vuint16mf2_t h;
+#if defined(__riscv_zvfhmin) || defined(__riscv_zvfh)
+  vfloat16mf2_t r;
+  switch (imm8 & 7) {
+  case _MM_FROUND_TO_NEAREST_INT:
+    r = __riscv_vfncvt_f_f_w_f16mf2_rm(_a, __RISCV_FRM_RNE, 4);
+    break;
+  case _MM_FROUND_TO_NEG_INF:
+    r = __riscv_vfncvt_f_f_w_f16mf2_rm(_a, __RISCV_FRM_RDN, 4);
+    break;
+  case _MM_FROUND_TO_POS_INF:
+    r = __riscv_vfncvt_f_f_w_f16mf2_rm(_a, __RISCV_FRM_RUP, 4);
+    break;
+  case _MM_FROUND_TO_ZERO:
+    r = __riscv_vfncvt_f_f_w_f16mf2_rm(_a, __RISCV_FRM_RTZ, 4);
+    break;
+  default: //_MM_FROUND_CUR_DIRECTION
+    r = __riscv_vfncvt_f_f_w_f16mf2(_a, 4);
+    break;
+  }
+  h = __riscv_vreinterpret_v_f16mf2_u16mf2(r);
+#else
+  static const int frm[4] = {__RISCV_FRM_RNE, __RISCV_FRM_RDN, __RISCV_FRM_RUP,
+                             __RISCV_FRM_RTZ};
+  union {
+    fcsr_bitfield field;
+    uint32_t value;
+  } fcsr;
+  if (imm8 & _MM_FROUND_CUR_DIRECTION)
+    __asm__ volatile("csrr %0, fcsr" : "=r"(fcsr));
+  else
+    fcsr.field.frm = frm[imm8 & 3];
+  vuint32m1_t r = _sse2rvv_cvtps_ph(__riscv_vreinterpret_v_f32m1_u32m1(_a),
+                                    fcsr.field.frm);
+  h = __riscv_vncvt_x_x_w_u16mf2(r, 4);
+#endif
+  vuint16m1_t zeros = __riscv_vmv_v_x_u16m1(0, 8);
+  return vreinterpretq_u16_m128i(__riscv_vslideup_vx_u16m1_tu(
+      zeros, __riscv_vlmul_ext_v_u16mf2_u16m1(h), 0, 4));
+}
+
+/* LZCNT, BMI1, BMI2 */
+
+// With Zbb the counts below are single clz/ctz/cpop instructions, and andn
+// and the blsr-style idioms are matched from the plain C expressions. The
+// fallbacks use the compiler builtins, with zero handled explicitly since the
+// builtins leave it undefined.
+#if defined(__riscv_zbb)
+#define _sse2rvv_clz_32(a) __riscv_clz_32(a)
+#define _sse2rvv_clz_64(a) __riscv_clz_64(a)
+#define _sse2rvv_ctz_32(a) __riscv_ctz_32(a)
+#define _sse2rvv_ctz_64(a) __riscv_ctz_64(a)
+#define _sse2rvv_cpop_32(a) __riscv_cpop_32(a)
+#define _sse2rvv_cpop_64(a) __riscv_cpop_64(a)
+#else
+#define _sse2rvv_clz_32(a) ((a) ? __builtin_clz(a) : 32)
+#define _sse2rvv_clz_64(a) ((a) ? __builtin_clzll(a) : 64)
+#define _sse2rvv_ctz_32(a) ((a) ? __builtin_ctz(a) : 32)
+#define _sse2rvv_ctz_64(a) ((a) ? __builtin_ctzll(a) : 64)
+#define _sse2rvv_cpop_32(a) __builtin_popcount(a)
+#define _sse2rvv_cpop_64(a) __builtin_popcountll(a)
+#endif
+
+// pdep and pext spread the 64 bits of a word over the bytes of an e8m8
+// vector, so that the bit permutation becomes a viota-indexed gather or a
+// vcompress under the mask, and then pack them back with vmsne. Only vl = 64
+// is needed, which e8m8 holds at any VLEN.
+FORCE_INLINE vbool1_t _sse2rvv_u64_to_b1(uint64_t a) {
+  return __riscv_vreinterpret_v_u8m1_b1(
+      __riscv_vreinterpret_v_u64m1_u8m1(__riscv_vmv_s_x_u64m1(a, 1)));
+}
+
+FORCE_INLINE vuint8m8_t _sse2rvv_u64_to_bits(uint64_t a) {
+  return __riscv_vmerge_vxm_u8m8(__riscv_vmv_v_x_u8m8(0, 64), 1,
+                                 _sse2rvv_u64_to_b1(a), 64);
+}
+
+FORCE_INLINE uint64_t _sse2rvv_bits_to_u64(vuint8m8_t bits) {
+  vbool1_t m = __riscv_vmsne_vx_u8m8_b1(bits, 0, 64);
+  return __riscv_vmv_x_s_u64m1_u64(
+      __riscv_vreinterpret_v_u8m1_u64m1(__riscv_vreinterpret_v_b1_u8m1(m)));
+}
+
+// Compute the bitwise NOT of 32-bit integer a and then AND with b, and store
+// the results in dst.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_andn_u32
+FORCE_INLINE uint32_t _andn_u32(uint32_t a, uint32_t b) { return ~a & b; }
+
+// Compute the bitwise NOT of 64-bit integer a and then AND with b, and store
+// the results in dst.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_andn_u64
+FORCE_INLINE uint64_t _andn_u64(uint64_t a, uint64_t b) { return ~a & b; }
+
+// Extract contiguous bits from unsigned 32-bit integer a, and store the
+// result in dst. Extract the number of bits specified by len, starting at the
+// bit specified by start.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_bextr_u32
+FORCE_INLINE uint32_t _bextr_u32(uint32_t a, uint32_t start, uint32_t len) {
+  start &= 0xff;
+  len &= 0xff;
+  if (start >= 32)
+    return 0;
+  a >>= start;
+  return len >= 32 ? a : a & ((UINT32_C(1) << len) - 1);
+}
+
+// Extract contiguous bits from unsigned 64-bit integer a, and store the
+// result in dst. Extract the number of bits specified by len, starting at the
+// bit specified by start.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_bextr_u64
+FORCE_INLINE uint64_t _bextr_u64(uint64_t a, uint32_t start, uint32_t len) {
+  start &= 0xff;
+  len &= 0xff;
+  if (start >= 64)
+    return 0;
+  a >>= start;
+  return len >= 64 ? a : a & ((UINT64_C(1) << len) - 1);
+}
+
+// Extract the lowest set bit from unsigned 32-bit integer a and set the
+// corresponding bit in dst. All other bits in dst are zeroed, and all bits
+// are zeroed if no bits are set in a.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_blsi_u32
+FORCE_INLINE uint32_t _blsi_u32(uint32_t a) { return a & (0 - a); }
+
+// Extract the lowest set bit from unsigned 64-bit integer a and set the
+// corresponding bit in dst. All other bits in dst are zeroed, and all bits
+// are zeroed if no bits are set in a.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_blsi_u64
+FORCE_INLINE uint64_t _blsi_u64(uint64_t a) { return a & (0 - a); }
+
+// Set all the lower bits of dst up to and including the lowest set bit in
+// unsigned 32-bit integer a.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_blsmsk_u32
+FORCE_INLINE uint32_t _blsmsk_u32(uint32_t a) { return a ^ (a - 1); }
+
+// Set all the lower bits of dst up to and including the lowest set bit in
+// unsigned 64-bit integer a.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_blsmsk_u64
+FORCE_INLINE uint64_t _blsmsk_u64(uint64_t a) { return a ^ (a - 1); }
+
+// Copy all bits from unsigned 32-bit integer a to dst, and reset (set to 0)
+// the bit in dst that corresponds to the lowest set bit in a.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_blsr_u32
+FORCE_INLINE uint32_t _blsr_u32(uint32_t a) { return a & (a - 1); }
+
+// Copy all bits from unsigned 64-bit integer a to dst, and reset (set to 0)
+// the bit in dst that corresponds to the lowest set bit in a.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_blsr_u64
+FORCE_INLINE uint64_t _blsr_u64(uint64_t a) { return a & (a - 1); }
+
+// Copy all bits from unsigned 32-bit integer a to dst, and reset (set to 0)
+// the high bits in dst starting at index to 31.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_bzhi_u32
+FORCE_INLINE uint32_t _bzhi_u32(uint32_t a, uint32_t index) {
+  index &= 0xff;
+  return index >= 32 ? a : a & ((UINT32_C(1) << index) - 1);
+}
+
+// Copy all bits from unsigned 64-bit integer a to dst, and reset (set to 0)
+// the high bits in dst starting at index to 63.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_bzhi_u64
+FORCE_INLINE uint64_t _bzhi_u64(uint64_t a, uint32_t index) {
+  index &= 0xff;
+  return index >= 64 ? a : a & ((UINT64_C(1) << index) - 1);
+}
+
+// Count the number of leading zero bits in unsigned 32-bit integer a, and
+// return that count in dst.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_lzcnt_u32
+FORCE_INLINE uint32_t _lzcnt_u32(uint32_t a) { return _sse2rvv_clz_32(a); }
+
+// Count the number of leading zero bits in unsigned 64-bit integer a, and
+// return that count in dst.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_lzcnt_u64
+FORCE_INLINE uint64_t _lzcnt_u64(uint64_t a) { return _sse2rvv_clz_64(a); }
+
+// Deposit contiguous low bits from unsigned 64-bit integer a to dst at the
+// corresponding bit locations specified by mask; all other bits in dst are
+// set to zero.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_pdep_u64
+FORCE_INLINE uint64_t _pdep_u64(uint64_t a, uint64_t mask) {
+  vbool1_t m = _sse2rvv_u64_to_b1(mask);
+  vuint8m8_t idx = __riscv_viota_m_u8m8(m, 64);
+  vuint8m8_t bits = __riscv_vrgather_vv_u8m8_mu(
+      m, __riscv_vmv_v_x_u8m8(0, 64), _sse2rvv_u64_to_bits(a), idx, 64);
+  return _sse2rvv_bits_to_u64(bits);
+}
+
+// Deposit contiguous low bits from unsigned 32-bit integer a to dst at the
+// corresponding bit locations specified by mask; all other bits in dst are
+// set to zero.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_pdep_u32
+FORCE_INLINE uint32_t _pdep_u32(uint32_t a, uint32_t mask) {
+  return (uint32_t)_pdep_u64(a, mask);
+}
+
+// Extract bits from unsigned 64-bit integer a at the corresponding bit
+// locations specified by mask to contiguous low bits in dst; the remaining
+// upper bits in dst are set to zero.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_pext_u64
+FORCE_INLINE uint64_t _pext_u64(uint64_t a, uint64_t mask) {
+  vuint8m8_t bits = __riscv_vcompress_vm_u8m8_tu(
+      __riscv_vmv_v_x_u8m8(0, 64), _sse2rvv_u64_to_bits(a),
+      _sse2rvv_u64_to_b1(mask), 64);
+  return _sse2rvv_bits_to_u64(bits);
+}
+
+// Extract bits from unsigned 32-bit integer a at the corresponding bit
+// locations specified by mask to contiguous low bits in dst; the remaining
+// upper bits in dst are set to zero.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_pext_u32
+FORCE_INLINE uint32_t _pext_u32(uint32_t a, uint32_t mask) {
+  return (uint32_t)_pext_u64(a, mask);
+}
+
+// Count the number of trailing zero bits in unsigned 32-bit integer a, and
+// return that count in dst.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_tzcnt_u32
+FORCE_INLINE uint32_t _tzcnt_u32(uint32_t a) { return _sse2rvv_ctz_32(a); }
+
+// Count the number of trailing zero bits in unsigned 64-bit integer a, and
+// return that count in dst.
+// https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_tzcnt_u64
+FORCE_INLINE uint64_t _tzcnt_u64(uint64_t a) { return _sse2rvv_ctz_64(a); }
 
 /* Others */
 
+// Carry-less 64x64 -> 128-bit product as {low, high}. Without Zvbc or Zbc,
+// lane i of a shift vector holds y << i (and the bits shifted out of it) and
+// an xor reduction masked by the bits of x folds them, 64 lanes in as few
+// LMUL=8 strips as VLEN allows.
+FORCE_INLINE vuint64m1_t _sse2rvv_clmul_64(uint64_t x, uint64_t y) {
+#if defined(__riscv_zvbc)
+  vuint64m1_t _x = __riscv_vmv_s_x_u64m1(x, 1);
+  vuint64m1_t lo = __riscv_vclmul_vx_u64m1(_x, y, 1);
+  vuint64m1_t hi = __riscv_vclmulh_vx_u64m1(_x, y, 1);
+  return __riscv_vslideup_vx_u64m1(lo, hi, 1, 2);
+#elif defined(__riscv_zbc)
+  uint64_t r[2] = {__riscv_clmul_64(x, y), __riscv_clmulh_64(x, y)};
+  return __riscv_vle64_v_u64m1(r, 2);
+#else
+  vuint64m1_t lo = __riscv_vmv_s_x_u64m1(0, 1);
+  vuint64m1_t hi = __riscv_vmv_s_x_u64m1(0, 1);
+  for (size_t i = 0, vl; i < 64; i += vl) {
+    vl = __riscv_vsetvl_e64m8(64 - i);
+    vuint64m8_t sh = __riscv_vadd_vx_u64m8(__riscv_vid_v_u64m8(vl), i, vl);
+    vuint64m8_t bits =
+        __riscv_vsrl_vv_u64m8(__riscv_vmv_v_x_u64m8(x, vl), sh, vl);
+    vbool8_t m =
+        __riscv_vmsne_vx_u64m8_b8(__riscv_vand_vx_u64m8(bits, 1, vl), 0, vl);
+    vuint64m8_t _y = __riscv_vmv_v_x_u64m8(y, vl);
+    vuint64m8_t y_lo = __riscv_vsll_vv_u64m8(_y, sh, vl);
+    // y >> (64 - i), written so that i == 0 gives 0 rather than y
+    vuint64m8_t y_hi = __riscv_vsrl_vv_u64m8(
+        __riscv_vsrl_vx_u64m8(_y, 1, vl),
+        __riscv_vrsub_vx_u64m8(sh, 63, vl), vl);
+    lo = __riscv_vredxor_vs_u64m8_u64m1_m(m, y_lo, lo, vl);
+    hi = __riscv_vredxor_vs_u64m8_u64m1_m(m, y_hi, hi, vl);
+  }
+  return __riscv_vslideup_vx_u64m1(lo, hi, 1, 2);
+#endif
+}
+
 // Perform a carry-less multiplication of two 64-bit integers, selected from a
 // and b according to imm8, and store the results in dst.
 // https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_mm_clmulepi64_si128
-// FORCE_INLINE __m128i _mm_clmulepi64_si128(__m128i _a, __m128i _b, const int
-// imm) {}
+FORCE_INLINE __m128i _mm_clmulepi64_si128(__m128i _a, __m128i _b,
+                                          const int imm) {
+  vuint64m1_t a = vreinterpretq_m128i_u64(_a);
+  vuint64m1_t b = vreinterpretq_m128i_u64(_b);
+  uint64_t x = __riscv_vmv_x_s_u64m1_u64(
+      __riscv_vslidedown_vx_u64m1(a, imm & 0x01, 2));
+  uint64_t y = __riscv_vmv_x_s_u64m1_u64(
+      __riscv_vslidedown_vx_u64m1(b, (imm >> 4) & 0x01, 2));
+  return vreinterpretq_u64_m128i(_sse2rvv_clmul_64(x, y));
+}
 
 // FORCE_INLINE unsigned int _sse2rvv_mm_get_denormals_zero_mode(void) {}
 
 // Count the number of bits set to 1 in unsigned 32-bit integer a, and
 // return that count in dst.
 // https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_mm_popcnt_u32
-// FORCE_INLINE int _mm_popcnt_u32(unsigned int a) {}
+FORCE_INLINE int _mm_popcnt_u32(unsigned int a) {
+  return _sse2rvv_cpop_32(a);
+}
 
 // Count the number of bits set to 1 in unsigned 64-bit integer a, and
 // return that count in dst.
 // https://www.intel.com/content/www/us/en/docs/intrinsics-guide/index.html#text=_mm_popcnt_u64
-// FORCE_INLINE int64_t _mm_popcnt_u64(uint64_t a) {}
+FORCE_INLINE int64_t _mm_popcnt_u64(uint64_t a) {
+  return _sse2rvv_cpop_64(a);
+}
 
 // FORCE_INLINE void _sse2rvv_mm_set_denormals_zero_mode(unsigned int flag) {}
 
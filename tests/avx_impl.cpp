@@ -7,6 +7,7 @@
  */
 
 #include <assert.h>
+#include <fenv.h>
 #include <float.h>
 #include <inttypes.h>
 #include <math.h>
@@ -224,7 +225,8 @@ result_t validate_int32_512(__m512i a, int32_t i0, int32_t i1, int32_t i2, int32
                            int32_t i4, int32_t i5, int32_t i6, int32_t i7,
                            int32_t i8, int32_t i9, int32_t i10, int32_t i11,
                            int32_t i12, int32_t i13, int32_t i14, int32_t i15) {
-    const int32_t *t = (const int32_t *)&a;
+    int32_t t[16];
+    _mm512_storeu_si512((__m512i*)t, a);
     
     // Validate each element
     ASSERT_RETURN(t[0] == i0);
@@ -411,7 +413,26 @@ result_t test_mm512_avg_epu16(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
 }
 
 result_t test_mm512_cmpeq_epi8_mask(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
-  return TEST_UNIMPL;
+  AVX512_TEST_BODY
+  int8_t a_data[64], b_data[64];
+  uint64_t expected = 0;
+
+  for (int i = 0; i < 64; i++) {
+    a_data[i] = (int8_t)(iter + i);
+    b_data[i] = (int8_t)((i % 3 == 0) ? iter + i : iter + i + 1);
+    if (a_data[i] == b_data[i]) {
+      expected |= 1ULL << i;
+    }
+  }
+
+  __m512i a = _mm512_loadu_si512(a_data);
+  __m512i b = _mm512_loadu_si512(b_data);
+  __mmask64 ret = _mm512_cmpeq_epi8_mask(a, b);
+
+  if (ret != expected) {
+    return TEST_FAIL;
+  }
+  return TEST_SUCCESS;
 }
 
 result_t test_mm512_cmpeq_epi16_mask(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
@@ -434,7 +455,26 @@ result_t test_mm512_cmpeq_epi16_mask(const AVX2RVV_TEST_IMPL &impl, uint32_t ite
 }
 
 result_t test_mm512_cmpgt_epi8_mask(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
-  return TEST_UNIMPL;
+  AVX512_TEST_BODY
+  int8_t a_data[64], b_data[64];
+  uint64_t expected = 0;
+
+  for (int i = 0; i < 64; i++) {
+    a_data[i] = (int8_t)(iter * 7 + i * 13);
+    b_data[i] = (int8_t)(iter * 3 + i * 5);
+    if (a_data[i] > b_data[i]) {
+      expected |= 1ULL << i;
+    }
+  }
+
+  __m512i a = _mm512_loadu_si512(a_data);
+  __m512i b = _mm512_loadu_si512(b_data);
+  __mmask64 ret = _mm512_cmpgt_epi8_mask(a, b);
+
+  if (ret != expected) {
+    return TEST_FAIL;
+  }
+  return TEST_SUCCESS;
 }
 
 result_t test_mm512_cmpgt_epi16_mask(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
@@ -564,11 +604,47 @@ result_t test_mm512_max_epu16(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
 }
 
 result_t test_mm512_mask_mov_epi16(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
-  return TEST_UNIMPL;
+  AVX512_TEST_BODY
+  int16_t src_data[32], a_data[32];
+  __mmask32 k = (__mmask32)(iter * 0x9E3779B9u);
+
+  for (int i = 0; i < 32; i++) {
+    src_data[i] = (int16_t)(iter + i);
+    a_data[i] = (int16_t)(iter - i);
+  }
+
+  __m512i src = _mm512_loadu_epi16(src_data);
+  __m512i a = _mm512_loadu_epi16(a_data);
+  __m512i ret = _mm512_mask_mov_epi16(src, k, a);
+
+  for (int i = 0; i < 32; i++) {
+    int16_t expected = ((k >> i) & 1) ? a_data[i] : src_data[i];
+    if (get_epi16(ret, i) != expected) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
 }
 
 result_t test_mm512_maskz_mov_epi16(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
-  return TEST_UNIMPL;
+  AVX512_TEST_BODY
+  int16_t a_data[32];
+  __mmask32 k = (__mmask32)(iter * 0x9E3779B9u);
+
+  for (int i = 0; i < 32; i++) {
+    a_data[i] = (int16_t)(iter + i + 1);
+  }
+
+  __m512i a = _mm512_loadu_epi16(a_data);
+  __m512i ret = _mm512_maskz_mov_epi16(k, a);
+
+  for (int i = 0; i < 32; i++) {
+    int16_t expected = ((k >> i) & 1) ? a_data[i] : 0;
+    if (get_epi16(ret, i) != expected) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
 }
 
 result_t test_mm512_mask_mov_epi8(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
@@ -616,7 +692,24 @@ result_t test_mm512_cvtepu8_epi16(const AVX2RVV_TEST_IMPL &impl, uint32_t iter)
 }
 
 result_t test_mm512_permutexvar_epi16(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
-  return TEST_UNIMPL;
+  AVX512_TEST_BODY
+  int16_t idx[32], a[32], r[32];
+
+  for (int i = 0; i < 32; i++) {
+    idx[i] = (int16_t)impl.test_cases_ints[(iter + i) % MAX_TEST_VALUE];
+    a[i] = (int16_t)impl.test_cases_ints[(iter + 32 + i) % MAX_TEST_VALUE];
+  }
+
+  __m512i vidx = _mm512_loadu_si512(idx);
+  __m512i va = _mm512_loadu_si512(a);
+  _mm512_storeu_si512(r, _mm512_permutexvar_epi16(vidx, va));
+
+  for (int i = 0; i < 32; i++) {
+    if (r[i] != a[idx[i] & 31]) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
 }
 
 result_t test_mm512_movepi8_mask(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
@@ -744,7 +837,26 @@ result_t test_mm512_maskz_set1_epi16(const AVX2RVV_TEST_IMPL &impl, uint32_t ite
 }
 
 result_t test_mm512_mask_blend_epi8(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
-  return TEST_UNIMPL;
+  AVX512_TEST_BODY
+  int8_t a_data[64], b_data[64];
+  __mmask64 k = (__mmask64)iter * 0x9E3779B97F4A7C15ULL;
+
+  for (int i = 0; i < 64; i++) {
+    a_data[i] = (int8_t)(iter + i);
+    b_data[i] = (int8_t)(iter - i);
+  }
+
+  __m512i a = _mm512_loadu_si512(a_data);
+  __m512i b = _mm512_loadu_si512(b_data);
+  __m512i ret = _mm512_mask_blend_epi8(k, a, b);
+
+  for (int i = 0; i < 64; i++) {
+    int8_t expected = ((k >> i) & 1) ? b_data[i] : a_data[i];
+    if (get_epi8(ret, i) != expected) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
 }
 
 result_t test_mm512_mask_blend_epi16(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
@@ -756,7 +868,25 @@ result_t test_mm512_mask_loadu_epi8(const AVX2RVV_TEST_IMPL &impl, uint32_t iter
 }
 
 result_t test_mm512_mask_loadu_epi16(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
-  return TEST_UNIMPL;
+  AVX512_TEST_BODY
+  int16_t src_data[32], mem[32];
+  __mmask32 k = (__mmask32)(iter * 0x9E3779B9u);
+
+  for (int i = 0; i < 32; i++) {
+    src_data[i] = (int16_t)(iter + i);
+    mem[i] = (int16_t)(iter * 3 - i);
+  }
+
+  __m512i src = _mm512_loadu_epi16(src_data);
+  __m512i ret = _mm512_mask_loadu_epi16(src, k, mem);
+
+  for (int i = 0; i < 32; i++) {
+    int16_t expected = ((k >> i) & 1) ? mem[i] : src_data[i];
+    if (get_epi16(ret, i) != expected) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
 }
 
 result_t test_mm512_maskz_loadu_epi8(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
@@ -768,7 +898,25 @@ result_t test_mm512_maskz_loadu_epi16(const AVX2RVV_TEST_IMPL &impl, uint32_t it
 }
 
 result_t test_mm512_mask_storeu_epi8(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
-  return TEST_UNIMPL;
+  AVX512_TEST_BODY
+  int8_t a_data[64], mem[64], orig[64];
+  __mmask64 k = (__mmask64)iter * 0x9E3779B97F4A7C15ULL;
+
+  for (int i = 0; i < 64; i++) {
+    a_data[i] = (int8_t)(iter + i);
+    mem[i] = orig[i] = (int8_t)(iter - i);
+  }
+
+  __m512i a = _mm512_loadu_si512(a_data);
+  _mm512_mask_storeu_epi8(mem, k, a);
+
+  for (int i = 0; i < 64; i++) {
+    int8_t expected = ((k >> i) & 1) ? a_data[i] : orig[i];
+    if (mem[i] != expected) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
 }
 
 result_t test_mm512_mask_storeu_epi16(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
@@ -783,6 +931,1684 @@ result_t test_mm512_kunpackw(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
   return TEST_UNIMPL;
 }
 
+result_t test_mm256_add_epi32(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  int32_t a_data[8], b_data[8], r[8];
+
+  for (int i = 0; i < 8; i++) {
+    a_data[i] = (int32_t)(iter * 2654435761u + i);
+    b_data[i] = (int32_t)(iter * 40503u - i);
+  }
+
+  __m256i a = _mm256_loadu_si256((const __m256i *)a_data);
+  __m256i b = _mm256_loadu_si256((const __m256i *)b_data);
+  _mm256_storeu_si256((__m256i *)r, _mm256_add_epi32(a, b));
+
+  for (int i = 0; i < 8; i++) {
+    if (r[i] != (int32_t)((uint32_t)a_data[i] + (uint32_t)b_data[i])) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm256_cmpgt_epi16(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  int16_t a_data[16], b_data[16], r[16];
+
+  for (int i = 0; i < 16; i++) {
+    a_data[i] = (int16_t)(iter * 7 + i * 4099);
+    b_data[i] = (int16_t)(iter * 3 - i * 1021);
+  }
+
+  __m256i a = _mm256_loadu_si256((const __m256i *)a_data);
+  __m256i b = _mm256_loadu_si256((const __m256i *)b_data);
+  _mm256_storeu_si256((__m256i *)r, _mm256_cmpgt_epi16(a, b));
+
+  for (int i = 0; i < 16; i++) {
+    if (r[i] != (a_data[i] > b_data[i] ? -1 : 0)) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm256_sllv_epi32(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  uint32_t a_data[8], c_data[8], r[8];
+
+  for (int i = 0; i < 8; i++) {
+    a_data[i] = iter * 2654435761u + i;
+    c_data[i] = (iter + i * 5) % 40;  // includes counts past 31
+  }
+
+  __m256i a = _mm256_loadu_si256((const __m256i *)a_data);
+  __m256i c = _mm256_loadu_si256((const __m256i *)c_data);
+  _mm256_storeu_si256((__m256i *)r, _mm256_sllv_epi32(a, c));
+
+  for (int i = 0; i < 8; i++) {
+    uint32_t expected = c_data[i] > 31 ? 0 : a_data[i] << c_data[i];
+    if (r[i] != expected) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm256_unpacklo_epi8(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  int8_t a_data[32], b_data[32], r[32];
+
+  for (int i = 0; i < 32; i++) {
+    a_data[i] = (int8_t)(iter + i);
+    b_data[i] = (int8_t)(iter - i * 3);
+  }
+
+  __m256i a = _mm256_loadu_si256((const __m256i *)a_data);
+  __m256i b = _mm256_loadu_si256((const __m256i *)b_data);
+  _mm256_storeu_si256((__m256i *)r, _mm256_unpacklo_epi8(a, b));
+
+  for (int lane = 0; lane < 2; lane++) {
+    for (int j = 0; j < 8; j++) {
+      if (r[lane * 16 + 2 * j] != a_data[lane * 16 + j] ||
+          r[lane * 16 + 2 * j + 1] != b_data[lane * 16 + j]) {
+        return TEST_FAIL;
+      }
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm256_unpackhi_epi16(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  int16_t a_data[16], b_data[16], r[16];
+
+  for (int i = 0; i < 16; i++) {
+    a_data[i] = (int16_t)(iter + i);
+    b_data[i] = (int16_t)(iter - i * 3);
+  }
+
+  __m256i a = _mm256_loadu_si256((const __m256i *)a_data);
+  __m256i b = _mm256_loadu_si256((const __m256i *)b_data);
+  _mm256_storeu_si256((__m256i *)r, _mm256_unpackhi_epi16(a, b));
+
+  for (int lane = 0; lane < 2; lane++) {
+    for (int j = 0; j < 4; j++) {
+      if (r[lane * 8 + 2 * j] != a_data[lane * 8 + 4 + j] ||
+          r[lane * 8 + 2 * j + 1] != b_data[lane * 8 + 4 + j]) {
+        return TEST_FAIL;
+      }
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm256_packs_epi16(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  int16_t a_data[16], b_data[16];
+  int8_t r[32];
+
+  for (int i = 0; i < 16; i++) {
+    a_data[i] = (int16_t)(iter * 37 + i * 61 - 500);
+    b_data[i] = (int16_t)(iter * 11 - i * 29 + 300);
+  }
+
+  __m256i a = _mm256_loadu_si256((const __m256i *)a_data);
+  __m256i b = _mm256_loadu_si256((const __m256i *)b_data);
+  _mm256_storeu_si256((__m256i *)r, _mm256_packs_epi16(a, b));
+
+  for (int lane = 0; lane < 2; lane++) {
+    for (int j = 0; j < 8; j++) {
+      int16_t x = a_data[lane * 8 + j];
+      int16_t y = b_data[lane * 8 + j];
+      int8_t ex = x > 127 ? 127 : (x < -128 ? -128 : (int8_t)x);
+      int8_t ey = y > 127 ? 127 : (y < -128 ? -128 : (int8_t)y);
+      if (r[lane * 16 + j] != ex || r[lane * 16 + 8 + j] != ey) {
+        return TEST_FAIL;
+      }
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm256_shuffle_epi8(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  int8_t a_data[32], b_data[32], r[32];
+
+  for (int i = 0; i < 32; i++) {
+    a_data[i] = (int8_t)(iter + i);
+    b_data[i] = (int8_t)(iter * 13 + i * 7);
+  }
+
+  __m256i a = _mm256_loadu_si256((const __m256i *)a_data);
+  __m256i b = _mm256_loadu_si256((const __m256i *)b_data);
+  _mm256_storeu_si256((__m256i *)r, _mm256_shuffle_epi8(a, b));
+
+  for (int i = 0; i < 32; i++) {
+    int8_t expected =
+        b_data[i] < 0 ? 0 : a_data[(i & 0x10) | (b_data[i] & 0x0F)];
+    if (r[i] != expected) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm256_mpsadbw_epu8(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  uint8_t a_data[32], b_data[32];
+  uint16_t r[16];
+
+  for (int i = 0; i < 32; i++) {
+    a_data[i] = (uint8_t)impl.test_cases_ints[(iter + i) % MAX_TEST_VALUE];
+    b_data[i] = (uint8_t)impl.test_cases_ints[(iter + 31 - i) % MAX_TEST_VALUE];
+  }
+
+  __m256i a = _mm256_loadu_si256((const __m256i *)a_data);
+  __m256i b = _mm256_loadu_si256((const __m256i *)b_data);
+
+#define TEST_MPSADBW(imm8)                                                     \
+  _mm256_storeu_si256((__m256i *)r, _mm256_mpsadbw_epu8(a, b, imm8));          \
+  for (int lane = 0; lane < 2; lane++) {                                       \
+    int sel = lane ? (imm8) >> 3 : (imm8);                                     \
+    const uint8_t *pa = a_data + 16 * lane + ((sel >> 2) & 1) * 4;             \
+    const uint8_t *pb = b_data + 16 * lane + (sel & 3) * 4;                    \
+    for (int j = 0; j < 8; j++) {                                              \
+      int expected = 0;                                                        \
+      for (int k = 0; k < 4; k++) {                                            \
+        expected += abs(pa[j + k] - pb[k]);                                    \
+      }                                                                        \
+      if (r[8 * lane + j] != expected) {                                       \
+        return TEST_FAIL;                                                      \
+      }                                                                        \
+    }                                                                          \
+  }
+
+  TEST_MPSADBW(0x00)
+  TEST_MPSADBW(0x07)
+  TEST_MPSADBW(0x38)
+  TEST_MPSADBW(0x1d)
+  TEST_MPSADBW(0x2a)
+#undef TEST_MPSADBW
+  return TEST_SUCCESS;
+}
+
+result_t test_mm256_movemask_epi8(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  int8_t a_data[32];
+  uint32_t expected = 0;
+
+  for (int i = 0; i < 32; i++) {
+    a_data[i] = (int8_t)(iter * 13 + i * 37);
+    if (a_data[i] < 0) {
+      expected |= 1u << i;
+    }
+  }
+
+  __m256i a = _mm256_loadu_si256((const __m256i *)a_data);
+  if ((uint32_t)_mm256_movemask_epi8(a) != expected) {
+    return TEST_FAIL;
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm256_add_ps(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  const float *a_data = impl.test_cases_floats + iter;
+  float b_data[8], r[8];
+
+  for (int i = 0; i < 8; i++) {
+    b_data[i] = impl.test_cases_floats[iter + 7 - i];
+  }
+
+  __m256 a = _mm256_loadu_ps(a_data);
+  __m256 b = _mm256_loadu_ps(b_data);
+  _mm256_storeu_ps(r, _mm256_add_ps(a, b));
+
+  for (int i = 0; i < 8; i++) {
+    if (r[i] != a_data[i] + b_data[i]) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm256_mul_pd(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  double a_data[4], b_data[4], r[4];
+
+  for (int i = 0; i < 4; i++) {
+    a_data[i] = (double)impl.test_cases_floats[iter + i];
+    b_data[i] = (double)impl.test_cases_floats[iter + 4 + i];
+  }
+
+  __m256d a = _mm256_loadu_pd(a_data);
+  __m256d b = _mm256_loadu_pd(b_data);
+  _mm256_storeu_pd(r, _mm256_mul_pd(a, b));
+
+  for (int i = 0; i < 4; i++) {
+    if (r[i] != a_data[i] * b_data[i]) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm256_cmp_ps(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  float a_data[8], b_data[8];
+  int32_t r[8];
+
+  for (int i = 0; i < 8; i++) {
+    a_data[i] = impl.test_cases_floats[iter + i];
+    b_data[i] = (i & 1) ? a_data[i] : impl.test_cases_floats[iter + 7 - i];
+  }
+  a_data[iter % 8] = NAN;
+
+  __m256 a = _mm256_loadu_ps(a_data);
+  __m256 b = _mm256_loadu_ps(b_data);
+
+  _mm256_storeu_ps((float *)r, _mm256_cmp_ps(a, b, _CMP_LT_OQ));
+  for (int i = 0; i < 8; i++) {
+    if (r[i] != (a_data[i] < b_data[i] ? -1 : 0)) {
+      return TEST_FAIL;
+    }
+  }
+  _mm256_storeu_ps((float *)r, _mm256_cmp_ps(a, b, _CMP_NLE_UQ));
+  for (int i = 0; i < 8; i++) {
+    if (r[i] != (!(a_data[i] <= b_data[i]) ? -1 : 0)) {
+      return TEST_FAIL;
+    }
+  }
+  _mm256_storeu_ps((float *)r, _mm256_cmp_ps(a, b, _CMP_EQ_UQ));
+  for (int i = 0; i < 8; i++) {
+    bool unord = isnan(a_data[i]) || isnan(b_data[i]);
+    if (r[i] != ((unord || a_data[i] == b_data[i]) ? -1 : 0)) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm256_blendv_ps(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  const float *a_data = impl.test_cases_floats + iter;
+  float b_data[8], m_data[8], r[8];
+
+  for (int i = 0; i < 8; i++) {
+    b_data[i] = -a_data[i];
+    m_data[i] = impl.test_cases_floats[iter + 7 - i];
+  }
+
+  __m256 a = _mm256_loadu_ps(a_data);
+  __m256 b = _mm256_loadu_ps(b_data);
+  __m256 m = _mm256_loadu_ps(m_data);
+  _mm256_storeu_ps(r, _mm256_blendv_ps(a, b, m));
+
+  for (int i = 0; i < 8; i++) {
+    float expected = signbit(m_data[i]) ? b_data[i] : a_data[i];
+    if (r[i] != expected) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm256_hadd_ps(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  const float *a_data = impl.test_cases_floats + iter;
+  float b_data[8], r[8];
+
+  for (int i = 0; i < 8; i++) {
+    b_data[i] = impl.test_cases_floats[iter + 7 - i];
+  }
+
+  __m256 a = _mm256_loadu_ps(a_data);
+  __m256 b = _mm256_loadu_ps(b_data);
+  _mm256_storeu_ps(r, _mm256_hadd_ps(a, b));
+
+  for (int lane = 0; lane < 8; lane += 4) {
+    if (r[lane + 0] != a_data[lane + 0] + a_data[lane + 1] ||
+        r[lane + 1] != a_data[lane + 2] + a_data[lane + 3] ||
+        r[lane + 2] != b_data[lane + 0] + b_data[lane + 1] ||
+        r[lane + 3] != b_data[lane + 2] + b_data[lane + 3]) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm256_dp_ps(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  float a_data[8], b_data[8], r[8];
+
+  for (int i = 0; i < 8; i++) {
+    a_data[i] = impl.test_cases_floats[(iter + i) % MAX_TEST_VALUE];
+    b_data[i] = impl.test_cases_floats[(iter + 7 - i) % MAX_TEST_VALUE];
+  }
+
+  __m256 a = _mm256_loadu_ps(a_data);
+  __m256 b = _mm256_loadu_ps(b_data);
+
+  // Products go through memory so that the reference is not contracted into
+  // FMAs, and are summed in the x86 order.
+#define TEST_DP_PS(imm8)                                                       \
+  _mm256_storeu_ps(r, _mm256_dp_ps(a, b, imm8));                               \
+  for (int lane = 0; lane < 8; lane += 4) {                                    \
+    volatile float p[4];                                                       \
+    for (int i = 0; i < 4; i++) {                                              \
+      p[i] = ((imm8) >> (4 + i)) & 1 ? a_data[lane + i] * b_data[lane + i]     \
+                                     : 0.0f;                                   \
+    }                                                                          \
+    float sum = (p[0] + p[1]) + (p[2] + p[3]);                                 \
+    for (int i = 0; i < 4; i++) {                                              \
+      float expected = ((imm8) >> i) & 1 ? sum : 0.0f;                         \
+      if (memcmp(&r[lane + i], &expected, sizeof(float)) != 0) {               \
+        return TEST_FAIL;                                                      \
+      }                                                                        \
+    }                                                                          \
+  }
+
+  TEST_DP_PS(0xff)
+  TEST_DP_PS(0xf1)
+  TEST_DP_PS(0x3c)
+  TEST_DP_PS(0x9a)
+  TEST_DP_PS(0x00)
+#undef TEST_DP_PS
+  return TEST_SUCCESS;
+}
+
+result_t test_mm256_cvtps_epi32(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  float a_data[8];
+  int32_t r[8];
+
+  for (int i = 0; i < 8; i++) {
+    a_data[i] = impl.test_cases_floats[iter + i];
+  }
+  a_data[iter % 8] = 3.0e9f;  // out of range -> integer indefinite
+
+  __m256 a = _mm256_loadu_ps(a_data);
+  _mm256_storeu_si256((__m256i *)r, _mm256_cvtps_epi32(a));
+
+  for (int i = 0; i < 8; i++) {
+    int32_t expected = (i == (int)(iter % 8)) ? INT32_MIN
+                                              : (int32_t)nearbyintf(a_data[i]);
+    if (r[i] != expected) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm512_add_round_ps(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  float a_data[16], b_data[16], r[16];
+
+  for (int i = 0; i < 16; i++) {
+    a_data[i] = impl.test_cases_floats[(iter + i) % MAX_TEST_VALUE];
+    b_data[i] = impl.test_cases_floats[(iter + 16 + i) % MAX_TEST_VALUE] * 1e-4f;
+  }
+
+  __m512 a = _mm512_loadu_ps(a_data);
+  __m512 b = _mm512_loadu_ps(b_data);
+
+  const int modes[4] = {FE_TONEAREST, FE_DOWNWARD, FE_UPWARD, FE_TOWARDZERO};
+  for (int m = 0; m < 4; m++) {
+    switch (m) {
+    case 0:
+      _mm512_storeu_ps(r, _mm512_add_round_ps(a, b, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+      break;
+    case 1:
+      _mm512_storeu_ps(r, _mm512_add_round_ps(a, b, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC));
+      break;
+    case 2:
+      _mm512_storeu_ps(r, _mm512_add_round_ps(a, b, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC));
+      break;
+    default:
+      _mm512_storeu_ps(r, _mm512_add_round_ps(a, b, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC));
+      break;
+    }
+    for (int i = 0; i < 16; i++) {
+      fesetround(modes[m]);
+      volatile float x = a_data[i];
+      volatile float expected = x + b_data[i];
+      fesetround(FE_TONEAREST);
+      if (r[i] != expected) {
+        return TEST_FAIL;
+      }
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm512_cvt_roundps_epi32(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  float a_data[16];
+  int32_t r[16];
+
+  for (int i = 0; i < 16; i++) {
+    a_data[i] = impl.test_cases_floats[(iter + i) % MAX_TEST_VALUE] * 0.01f;
+  }
+  a_data[iter % 16] = -3.0e9f;
+  a_data[(iter + 5) % 16] = NAN;
+
+  __m512 a = _mm512_loadu_ps(a_data);
+  _mm512_storeu_si512((__m512i *)r,
+                      _mm512_cvt_roundps_epi32(a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC));
+
+  for (int i = 0; i < 16; i++) {
+    int32_t expected = isnan(a_data[i]) || a_data[i] < -2147483648.0f
+                           ? INT32_MIN
+                           : (int32_t)floorf(a_data[i]);
+    if (r[i] != expected) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm256_fmadd_ps(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  float a_data[8], b_data[8], c_data[8], r[8];
+
+  for (int i = 0; i < 8; i++) {
+    a_data[i] = impl.test_cases_floats[(iter + i) % MAX_TEST_VALUE];
+    b_data[i] = impl.test_cases_floats[(iter + 7 - i) % MAX_TEST_VALUE];
+    c_data[i] = impl.test_cases_floats[(iter + 8 + i) % MAX_TEST_VALUE];
+  }
+
+  __m256 a = _mm256_loadu_ps(a_data);
+  __m256 b = _mm256_loadu_ps(b_data);
+  __m256 c = _mm256_loadu_ps(c_data);
+  _mm256_storeu_ps(r, _mm256_fmadd_ps(a, b, c));
+
+  for (int i = 0; i < 8; i++) {
+    if (r[i] != fmaf(a_data[i], b_data[i], c_data[i])) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm512_fmaddsub_ps(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  float a_data[16], b_data[16], c_data[16], r[16];
+
+  for (int i = 0; i < 16; i++) {
+    a_data[i] = impl.test_cases_floats[(iter + i) % MAX_TEST_VALUE];
+    b_data[i] = impl.test_cases_floats[(iter + 15 - i) % MAX_TEST_VALUE];
+    c_data[i] = impl.test_cases_floats[(iter + 16 + i) % MAX_TEST_VALUE];
+  }
+
+  __m512 a = _mm512_loadu_ps(a_data);
+  __m512 b = _mm512_loadu_ps(b_data);
+  __m512 c = _mm512_loadu_ps(c_data);
+  _mm512_storeu_ps(r, _mm512_fmaddsub_ps(a, b, c));
+
+  for (int i = 0; i < 16; i++) {
+    float c_i = (i & 1) ? c_data[i] : -c_data[i];
+    if (r[i] != fmaf(a_data[i], b_data[i], c_i)) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+/* Exact references for the half-precision conversions: the value is scaled
+ * to whole units of the result's last place and rounded there. NaNs only
+ * have to come back as NaNs, since RVV returns the canonical NaN. */
+static uint16_t f16_reference(float f, int rounding) {
+  uint32_t bits;
+  memcpy(&bits, &f, sizeof(bits));
+  uint16_t sign = (bits >> 16) & 0x8000;
+  if (isnan(f) || isinf(f)) {
+    return sign | (isnan(f) ? 0x7e00 | ((bits >> 13) & 0x3ff) : 0x7c00);
+  }
+  bool away = (rounding == _MM_FROUND_TO_POS_INF && !sign) ||
+              (rounding == _MM_FROUND_TO_NEG_INF && sign);
+  int e;
+  frexp(fabs((double)f), &e);
+  int ulp = e - 11 < -24 ? -24 : e - 11;
+  double q = ldexp(fabs((double)f), -ulp), r = floor(q);
+  if (rounding == _MM_FROUND_TO_NEAREST_INT) {
+    r += (q - r > 0.5 || (q - r == 0.5 && fmod(r, 2.0) != 0.0)) ? 1.0 : 0.0;
+  } else if (away) {
+    r = ceil(q);
+  }
+  r = ldexp(r, ulp);
+  if (r > 65504.0) {
+    return sign | ((rounding == _MM_FROUND_TO_NEAREST_INT || away) ? 0x7c00 : 0x7bff);
+  }
+  if (r < ldexp(1.0, -14)) {
+    return sign | (uint16_t)ldexp(r, 24);
+  }
+  frexp(r, &e);
+  return sign | (uint16_t)((e + 14) << 10) | (uint16_t)(ldexp(r, 11 - e) - 1024.0);
+}
+
+static bool f16_is_nan(uint16_t h) {
+  return (h & 0x7c00) == 0x7c00 && (h & 0x3ff);
+}
+
+result_t test_mm256_cvtph_ps(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  static const uint16_t specials[] = {0x0000, 0x8000, 0x0001, 0x83ff, 0x0400, 0x7bff,
+                                      0x7c00, 0xfc00, 0x7c01, 0xfe00, 0x3c00, 0x3555};
+  uint16_t h[8];
+  float r[8];
+
+  for (int i = 0; i < 8; i++) {
+    h[i] = (uint16_t)impl.test_cases_ints[(iter + i) % MAX_TEST_VALUE];
+  }
+  h[iter % 8] = specials[iter % 12];
+
+  __m256 a = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)h));
+  _mm256_storeu_ps(r, a);
+
+  for (int i = 0; i < 8; i++) {
+    int e = (h[i] >> 10) & 0x1f, m = h[i] & 0x3ff;
+    float expected = e == 0x1f ? (m ? NAN : INFINITY)
+                     : e ? ldexpf((float)(1024 + m), e - 25) : ldexpf((float)m, -24);
+    expected = (h[i] & 0x8000) ? -expected : expected;
+    if (isnan(expected) ? !isnan(r[i]) : memcmp(&r[i], &expected, sizeof(float)) != 0) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm256_cvtps_ph(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  static const uint32_t specials[] = {0x80000000, 0x7f800000, 0xff800000, 0x7fc01234,
+                                      0x477fefff, 0x477ff000, 0xc77ff000, 0x7f7fffff,
+                                      0x00000001, 0x33000000, 0x33000001, 0xb3400000,
+                                      0x387fc000, 0x3f801000, 0x3f803000, 0xbf801000};
+  float a_data[8];
+  uint16_t r[8];
+
+  /* Exponents from 98 to 145 reach past both ends of the half range */
+  for (int i = 0; i < 8; i++) {
+    uint32_t bits = (uint32_t)impl.test_cases_ints[(iter + i) % MAX_TEST_VALUE];
+    bits = (bits & 0x807fffff) | (98 + ((bits >> 23) & 0xff) % 48) << 23;
+    memcpy(&a_data[i], &bits, sizeof(bits));
+  }
+  memcpy(&a_data[iter % 8], &specials[iter % 16], sizeof(float));
+  __m256 a = _mm256_loadu_ps(a_data);
+
+  /* Failures only clear ok, so the rounding mode is always restored */
+  bool ok = true;
+#define TEST_CVTPS_PH(imm8, rounding)                                          \
+  _mm_storeu_si128((__m128i *)r, _mm256_cvtps_ph(a, imm8));                    \
+  for (int i = 0; i < 8; i++) {                                                \
+    uint16_t expected = f16_reference(a_data[i], rounding);                    \
+    if (f16_is_nan(expected) ? !f16_is_nan(r[i]) : r[i] != expected) {         \
+      ok = false;                                                              \
+    }                                                                          \
+  }
+
+  TEST_CVTPS_PH(_MM_FROUND_TO_NEAREST_INT, _MM_FROUND_TO_NEAREST_INT)
+  TEST_CVTPS_PH(_MM_FROUND_TO_NEG_INF, _MM_FROUND_TO_NEG_INF)
+  TEST_CVTPS_PH(_MM_FROUND_TO_POS_INF, _MM_FROUND_TO_POS_INF)
+  TEST_CVTPS_PH(_MM_FROUND_TO_ZERO, _MM_FROUND_TO_ZERO)
+  const int modes[4] = {FE_TONEAREST, FE_DOWNWARD, FE_UPWARD, FE_TOWARDZERO};
+  fesetround(modes[iter & 3]);
+  TEST_CVTPS_PH(_MM_FROUND_CUR_DIRECTION, (int)(iter & 3))
+  fesetround(FE_TONEAREST);
+#undef TEST_CVTPS_PH
+  return ok ? TEST_SUCCESS : TEST_FAIL;
+}
+
+/* Gather tables are addressed from their middle so that negative indices
+ * are exercised as well */
+result_t test_mm256_i32gather_ps(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  float table[64], r[8];
+  int32_t idx[8];
+
+  for (int i = 0; i < 64; i++) {
+    table[i] = impl.test_cases_floats[(iter + i) % MAX_TEST_VALUE];
+  }
+  for (int i = 0; i < 8; i++) {
+    idx[i] = (impl.test_cases_ints[(iter + i) % MAX_TEST_VALUE] & 63) - 32;
+  }
+
+  __m256i vindex = _mm256_loadu_si256((const __m256i *)idx);
+  _mm256_storeu_ps(r, _mm256_i32gather_ps(table + 32, vindex, 4));
+
+  for (int i = 0; i < 8; i++) {
+    if (r[i] != table[32 + idx[i]]) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm256_i32gather_epi64(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  int64_t table[32], r[4];
+  int32_t idx[4];
+
+  for (int i = 0; i < 32; i++) {
+    table[i] = (int64_t)impl.test_cases_ints[(iter + i) % MAX_TEST_VALUE] << 20 | i;
+  }
+  for (int i = 0; i < 4; i++) {
+    idx[i] = (impl.test_cases_ints[(iter + 32 + i) % MAX_TEST_VALUE] & 31) - 16;
+  }
+
+  __m128i vindex = _mm_loadu_si128((const __m128i *)idx);
+  _mm256_storeu_si256((__m256i *)r, _mm256_i32gather_epi64((const long long *)table + 16, vindex, 8));
+
+  for (int i = 0; i < 4; i++) {
+    if (r[i] != table[16 + idx[i]]) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm256_mask_i64gather_ps(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  float table[64], src[4], mask[4], r[4];
+  int64_t idx[4];
+
+  for (int i = 0; i < 64; i++) {
+    table[i] = impl.test_cases_floats[(iter + i) % MAX_TEST_VALUE];
+  }
+  for (int i = 0; i < 4; i++) {
+    idx[i] = (impl.test_cases_ints[(iter + 64 + i) % MAX_TEST_VALUE] & 31) - 16;
+    src[i] = -1.0f - i;
+    mask[i] = (impl.test_cases_ints[(iter + 68 + i) % MAX_TEST_VALUE] & 1) ? -0.0f : 1.0f;
+  }
+
+  __m256i vindex = _mm256_loadu_si256((const __m256i *)idx);
+  __m128 v = _mm256_mask_i64gather_ps(_mm_loadu_ps(src), table + 32, vindex, _mm_loadu_ps(mask), 8);
+  _mm_storeu_ps(r, v);
+
+  /* A scale of 8 with float data reads every other element */
+  for (int i = 0; i < 4; i++) {
+    float expected = signbit(mask[i]) ? table[32 + 2 * idx[i]] : src[i];
+    if (r[i] != expected) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm512_i32gather_epi32(const AVX2RVV_TEST_IMPL &impl,
+                                    uint32_t iter) {
+  AVX512_TEST_BODY
+  int32_t table[64], idx[16], r[16];
+
+  for (int i = 0; i < 64; i++) {
+    table[i] = impl.test_cases_ints[(iter + i) % MAX_TEST_VALUE];
+  }
+  for (int i = 0; i < 16; i++) {
+    idx[i] = (impl.test_cases_ints[(iter + 64 + i) % MAX_TEST_VALUE] & 63) - 32;
+  }
+
+  __m512i vindex = _mm512_loadu_si512(idx);
+  _mm512_storeu_si512(r, _mm512_i32gather_epi32(vindex, table + 32, 4));
+
+  for (int i = 0; i < 16; i++) {
+    if (r[i] != table[32 + idx[i]]) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm512_mask_i64gather_pd(const AVX2RVV_TEST_IMPL &impl,
+                                      uint32_t iter) {
+  AVX512_TEST_BODY
+  double table[32], src[8], r[8];
+  int64_t idx[8];
+  __mmask8 k = (__mmask8)impl.test_cases_ints[iter];
+
+  for (int i = 0; i < 32; i++) {
+    table[i] = impl.test_cases_floats[(iter + i) % MAX_TEST_VALUE];
+  }
+  for (int i = 0; i < 8; i++) {
+    idx[i] = (impl.test_cases_ints[(iter + 32 + i) % MAX_TEST_VALUE] & 31) - 16;
+    src[i] = -1.0 - i;
+  }
+
+  __m512i vindex = _mm512_loadu_si512(idx);
+  __m512d vsrc = _mm512_loadu_pd(src);
+  _mm512_storeu_pd(r, _mm512_mask_i64gather_pd(vsrc, k, vindex, table + 16, 8));
+
+  for (int i = 0; i < 8; i++) {
+    double expected = ((k >> i) & 1) ? table[16 + idx[i]] : src[i];
+    if (r[i] != expected) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm512_mask_i32scatter_ps(const AVX2RVV_TEST_IMPL &impl,
+                                       uint32_t iter) {
+  AVX512_TEST_BODY
+  float table[64], expected[64], a[16];
+  int32_t idx[16];
+  __mmask16 k = (__mmask16)impl.test_cases_ints[iter];
+
+  for (int i = 0; i < 64; i++) {
+    table[i] = expected[i] = (float)i;
+  }
+  for (int i = 0; i < 16; i++) {
+    idx[i] = (impl.test_cases_ints[(iter + 1 + i) % MAX_TEST_VALUE] & 63) - 32;
+    a[i] = impl.test_cases_floats[(iter + i) % MAX_TEST_VALUE];
+  }
+  /* Colliding indices must leave the value of the highest active lane */
+  for (int i = 0; i < 16; i++) {
+    if ((k >> i) & 1) {
+      expected[32 + idx[i]] = a[i];
+    }
+  }
+
+  __m512i vindex = _mm512_loadu_si512(idx);
+  _mm512_mask_i32scatter_ps(table + 32, k, vindex, _mm512_loadu_ps(a), 4);
+
+  for (int i = 0; i < 64; i++) {
+    if (table[i] != expected[i]) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm512_mask_compress_epi32(const AVX2RVV_TEST_IMPL &impl,
+                                        uint32_t iter) {
+  AVX512_TEST_BODY
+  int32_t src[16], a[16], expected[16], r[16];
+  __mmask16 k = (__mmask16)impl.test_cases_ints[iter];
+
+  for (int i = 0; i < 16; i++) {
+    src[i] = expected[i] = impl.test_cases_ints[(iter + 1 + i) % MAX_TEST_VALUE];
+    a[i] = impl.test_cases_ints[(iter + 17 + i) % MAX_TEST_VALUE];
+  }
+  for (int i = 0, j = 0; i < 16; i++) {
+    if ((k >> i) & 1) {
+      expected[j++] = a[i];
+    }
+  }
+
+  __m512i vsrc = _mm512_loadu_si512(src);
+  __m512i va = _mm512_loadu_si512(a);
+  _mm512_storeu_si512(r, _mm512_mask_compress_epi32(vsrc, k, va));
+
+  return memcmp(r, expected, sizeof(r)) == 0 ? TEST_SUCCESS : TEST_FAIL;
+}
+
+result_t test_mm512_mask_compressstoreu_epi8(const AVX2RVV_TEST_IMPL &impl,
+                                             uint32_t iter) {
+  AVX512_TEST_BODY
+  int8_t a[64], expected[65], r[65];
+  __mmask64 k = ((__mmask64)(uint32_t)impl.test_cases_ints[iter] << 32) |
+                (uint32_t)impl.test_cases_ints[(iter + 1) % MAX_TEST_VALUE];
+  int n = 0;
+
+  /* The byte after the packed elements must not be written */
+  memset(expected, 0x5a, sizeof(expected));
+  memset(r, 0x5a, sizeof(r));
+  for (int i = 0; i < 64; i++) {
+    a[i] = (int8_t)impl.test_cases_ints[(iter + 2 + i) % MAX_TEST_VALUE];
+    if ((k >> i) & 1) {
+      expected[n++] = a[i];
+    }
+  }
+
+  _mm512_mask_compressstoreu_epi8(r, k, _mm512_loadu_si512(a));
+
+  return memcmp(r, expected, sizeof(r)) == 0 ? TEST_SUCCESS : TEST_FAIL;
+}
+
+result_t test_mm512_maskz_expand_epi32(const AVX2RVV_TEST_IMPL &impl,
+                                       uint32_t iter) {
+  AVX512_TEST_BODY
+  int32_t a[16], expected[16], r[16];
+  __mmask16 k = (__mmask16)impl.test_cases_ints[iter];
+
+  for (int i = 0; i < 16; i++) {
+    a[i] = impl.test_cases_ints[(iter + 1 + i) % MAX_TEST_VALUE];
+  }
+  for (int i = 0, j = 0; i < 16; i++) {
+    expected[i] = ((k >> i) & 1) ? a[j++] : 0;
+  }
+
+  _mm512_storeu_si512(r, _mm512_maskz_expand_epi32(k, _mm512_loadu_si512(a)));
+
+  return memcmp(r, expected, sizeof(r)) == 0 ? TEST_SUCCESS : TEST_FAIL;
+}
+
+result_t test_mm512_mask_expandloadu_epi16(const AVX2RVV_TEST_IMPL &impl,
+                                           uint32_t iter) {
+  AVX512_TEST_BODY
+  int16_t src[32], mem[32], expected[32], r[32];
+  __mmask32 k = (__mmask32)impl.test_cases_ints[iter];
+
+  for (int i = 0; i < 32; i++) {
+    src[i] = (int16_t)impl.test_cases_ints[(iter + 1 + i) % MAX_TEST_VALUE];
+    mem[i] = (int16_t)impl.test_cases_ints[(iter + 33 + i) % MAX_TEST_VALUE];
+  }
+  for (int i = 0, j = 0; i < 32; i++) {
+    expected[i] = ((k >> i) & 1) ? mem[j++] : src[i];
+  }
+
+  __m512i vsrc = _mm512_loadu_si512(src);
+  _mm512_storeu_si512(r, _mm512_mask_expandloadu_epi16(vsrc, k, mem));
+
+  return memcmp(r, expected, sizeof(r)) == 0 ? TEST_SUCCESS : TEST_FAIL;
+}
+
+result_t test_mm512_permutex2var_epi8(const AVX2RVV_TEST_IMPL &impl,
+                                      uint32_t iter) {
+  AVX512_TEST_BODY
+  int8_t a[64], idx[64], b[64], r[64];
+
+  for (int i = 0; i < 64; i++) {
+    a[i] = (int8_t)impl.test_cases_ints[(iter + i) % MAX_TEST_VALUE];
+    idx[i] = (int8_t)impl.test_cases_ints[(iter + 64 + i) % MAX_TEST_VALUE];
+    b[i] = (int8_t)impl.test_cases_ints[(iter + 128 + i) % MAX_TEST_VALUE];
+  }
+
+  __m512i va = _mm512_loadu_si512(a);
+  __m512i vidx = _mm512_loadu_si512(idx);
+  __m512i vb = _mm512_loadu_si512(b);
+  _mm512_storeu_si512(r, _mm512_permutex2var_epi8(va, vidx, vb));
+
+  for (int i = 0; i < 64; i++) {
+    int8_t expected = (idx[i] & 64) ? b[idx[i] & 63] : a[idx[i] & 63];
+    if (r[i] != expected) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm512_permutexvar_pd(const AVX2RVV_TEST_IMPL &impl,
+                                   uint32_t iter) {
+  AVX512_TEST_BODY
+  int64_t idx[8];
+  double a[8], r[8];
+
+  for (int i = 0; i < 8; i++) {
+    idx[i] = impl.test_cases_ints[(iter + i) % MAX_TEST_VALUE];
+    a[i] = impl.test_cases_floats[(iter + i) % MAX_TEST_VALUE];
+  }
+
+  __m512i vidx = _mm512_loadu_si512(idx);
+  _mm512_storeu_pd(r, _mm512_permutexvar_pd(vidx, _mm512_loadu_pd(a)));
+
+  for (int i = 0; i < 8; i++) {
+    if (r[i] != a[idx[i] & 7]) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+static uint8_t multishift_reference(const uint8_t *b, int i, uint8_t ctrl) {
+  uint64_t q;
+  memcpy(&q, b + (i & ~7), sizeof(q));
+  int c = ctrl & 63;
+  return (uint8_t)((q >> c) | (c ? q << (64 - c) : 0));
+}
+
+result_t test_mm512_maskz_permutexvar_epi8(const AVX2RVV_TEST_IMPL &impl,
+                                           uint32_t iter) {
+  AVX512_TEST_BODY
+  int8_t a[64], idx[64], r[64];
+
+  for (int i = 0; i < 64; i++) {
+    a[i] = (int8_t)impl.test_cases_ints[(iter + i) % MAX_TEST_VALUE];
+    idx[i] = (int8_t)impl.test_cases_ints[(iter + 64 + i) % MAX_TEST_VALUE];
+  }
+  __mmask64 k = ((uint64_t)(uint32_t)impl.test_cases_ints[iter % MAX_TEST_VALUE] << 32) |
+                (uint32_t)impl.test_cases_ints[(iter + 1) % MAX_TEST_VALUE];
+
+  _mm512_storeu_si512(r, _mm512_maskz_permutexvar_epi8(k, _mm512_loadu_si512(idx),
+                                                       _mm512_loadu_si512(a)));
+
+  for (int i = 0; i < 64; i++) {
+    int8_t expected = ((k >> i) & 1) ? a[idx[i] & 63] : 0;
+    if (r[i] != expected) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+/* Odd iterations use the base64 encoder's control, which pulls the four
+ * 6-bit fields of each reshuffled 24-bit group into their own bytes */
+result_t test_mm512_multishift_epi64_epi8(const AVX2RVV_TEST_IMPL &impl,
+                                          uint32_t iter) {
+  AVX512_TEST_BODY
+  uint8_t a[64], b[64], r[64];
+
+  for (int i = 0; i < 64; i++) {
+    a[i] = (uint8_t)impl.test_cases_ints[(iter + i) % MAX_TEST_VALUE];
+    b[i] = (uint8_t)impl.test_cases_ints[(iter + 64 + i) % MAX_TEST_VALUE];
+  }
+  if (iter & 1) {
+    const uint64_t base64_shifts = 0x3036242a1016040aull;
+    for (int i = 0; i < 64; i += 8) {
+      memcpy(a + i, &base64_shifts, sizeof(base64_shifts));
+    }
+  }
+
+  _mm512_storeu_si512(r, _mm512_multishift_epi64_epi8(_mm512_loadu_si512(a),
+                                                      _mm512_loadu_si512(b)));
+
+  for (int i = 0; i < 64; i++) {
+    if (r[i] != multishift_reference(b, i, a[i])) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm256_permutex2var_epi8(const AVX2RVV_TEST_IMPL &impl,
+                                      uint32_t iter) {
+  AVX512_TEST_BODY
+  int8_t a[32], idx[32], b[32], r[32];
+
+  for (int i = 0; i < 32; i++) {
+    a[i] = (int8_t)impl.test_cases_ints[(iter + i) % MAX_TEST_VALUE];
+    idx[i] = (int8_t)impl.test_cases_ints[(iter + 32 + i) % MAX_TEST_VALUE];
+    b[i] = (int8_t)impl.test_cases_ints[(iter + 64 + i) % MAX_TEST_VALUE];
+  }
+
+  __m256i va = _mm256_loadu_si256((const __m256i *)a);
+  __m256i vidx = _mm256_loadu_si256((const __m256i *)idx);
+  __m256i vb = _mm256_loadu_si256((const __m256i *)b);
+  _mm256_storeu_si256((__m256i *)r, _mm256_permutex2var_epi8(va, vidx, vb));
+
+  for (int i = 0; i < 32; i++) {
+    int8_t expected = (idx[i] & 32) ? b[idx[i] & 31] : a[idx[i] & 31];
+    if (r[i] != expected) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm256_multishift_epi64_epi8(const AVX2RVV_TEST_IMPL &impl,
+                                          uint32_t iter) {
+  AVX512_TEST_BODY
+  uint8_t a[32], b[32], r[32];
+
+  for (int i = 0; i < 32; i++) {
+    a[i] = (uint8_t)impl.test_cases_ints[(iter + i) % MAX_TEST_VALUE];
+    b[i] = (uint8_t)impl.test_cases_ints[(iter + 32 + i) % MAX_TEST_VALUE];
+  }
+
+  __m256i va = _mm256_loadu_si256((const __m256i *)a);
+  __m256i vb = _mm256_loadu_si256((const __m256i *)b);
+  _mm256_storeu_si256((__m256i *)r, _mm256_multishift_epi64_epi8(va, vb));
+
+  for (int i = 0; i < 32; i++) {
+    if (r[i] != multishift_reference(b, i, a[i])) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm512_clmulepi64_epi128(const AVX2RVV_TEST_IMPL &impl,
+                                      uint32_t iter) {
+  AVX512_TEST_BODY
+  uint32_t w[32];
+  uint64_t a[8], b[8], r[8];
+
+  for (int i = 0; i < 32; i++) {
+    w[i] = (uint32_t)impl.test_cases_ints[(iter + i) % MAX_TEST_VALUE];
+  }
+  for (int i = 0; i < 8; i++) {
+    a[i] = ((uint64_t)w[i] << 32) | w[8 + i];
+    b[i] = ((uint64_t)w[16 + i] << 32) | w[24 + i];
+  }
+
+  __m512i va = _mm512_loadu_si512(a);
+  __m512i vb = _mm512_loadu_si512(b);
+  _mm512_storeu_si512(r, _mm512_clmulepi64_epi128(va, vb, 0x10));
+
+  for (int l = 0; l < 4; l++) {
+    uint64_t x = a[2 * l], y = b[2 * l + 1], lo = 0, hi = 0;
+    for (int i = 0; i < 64; i++) {
+      if ((x >> i) & 1) {
+        lo ^= y << i;
+        hi ^= i ? y >> (64 - i) : 0;
+      }
+    }
+    if (r[2 * l] != lo || r[2 * l + 1] != hi) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+/* Inputs for the VNNI tests: random words, with one dword of each operand
+ * forced to the extreme that saturates the accumulation */
+static void vnni_test_data(const AVX2RVV_TEST_IMPL &impl, uint32_t iter, int n,
+                           int32_t *src, uint32_t *a, uint32_t *b) {
+  for (int i = 0; i < n; i++) {
+    src[i] = impl.test_cases_ints[(iter + i) % MAX_TEST_VALUE];
+    a[i] = (uint32_t)impl.test_cases_ints[(iter + n + i) % MAX_TEST_VALUE];
+    b[i] = (uint32_t)impl.test_cases_ints[(iter + 2 * n + i) % MAX_TEST_VALUE];
+  }
+  int k = iter % n;
+  src[k] = (iter & 1) ? INT32_MAX - 5 : INT32_MIN + 5;
+  a[k] = (iter & 1) ? 0x80008000u : 0xffffffffu;
+  b[k] = (iter & 1) ? 0x80008000u : 0x80808080u;
+}
+
+static int32_t dpbusd_reference(uint32_t a, uint32_t b) {
+  int32_t sum = 0;
+  for (int j = 0; j < 32; j += 8) {
+    sum += (int32_t)((a >> j) & 0xff) * (int8_t)(b >> j);
+  }
+  return sum;
+}
+
+static int64_t dpwssd_reference(uint32_t a, uint32_t b) {
+  return (int64_t)(int16_t)a * (int16_t)b +
+         (int64_t)(int16_t)(a >> 16) * (int16_t)(b >> 16);
+}
+
+static int32_t saturate_int32(int64_t x) {
+  return x > INT32_MAX ? INT32_MAX : x < INT32_MIN ? INT32_MIN : (int32_t)x;
+}
+
+result_t test_mm512_dpbusd_epi32(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  int32_t src[16], r[16];
+  uint32_t a[16], b[16];
+  vnni_test_data(impl, iter, 16, src, a, b);
+
+  __m512i c = _mm512_dpbusd_epi32(_mm512_loadu_si512(src), _mm512_loadu_si512(a),
+                                  _mm512_loadu_si512(b));
+  _mm512_storeu_si512(r, c);
+
+  for (int i = 0; i < 16; i++) {
+    if (r[i] != (int32_t)((uint32_t)src[i] + (uint32_t)dpbusd_reference(a[i], b[i]))) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm512_dpbusds_epi32(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  int32_t src[16], r[16];
+  uint32_t a[16], b[16];
+  vnni_test_data(impl, iter, 16, src, a, b);
+
+  __m512i c = _mm512_dpbusds_epi32(_mm512_loadu_si512(src), _mm512_loadu_si512(a),
+                                   _mm512_loadu_si512(b));
+  _mm512_storeu_si512(r, c);
+
+  for (int i = 0; i < 16; i++) {
+    if (r[i] != saturate_int32((int64_t)src[i] + dpbusd_reference(a[i], b[i]))) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm512_dpwssds_epi32(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  int32_t src[16], r[16];
+  uint32_t a[16], b[16];
+  vnni_test_data(impl, iter, 16, src, a, b);
+
+  __m512i c = _mm512_dpwssds_epi32(_mm512_loadu_si512(src), _mm512_loadu_si512(a),
+                                   _mm512_loadu_si512(b));
+  _mm512_storeu_si512(r, c);
+
+  for (int i = 0; i < 16; i++) {
+    if (r[i] != saturate_int32(src[i] + dpwssd_reference(a[i], b[i]))) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm256_dpbusd_avx_epi32(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  int32_t src[8], r[8];
+  uint32_t a[8], b[8];
+  vnni_test_data(impl, iter, 8, src, a, b);
+
+  __m256i c = _mm256_dpbusd_avx_epi32(_mm256_loadu_si256((const __m256i *)src),
+                                      _mm256_loadu_si256((const __m256i *)a),
+                                      _mm256_loadu_si256((const __m256i *)b));
+  _mm256_storeu_si256((__m256i *)r, c);
+
+  for (int i = 0; i < 8; i++) {
+    if (r[i] != (int32_t)((uint32_t)src[i] + (uint32_t)dpbusd_reference(a[i], b[i]))) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm256_dpwssd_avx_epi32(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  int32_t src[8], r[8];
+  uint32_t a[8], b[8];
+  vnni_test_data(impl, iter, 8, src, a, b);
+
+  __m256i c = _mm256_dpwssd_avx_epi32(_mm256_loadu_si256((const __m256i *)src),
+                                      _mm256_loadu_si256((const __m256i *)a),
+                                      _mm256_loadu_si256((const __m256i *)b));
+  _mm256_storeu_si256((__m256i *)r, c);
+
+  for (int i = 0; i < 8; i++) {
+    if (r[i] != (int32_t)((uint64_t)(int64_t)src[i] + (uint64_t)dpwssd_reference(a[i], b[i]))) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+/* x86 has no loads or stores for the bf16 vector types */
+#if defined(__riscv) || defined(__riscv__)
+static void storeu_pbh512(uint16_t *p, __m512bh a) { __riscv_vse16(p, a, 32); }
+static __m512bh loadu_pbh512(const uint16_t *p) { return _avx512_rvv(vle16_v_u16)(p, 32); }
+static __m256bh loadu_pbh256(const uint16_t *p) { return _avx256_rvv(vle16_v_u16)(p, 16); }
+#else
+static void storeu_pbh512(uint16_t *p, __m512bh a) { memcpy(p, &a, 64); }
+static __m512bh loadu_pbh512(const uint16_t *p) {
+  __m512bh a;
+  memcpy(&a, p, 64);
+  return a;
+}
+static __m256bh loadu_pbh256(const uint16_t *p) {
+  __m256bh a;
+  memcpy(&a, p, 32);
+  return a;
+}
+#endif
+
+static uint16_t cvtneps_pbh_reference(float f) {
+  uint32_t x;
+  memcpy(&x, &f, sizeof(x));
+  if ((x & 0x7f800000) == 0) {
+    return (x >> 16) & 0x8000;
+  }
+  if ((x & 0x7fffffff) > 0x7f800000) {
+    return (x >> 16) | 0x40;
+  }
+  return (x + 0x7fff + ((x >> 16) & 1)) >> 16;
+}
+
+static bool bf16_is_nan(uint16_t h) {
+  return (h & 0x7f80) == 0x7f80 && (h & 0x7f);
+}
+
+/* Random bf16 or fp32 bits with exponents from 100 to 150, far from
+ * denormals and overflow, which x86 flushes in dpbf16 */
+static uint32_t bf16_test_bits(const AVX2RVV_TEST_IMPL &impl, uint32_t n) {
+  uint32_t x = (uint32_t)impl.test_cases_ints[n % MAX_TEST_VALUE];
+  return (x & 0x807fffff) | (100 + ((x >> 23) & 0xff) % 51) << 23;
+}
+
+result_t test_mm512_cvtne2ps_pbh(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  static const uint32_t specials[] = {0x00000000, 0x80000000, 0x7f800000, 0xff800000,
+                                      0x7fa12345, 0xffc00001, 0x00012345, 0x807fffff,
+                                      0x3f808000, 0x3f818000, 0x3f808001, 0x7f7fffff};
+  float a_data[16], b_data[16];
+  uint16_t r[32];
+
+  for (int i = 0; i < 16; i++) {
+    a_data[i] = impl.test_cases_floats[(iter + i) % MAX_TEST_VALUE];
+    uint32_t bits = bf16_test_bits(impl, iter + 16 + i);
+    memcpy(&b_data[i], &bits, sizeof(bits));
+  }
+  memcpy(&a_data[iter % 16], &specials[iter % 12], sizeof(float));
+  memcpy(&b_data[(iter + 5) % 16], &specials[(iter + 5) % 12], sizeof(float));
+
+  storeu_pbh512(r, _mm512_cvtne2ps_pbh(_mm512_loadu_ps(a_data), _mm512_loadu_ps(b_data)));
+
+  for (int i = 0; i < 32; i++) {
+    uint16_t expected = cvtneps_pbh_reference(i < 16 ? b_data[i] : a_data[i - 16]);
+    if (bf16_is_nan(expected) ? !bf16_is_nan(r[i]) : r[i] != expected) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm512_cvtpbh_ps(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  uint16_t a[16];
+  uint32_t r[16];
+
+  for (int i = 0; i < 16; i++) {
+    a[i] = (uint16_t)impl.test_cases_ints[(iter + i) % MAX_TEST_VALUE];
+  }
+  _mm512_storeu_ps(r, _mm512_cvtpbh_ps(loadu_pbh256(a)));
+
+  for (int i = 0; i < 16; i++) {
+    if (r[i] != (uint32_t)a[i] << 16) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+/* Each fp32 lane accumulates the odd product of its pair, then the even */
+result_t test_mm512_dpbf16_ps(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  uint16_t a[32], b[32];
+  float src[16], r[16];
+
+  for (int i = 0; i < 32; i++) {
+    a[i] = bf16_test_bits(impl, iter + i) >> 16;
+    b[i] = bf16_test_bits(impl, iter + 32 + i) >> 16;
+  }
+  for (int i = 0; i < 16; i++) {
+    uint32_t bits = bf16_test_bits(impl, iter + 64 + i);
+    memcpy(&src[i], &bits, sizeof(bits));
+  }
+
+  __m512 c = _mm512_dpbf16_ps(_mm512_loadu_ps(src), loadu_pbh512(a), loadu_pbh512(b));
+  _mm512_storeu_ps(r, c);
+
+  for (int i = 0; i < 16; i++) {
+    float p[4];
+    uint32_t bits[4] = {(uint32_t)a[2 * i] << 16, (uint32_t)b[2 * i] << 16,
+                        (uint32_t)a[2 * i + 1] << 16, (uint32_t)b[2 * i + 1] << 16};
+    memcpy(p, bits, sizeof(p));
+    volatile float acc = src[i] + p[2] * p[3];
+    acc = acc + p[0] * p[1];
+    float expected = acc;
+    if (memcmp(&r[i], &expected, sizeof(float)) != 0) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+/* Operands with all 64 bits random, so the ignored top 12 bits of b and c
+ * are exercised, plus one lane of maximal 52-bit values */
+static void madd52_test_data(const AVX2RVV_TEST_IMPL &impl, uint32_t iter, int n,
+                             uint64_t *a, uint64_t *b, uint64_t *c) {
+  for (int i = 0; i < n; i++) {
+    uint64_t w[6];
+    for (int j = 0; j < 6; j++) {
+      w[j] = (uint32_t)impl.test_cases_ints[(iter + 6 * i + j) % MAX_TEST_VALUE];
+    }
+    a[i] = w[0] << 32 | w[1];
+    b[i] = w[2] << 32 | w[3];
+    c[i] = w[4] << 32 | w[5];
+  }
+  b[iter % n] = c[iter % n] = ~0ull;
+}
+
+static uint64_t madd52_reference(uint64_t a, uint64_t b, uint64_t c, bool high) {
+  const uint64_t mask52 = (1ull << 52) - 1;
+  unsigned __int128 p = (unsigned __int128)(b & mask52) * (c & mask52);
+  return a + (high ? (uint64_t)(p >> 52) & mask52 : (uint64_t)p & mask52);
+}
+
+result_t test_mm512_madd52lo_epu64(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  uint64_t a[8], b[8], c[8], r[8];
+  madd52_test_data(impl, iter, 8, a, b, c);
+
+  _mm512_storeu_si512(r, _mm512_madd52lo_epu64(_mm512_loadu_si512(a), _mm512_loadu_si512(b),
+                                               _mm512_loadu_si512(c)));
+
+  for (int i = 0; i < 8; i++) {
+    if (r[i] != madd52_reference(a[i], b[i], c[i], false)) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm512_mask_madd52hi_epu64(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  uint64_t a[8], b[8], c[8], r[8];
+  madd52_test_data(impl, iter, 8, a, b, c);
+  __mmask8 k = (__mmask8)impl.test_cases_ints[(iter + 48) % MAX_TEST_VALUE];
+
+  _mm512_storeu_si512(r, _mm512_mask_madd52hi_epu64(_mm512_loadu_si512(a), k, _mm512_loadu_si512(b),
+                                                    _mm512_loadu_si512(c)));
+
+  for (int i = 0; i < 8; i++) {
+    uint64_t expected = ((k >> i) & 1) ? madd52_reference(a[i], b[i], c[i], true) : a[i];
+    if (r[i] != expected) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm256_madd52hi_epu64(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  uint64_t a[4], b[4], c[4], r[4];
+  madd52_test_data(impl, iter, 4, a, b, c);
+
+  __m256i d = _mm256_madd52hi_epu64(_mm256_loadu_si256((const __m256i *)a),
+                                    _mm256_loadu_si256((const __m256i *)b),
+                                    _mm256_loadu_si256((const __m256i *)c));
+  _mm256_storeu_si256((__m256i *)r, d);
+
+  for (int i = 0; i < 4; i++) {
+    if (r[i] != madd52_reference(a[i], b[i], c[i], true)) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+/* Random 64-bit words plus a zero, a top-bit-only and a small lane so the
+ * leading-zero counts cover their whole range */
+static void bitmanip_test_data(const AVX2RVV_TEST_IMPL &impl, uint32_t iter, uint64_t *v) {
+  for (int i = 0; i < 8; i++) {
+    uint64_t hi = (uint32_t)impl.test_cases_ints[(iter + 2 * i) % MAX_TEST_VALUE];
+    uint64_t lo = (uint32_t)impl.test_cases_ints[(iter + 2 * i + 1) % MAX_TEST_VALUE];
+    v[i] = (hi << 32 | lo) * 0x9e3779b97f4a7c15ull;
+  }
+  v[iter % 8] = 0;
+  v[(iter + 3) % 8] = 1ull << 63;
+  v[(iter + 5) % 8] >>= 37;
+}
+
+static uint32_t rotl32_reference(uint32_t x, uint32_t n) {
+  n &= 31;
+  return n ? (x << n | x >> (32 - n)) : x;
+}
+
+static uint64_t rotr64_reference(uint64_t x, uint64_t n) {
+  n &= 63;
+  return n ? (x >> n | x << (64 - n)) : x;
+}
+
+result_t test_mm512_popcnt_epi8(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  uint64_t a[8];
+  uint8_t r[64];
+  bitmanip_test_data(impl, iter, a);
+  const uint8_t *a8 = (const uint8_t *)a;
+
+  _mm512_storeu_si512(r, _mm512_popcnt_epi8(_mm512_loadu_si512(a)));
+
+  for (int i = 0; i < 64; i++) {
+    if (r[i] != __builtin_popcount(a8[i])) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm512_popcnt_epi16(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  uint64_t a[8];
+  uint16_t r[32];
+  bitmanip_test_data(impl, iter, a);
+  const uint16_t *a16 = (const uint16_t *)a;
+
+  _mm512_storeu_si512(r, _mm512_popcnt_epi16(_mm512_loadu_si512(a)));
+
+  for (int i = 0; i < 32; i++) {
+    if (r[i] != __builtin_popcount(a16[i])) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm512_popcnt_epi32(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  uint64_t a[8];
+  uint32_t r[16];
+  bitmanip_test_data(impl, iter, a);
+  const uint32_t *a32 = (const uint32_t *)a;
+
+  _mm512_storeu_si512(r, _mm512_popcnt_epi32(_mm512_loadu_si512(a)));
+
+  for (int i = 0; i < 16; i++) {
+    if (r[i] != (uint32_t)__builtin_popcount(a32[i])) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm512_popcnt_epi64(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  uint64_t a[8], r[8];
+  bitmanip_test_data(impl, iter, a);
+  a[(iter + 1) % 8] = ~0ull;
+
+  _mm512_storeu_si512(r, _mm512_popcnt_epi64(_mm512_loadu_si512(a)));
+
+  for (int i = 0; i < 8; i++) {
+    if (r[i] != (uint64_t)__builtin_popcountll(a[i])) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm512_lzcnt_epi32(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  uint64_t a[8];
+  uint32_t r[16];
+  bitmanip_test_data(impl, iter, a);
+  const uint32_t *a32 = (const uint32_t *)a;
+
+  _mm512_storeu_si512(r, _mm512_lzcnt_epi32(_mm512_loadu_si512(a)));
+
+  for (int i = 0; i < 16; i++) {
+    uint32_t expected = a32[i] ? (uint32_t)__builtin_clz(a32[i]) : 32;
+    if (r[i] != expected) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm512_lzcnt_epi64(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  uint64_t a[8], r[8];
+  bitmanip_test_data(impl, iter, a);
+  /* All ones below the top bit would round up to 2^63 under RNE */
+  a[(iter + 1) % 8] = ~0ull >> 1;
+
+  _mm512_storeu_si512(r, _mm512_lzcnt_epi64(_mm512_loadu_si512(a)));
+
+  for (int i = 0; i < 8; i++) {
+    uint64_t expected = a[i] ? (uint64_t)__builtin_clzll(a[i]) : 64;
+    if (r[i] != expected) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm512_rol_epi32(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  uint64_t a[8];
+  uint32_t r0[16], r13[16], r31[16];
+  bitmanip_test_data(impl, iter, a);
+  const uint32_t *a32 = (const uint32_t *)a;
+  __m512i va = _mm512_loadu_si512(a);
+
+  _mm512_storeu_si512(r0, _mm512_rol_epi32(va, 0));
+  _mm512_storeu_si512(r13, _mm512_rol_epi32(va, 13));
+  _mm512_storeu_si512(r31, _mm512_rol_epi32(va, 31));
+
+  for (int i = 0; i < 16; i++) {
+    if (r0[i] != a32[i] || r13[i] != rotl32_reference(a32[i], 13) ||
+        r31[i] != rotl32_reference(a32[i], 31)) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm512_rolv_epi32(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  uint64_t a[8];
+  uint32_t b[16], r[16];
+  bitmanip_test_data(impl, iter, a);
+  const uint32_t *a32 = (const uint32_t *)a;
+  /* Counts beyond 31 take their low five bits */
+  for (int i = 0; i < 16; i++) {
+    b[i] = (uint32_t)impl.test_cases_ints[(iter + 32 + i) % MAX_TEST_VALUE];
+  }
+  b[iter % 16] = 0;
+
+  _mm512_storeu_si512(r, _mm512_rolv_epi32(_mm512_loadu_si512(a), _mm512_loadu_si512(b)));
+
+  for (int i = 0; i < 16; i++) {
+    if (r[i] != rotl32_reference(a32[i], b[i])) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm512_rorv_epi64(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  uint64_t a[8], b[8], r[8];
+  bitmanip_test_data(impl, iter, a);
+  for (int i = 0; i < 8; i++) {
+    b[i] = (uint64_t)(int64_t)impl.test_cases_ints[(iter + 32 + i) % MAX_TEST_VALUE];
+  }
+  b[iter % 8] = 0;
+  b[(iter + 1) % 8] = 64;
+
+  _mm512_storeu_si512(r, _mm512_rorv_epi64(_mm512_loadu_si512(a), _mm512_loadu_si512(b)));
+
+  for (int i = 0; i < 8; i++) {
+    if (r[i] != rotr64_reference(a[i], b[i])) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm512_ror_epi64(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  uint64_t a[8], r1[8], r40[8];
+  bitmanip_test_data(impl, iter, a);
+  __m512i va = _mm512_loadu_si512(a);
+
+  _mm512_storeu_si512(r1, _mm512_ror_epi64(va, 1));
+  _mm512_storeu_si512(r40, _mm512_ror_epi64(va, 40));
+
+  for (int i = 0; i < 8; i++) {
+    if (r1[i] != rotr64_reference(a[i], 1) || r40[i] != rotr64_reference(a[i], 40)) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm512_bitshuffle_epi64_mask(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  uint64_t b[8], c[8];
+  bitmanip_test_data(impl, iter, b);
+  /* The top two bits of every control byte are ignored */
+  for (int i = 0; i < 8; i++) {
+    uint64_t hi = (uint32_t)impl.test_cases_ints[(iter + 40 + i) % MAX_TEST_VALUE];
+    c[i] = (hi << 32 | (uint32_t)impl.test_cases_ints[(iter + 48 + i) % MAX_TEST_VALUE]) *
+           0xbf58476d1ce4e5b9ull;
+  }
+  const uint8_t *c8 = (const uint8_t *)c;
+
+  __mmask64 k = _mm512_bitshuffle_epi64_mask(_mm512_loadu_si512(b), _mm512_loadu_si512(c));
+
+  for (int i = 0; i < 64; i++) {
+    uint64_t expected = (b[i / 8] >> (c8[i] & 63)) & 1;
+    if (((k >> i) & 1) != expected) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+static uint32_t conflict_reference(const uint64_t *a, int i) {
+  uint32_t r = 0;
+  for (int j = 0; j < i; j++) {
+    r |= (uint32_t)(a[j] == a[i]) << j;
+  }
+  return r;
+}
+
+/* Indices drawn from a small range so that most vectors hold duplicates, as
+ * they do in a histogram kernel */
+result_t test_mm512_conflict_epi32(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  uint32_t a[16], r[16];
+  uint64_t w[16];
+  for (int i = 0; i < 16; i++) {
+    a[i] = (uint32_t)impl.test_cases_ints[(iter + i) % MAX_TEST_VALUE] & 7;
+    w[i] = a[i];
+  }
+
+  _mm512_storeu_si512(r, _mm512_conflict_epi32(_mm512_loadu_si512(a)));
+
+  for (int i = 0; i < 16; i++) {
+    if (r[i] != conflict_reference(w, i)) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm512_mask_conflict_epi64(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  uint64_t a[8], src[8], r[8];
+  for (int i = 0; i < 8; i++) {
+    /* Equal low halves must not count as a conflict */
+    a[i] = ((uint64_t)(impl.test_cases_ints[(iter + i) % MAX_TEST_VALUE] & 1) << 32) |
+           (impl.test_cases_ints[(iter + 8 + i) % MAX_TEST_VALUE] & 3);
+    src[i] = (uint64_t)(int64_t)impl.test_cases_ints[(iter + 16 + i) % MAX_TEST_VALUE];
+  }
+  __mmask8 k = (__mmask8)impl.test_cases_ints[(iter + 24) % MAX_TEST_VALUE];
+
+  _mm512_storeu_si512(r, _mm512_mask_conflict_epi64(_mm512_loadu_si512(src), k, _mm512_loadu_si512(a)));
+
+  for (int i = 0; i < 8; i++) {
+    uint64_t expected = ((k >> i) & 1) ? conflict_reference(a, i) : src[i];
+    if (r[i] != expected) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm512_maskz_conflict_epi32(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
+  AVX512_TEST_BODY
+  uint32_t a[16], r[16];
+  uint64_t w[16];
+  /* All lanes equal: lane i reports every lane below it */
+  for (int i = 0; i < 16; i++) {
+    a[i] = (uint32_t)impl.test_cases_ints[iter % MAX_TEST_VALUE];
+    w[i] = a[i];
+  }
+  __mmask16 k = (__mmask16)impl.test_cases_ints[(iter + 1) % MAX_TEST_VALUE];
+
+  _mm512_storeu_si512(r, _mm512_maskz_conflict_epi32(k, _mm512_loadu_si512(a)));
+
+  for (int i = 0; i < 16; i++) {
+    uint32_t expected = ((k >> i) & 1) ? conflict_reference(w, i) : 0;
+    if (r[i] != expected) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+}
+
 result_t test_last(const AVX2RVV_TEST_IMPL &impl, uint32_t iter) {
   // #ifdef ENABLE_TEST_ALL
   return TEST_SUCCESS;
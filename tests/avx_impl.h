@@ -131,6 +131,84 @@
     /* AVX512 Mask Operations */                                               \
     _(mm512_kunpackd)                                                          \
     _(mm512_kunpackw)                                                          \
+    /* AVX2 Integer */                                                         \
+    _(mm256_add_epi32)                                                         \
+    _(mm256_cmpgt_epi16)                                                       \
+    _(mm256_sllv_epi32)                                                        \
+    _(mm256_unpacklo_epi8)                                                     \
+    _(mm256_unpackhi_epi16)                                                    \
+    _(mm256_packs_epi16)                                                       \
+    _(mm256_shuffle_epi8)                                                      \
+    _(mm256_mpsadbw_epu8)                                                      \
+    _(mm256_movemask_epi8)                                                     \
+    /* AVX Floating Point */                                                   \
+    _(mm256_add_ps)                                                            \
+    _(mm256_mul_pd)                                                            \
+    _(mm256_cmp_ps)                                                            \
+    _(mm256_blendv_ps)                                                         \
+    _(mm256_hadd_ps)                                                           \
+    _(mm256_dp_ps)                                                             \
+    _(mm256_cvtps_epi32)                                                       \
+    /* AVX512 Embedded Rounding */                                             \
+    _(mm512_add_round_ps)                                                      \
+    _(mm512_cvt_roundps_epi32)                                                 \
+    /* FMA3 */                                                                 \
+    _(mm256_fmadd_ps)                                                          \
+    _(mm512_fmaddsub_ps)                                                       \
+    /* F16C */                                                                 \
+    _(mm256_cvtph_ps)                                                          \
+    _(mm256_cvtps_ph)                                                          \
+    /* Gather and Scatter */                                                   \
+    _(mm256_i32gather_ps)                                                      \
+    _(mm256_i32gather_epi64)                                                   \
+    _(mm256_mask_i64gather_ps)                                                 \
+    _(mm512_i32gather_epi32)                                                   \
+    _(mm512_mask_i64gather_pd)                                                 \
+    _(mm512_mask_i32scatter_ps)                                                \
+    /* Compress and Expand */                                                  \
+    _(mm512_mask_compress_epi32)                                               \
+    _(mm512_mask_compressstoreu_epi8)                                          \
+    _(mm512_maskz_expand_epi32)                                                \
+    _(mm512_mask_expandloadu_epi16)                                            \
+    /* Full-width Permutes */                                                  \
+    _(mm512_permutex2var_epi8)                                                 \
+    _(mm512_permutexvar_pd)                                                    \
+    _(mm512_maskz_permutexvar_epi8)                                            \
+    _(mm512_multishift_epi64_epi8)                                             \
+    _(mm256_permutex2var_epi8)                                                 \
+    _(mm256_multishift_epi64_epi8)                                             \
+    /* Carry-less Multiply */                                                  \
+    _(mm512_clmulepi64_epi128)                                                 \
+    /* VNNI */                                                                 \
+    _(mm512_dpbusd_epi32)                                                      \
+    _(mm512_dpbusds_epi32)                                                     \
+    _(mm512_dpwssds_epi32)                                                     \
+    _(mm256_dpbusd_avx_epi32)                                                  \
+    _(mm256_dpwssd_avx_epi32)                                                  \
+    /* BF16 */                                                                 \
+    _(mm512_cvtne2ps_pbh)                                                      \
+    _(mm512_cvtpbh_ps)                                                         \
+    _(mm512_dpbf16_ps)                                                         \
+    /* IFMA52 */                                                               \
+    _(mm512_madd52lo_epu64)                                                    \
+    _(mm512_mask_madd52hi_epu64)                                               \
+    _(mm256_madd52hi_epu64)                                                    \
+    /* Bit Manipulation */                                                     \
+    _(mm512_popcnt_epi8)                                                       \
+    _(mm512_popcnt_epi16)                                                      \
+    _(mm512_popcnt_epi32)                                                      \
+    _(mm512_popcnt_epi64)                                                      \
+    _(mm512_lzcnt_epi32)                                                       \
+    _(mm512_lzcnt_epi64)                                                       \
+    _(mm512_rol_epi32)                                                         \
+    _(mm512_rolv_epi32)                                                        \
+    _(mm512_ror_epi64)                                                         \
+    _(mm512_rorv_epi64)                                                        \
+    _(mm512_bitshuffle_epi64_mask)                                             \
+    /* Conflict Detection */                                                   \
+    _(mm512_conflict_epi32)                                                    \
+    _(mm512_mask_conflict_epi64)                                               \
+    _(mm512_maskz_conflict_epi32)                                              \
     /* Utility */                                                              \
     _(rdtsc)                                                                   \
     _(last) /* This indicates the end of macros */
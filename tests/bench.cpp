@@ -0,0 +1,1316 @@
+// Throughput benchmarks: each kernel built on the intrinsics runs against a
+// plain C version of the same work. Build with "make bench" and run
+// tests/bench, optionally followed by the names of the benchmarks to run.
+//
+// Every entry of BENCH_LIST has bench_<name>_simd and bench_<name>_plain.
+// Both run the kernel reps times and return the units processed and a check
+// value over the output; the runner compares the check values of one run of
+// each before timing them, so a benchmark cannot report the speed of a wrong
+// result.
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+
+#include "common.h"
+
+namespace BENCH {
+
+struct result_t {
+  uint64_t units; // bytes, blocks or operations processed
+  double check;   // digest of the output, the same for both versions
+};
+typedef result_t (*bench_fn)(uint32_t reps);
+
+#define BENCH_LIST(_)                                                          \
+  /* AES */                                                                    \
+  _(aes_ctr, "B")                                                              \
+  _(aes_gcm, "B")                                                              \
+  /* CRC32C */                                                                 \
+  _(crc32c, "B")                                                               \
+  /* Motion search */                                                          \
+  _(block_search, "blk")                                                       \
+  /* SHA */                                                                    \
+  _(sha256, "B")                                                               \
+  /* VNNI */                                                                   \
+  _(gemm_u8s8, "op")                                                           \
+  /* VBMI */                                                                   \
+  _(base64_enc, "B")                                                           \
+  _(base64_dec, "B")                                                           \
+  /* BF16 */                                                                   \
+  _(gemv_bf16, "op")                                                           \
+  /* IFMA */                                                                   \
+  _(modmul256, "mul")                                                          \
+  /* CD */                                                                     \
+  _(histogram, "elem")                                                         \
+  _(histogram_skew, "elem")
+
+// Deterministic input data, the same for both versions
+static uint64_t rng_state = 0x9e3779b97f4a7c15ull;
+static uint32_t rng(void) {
+  rng_state = rng_state * 6364136223846793005ull + 1442695040888963407ull;
+  return (uint32_t)(rng_state >> 32);
+}
+
+static void fill(void *p, size_t n) {
+  uint8_t *b = (uint8_t *)p;
+  for (size_t i = 0; i < n; i++)
+    b[i] = (uint8_t)rng();
+}
+
+// XOR-fold of a buffer into 32 bits, exact as a double
+static double digest(const void *p, size_t n) {
+  const uint8_t *b = (const uint8_t *)p;
+  uint32_t h = 0;
+  for (size_t i = 0; i < n; i++)
+    h = (h << 5 | h >> 27) ^ b[i];
+  return h;
+}
+
+/* AES */
+// AES-128 over a 16 KiB buffer: CTR mode, and CTR plus GHASH over the
+// ciphertext for the shape of GCM. The key schedule is shared; the plain
+// versions use byte-wise S-box rounds and a bit-serial GF(2^128) multiply.
+#define AES_BYTES 16384
+
+static uint8_t aes_sbox[256];
+static uint8_t aes_rk[11][16];
+static uint8_t aes_in[AES_BYTES], aes_out[AES_BYTES];
+
+static uint8_t rotl8(uint8_t x, int n) {
+  return (uint8_t)(x << n | x >> (8 - n));
+}
+
+static uint8_t xtime(uint8_t x) {
+  return (uint8_t)(x << 1 ^ (x & 0x80 ? 0x1b : 0));
+}
+
+static void aes_init(void) {
+  // walk the multiplicative group by 3 and its inverse by 3^-1 together
+  uint8_t p = 1, q = 1;
+  do {
+    p = (uint8_t)(p ^ xtime(p));
+    q ^= (uint8_t)(q << 1);
+    q ^= (uint8_t)(q << 2);
+    q ^= (uint8_t)(q << 4);
+    if (q & 0x80)
+      q ^= 0x09;
+    aes_sbox[p] = (uint8_t)(q ^ rotl8(q, 1) ^ rotl8(q, 2) ^ rotl8(q, 3) ^
+                            rotl8(q, 4) ^ 0x63);
+  } while (p != 1);
+  aes_sbox[0] = 0x63;
+
+  fill(aes_rk[0], 16);
+  uint8_t rcon = 1;
+  for (int r = 1; r <= 10; r++) {
+    const uint8_t *k = aes_rk[r - 1];
+    uint8_t t[4] = {aes_sbox[k[13]], aes_sbox[k[14]], aes_sbox[k[15]],
+                    aes_sbox[k[12]]};
+    t[0] ^= rcon;
+    rcon = xtime(rcon);
+    for (int i = 0; i < 16; i++)
+      aes_rk[r][i] = (uint8_t)(k[i] ^ (i < 4 ? t[i] : aes_rk[r][i - 4]));
+  }
+  fill(aes_in, sizeof(aes_in));
+}
+
+static void aes_round_plain(uint8_t s[16], const uint8_t *rk, bool last) {
+  uint8_t t[16];
+  for (int c = 0; c < 4; c++)
+    for (int r = 0; r < 4; r++)
+      t[4 * c + r] = aes_sbox[s[4 * ((c + r) & 3) + r]];
+  for (int c = 0; c < 4 && !last; c++) {
+    uint8_t *a = t + 4 * c;
+    uint8_t all = (uint8_t)(a[0] ^ a[1] ^ a[2] ^ a[3]), a0 = a[0];
+    a[0] ^= (uint8_t)(all ^ xtime((uint8_t)(a[0] ^ a[1])));
+    a[1] ^= (uint8_t)(all ^ xtime((uint8_t)(a[1] ^ a[2])));
+    a[2] ^= (uint8_t)(all ^ xtime((uint8_t)(a[2] ^ a[3])));
+    a[3] ^= (uint8_t)(all ^ xtime((uint8_t)(a[3] ^ a0)));
+  }
+  for (int i = 0; i < 16; i++)
+    s[i] = (uint8_t)(t[i] ^ rk[i]);
+}
+
+static void aes_encrypt_plain(uint8_t s[16]) {
+  for (int i = 0; i < 16; i++)
+    s[i] ^= aes_rk[0][i];
+  for (int r = 1; r <= 10; r++)
+    aes_round_plain(s, aes_rk[r], r == 10);
+}
+
+// The counter block is a 64-bit little-endian count in the low half
+static void aes_ctr_plain(uint64_t ctr) {
+  for (size_t off = 0; off < AES_BYTES; off += 16, ctr++) {
+    uint8_t s[16] = {0};
+    memcpy(s, &ctr, 8);
+    aes_encrypt_plain(s);
+    for (int i = 0; i < 16; i++)
+      aes_out[off + i] = (uint8_t)(aes_in[off + i] ^ s[i]);
+  }
+}
+
+// RVV vector types are sizeless and cannot form arrays, so the SIMD kernels
+// keep their round keys in memory and load them as they go.
+static __m128i aes_rk_simd(int r) {
+  return _mm_loadu_si128((const __m128i *)aes_rk[r]);
+}
+
+static __m128i aes_encrypt_simd(__m128i x) {
+  x = _mm_xor_si128(x, aes_rk_simd(0));
+  for (int r = 1; r < 10; r++)
+    x = _mm_aesenc_si128(x, aes_rk_simd(r));
+  return _mm_aesenclast_si128(x, aes_rk_simd(10));
+}
+
+static void aes_xor_block(size_t off, __m128i k) {
+  __m128i in = _mm_loadu_si128((const __m128i *)(aes_in + off));
+  _mm_storeu_si128((__m128i *)(aes_out + off), _mm_xor_si128(in, k));
+}
+
+// Four independent blocks per step keep the AES unit busy
+static void aes_ctr_simd(uint64_t ctr) {
+  const __m128i one = _mm_set_epi64x(0, 1);
+  __m128i c0 = _mm_set_epi64x(0, (int64_t)ctr);
+  for (size_t off = 0; off < AES_BYTES; off += 64) {
+    __m128i c1 = _mm_add_epi64(c0, one);
+    __m128i c2 = _mm_add_epi64(c1, one);
+    __m128i c3 = _mm_add_epi64(c2, one);
+    __m128i k0 = aes_encrypt_simd(c0), k1 = aes_encrypt_simd(c1);
+    __m128i k2 = aes_encrypt_simd(c2), k3 = aes_encrypt_simd(c3);
+    aes_xor_block(off, k0);
+    aes_xor_block(off + 16, k1);
+    aes_xor_block(off + 32, k2);
+    aes_xor_block(off + 48, k3);
+    c0 = _mm_add_epi64(c3, one);
+  }
+}
+
+result_t bench_aes_ctr_plain(uint32_t reps) {
+  for (uint32_t i = 0; i < reps; i++)
+    aes_ctr_plain((uint64_t)i * (AES_BYTES / 16));
+  return {(uint64_t)reps * AES_BYTES, digest(aes_out, AES_BYTES)};
+}
+
+result_t bench_aes_ctr_simd(uint32_t reps) {
+  for (uint32_t i = 0; i < reps; i++)
+    aes_ctr_simd((uint64_t)i * (AES_BYTES / 16));
+  return {(uint64_t)reps * AES_BYTES, digest(aes_out, AES_BYTES)};
+}
+
+// GHASH in the bit order of the GCM specification: x and y are big-endian
+// 128-bit values as {high, low} words, bit 0 being the MSB of the high word.
+static void ghash_mul_plain(uint64_t x[2], const uint64_t h[2]) {
+  uint64_t z[2] = {0, 0}, v[2] = {h[0], h[1]};
+  for (int i = 0; i < 128; i++) {
+    if ((x[i >> 6] >> (63 - (i & 63))) & 1) {
+      z[0] ^= v[0];
+      z[1] ^= v[1];
+    }
+    uint64_t lsb = v[1] & 1;
+    v[1] = v[1] >> 1 | v[0] << 63;
+    v[0] = v[0] >> 1 ^ (lsb ? 0xe1ull << 56 : 0);
+  }
+  x[0] = z[0];
+  x[1] = z[1];
+}
+
+static uint64_t load_be64(const uint8_t *p) {
+  uint64_t v = 0;
+  for (int i = 0; i < 8; i++)
+    v = v << 8 | p[i];
+  return v;
+}
+
+static double ghash_plain(void) {
+  uint8_t zero[16] = {0};
+  aes_encrypt_plain(zero);
+  const uint64_t h[2] = {load_be64(zero), load_be64(zero + 8)};
+  uint64_t x[2] = {0, 0};
+  for (size_t off = 0; off < AES_BYTES; off += 16) {
+    x[0] ^= load_be64(aes_out + off);
+    x[1] ^= load_be64(aes_out + off + 8);
+    ghash_mul_plain(x, h);
+  }
+  return (double)(uint32_t)(x[0] >> 32 ^ x[0] ^ x[1] >> 32 ^ x[1]);
+}
+
+// Carry-less multiply of byte-reflected operands with the shift-and-reduce
+// of Intel's GCM white paper
+static __m128i ghash_mul_simd(__m128i a, __m128i b) {
+  __m128i lo = _mm_clmulepi64_si128(a, b, 0x00);
+  __m128i mid = _mm_xor_si128(_mm_clmulepi64_si128(a, b, 0x10),
+                              _mm_clmulepi64_si128(a, b, 0x01));
+  __m128i hi = _mm_clmulepi64_si128(a, b, 0x11);
+  lo = _mm_xor_si128(lo, _mm_slli_si128(mid, 8));
+  hi = _mm_xor_si128(hi, _mm_srli_si128(mid, 8));
+
+  // shift the 256-bit product left by one
+  __m128i lo_c = _mm_srli_epi32(lo, 31), hi_c = _mm_srli_epi32(hi, 31);
+  lo = _mm_slli_epi32(lo, 1);
+  hi = _mm_slli_epi32(hi, 1);
+  hi = _mm_or_si128(hi, _mm_srli_si128(lo_c, 12));
+  hi = _mm_or_si128(hi, _mm_slli_si128(hi_c, 4));
+  lo = _mm_or_si128(lo, _mm_slli_si128(lo_c, 4));
+
+  // reduce modulo x^128 + x^7 + x^2 + x + 1
+  __m128i t = _mm_xor_si128(
+      _mm_xor_si128(_mm_slli_epi32(lo, 31), _mm_slli_epi32(lo, 30)),
+      _mm_slli_epi32(lo, 25));
+  __m128i carry = _mm_srli_si128(t, 4);
+  lo = _mm_xor_si128(lo, _mm_slli_si128(t, 12));
+  __m128i u = _mm_xor_si128(
+      _mm_xor_si128(_mm_srli_epi32(lo, 1), _mm_srli_epi32(lo, 2)),
+      _mm_srli_epi32(lo, 7));
+  u = _mm_xor_si128(u, carry);
+  return _mm_xor_si128(hi, _mm_xor_si128(lo, u));
+}
+
+static double ghash_simd(void) {
+  const __m128i bswap =
+      _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+  __m128i h = _mm_shuffle_epi8(aes_encrypt_simd(_mm_setzero_si128()), bswap);
+  __m128i x = _mm_setzero_si128();
+  for (size_t off = 0; off < AES_BYTES; off += 16) {
+    __m128i c = _mm_loadu_si128((const __m128i *)(aes_out + off));
+    x = ghash_mul_simd(_mm_xor_si128(x, _mm_shuffle_epi8(c, bswap)), h);
+  }
+  // x holds the big-endian value with its low word in lane 0
+  uint64_t w[2];
+  _mm_storeu_si128((__m128i *)w, x);
+  return (double)(uint32_t)(w[1] >> 32 ^ w[1] ^ w[0] >> 32 ^ w[0]);
+}
+
+result_t bench_aes_gcm_plain(uint32_t reps) {
+  double check = 0;
+  for (uint32_t i = 0; i < reps; i++) {
+    aes_ctr_plain((uint64_t)i * (AES_BYTES / 16));
+    check = ghash_plain();
+  }
+  return {(uint64_t)reps * AES_BYTES, check};
+}
+
+result_t bench_aes_gcm_simd(uint32_t reps) {
+  double check = 0;
+  for (uint32_t i = 0; i < reps; i++) {
+    aes_ctr_simd((uint64_t)i * (AES_BYTES / 16));
+    check = ghash_simd();
+  }
+  return {(uint64_t)reps * AES_BYTES, check};
+}
+
+/* CRC32C */
+// CRC32C of a 16 KiB buffer, without pre- or post-conditioning, against a
+// byte-at-a-time table loop. On RISC-V the kernel is _sse2rvv_crc32c, which
+// folds 64-byte blocks with Zvbc; elsewhere it chains _mm_crc32_u64.
+#define CRC_BYTES 16384
+
+static uint8_t crc_buf[CRC_BYTES];
+static uint32_t crc_table[256];
+
+static void crc_init(void) {
+  for (uint32_t i = 0; i < 256; i++) {
+    uint32_t c = i;
+    for (int k = 0; k < 8; k++)
+      c = c >> 1 ^ (c & 1 ? 0x82f63b78 : 0);
+    crc_table[i] = c;
+  }
+  fill(crc_buf, sizeof(crc_buf));
+}
+
+static uint32_t crc32c_simd(uint32_t crc, const uint8_t *p, size_t len) {
+#if defined(__riscv) || defined(__riscv__)
+  return _sse2rvv_crc32c(crc, p, len);
+#else
+  for (; len >= 8; p += 8, len -= 8) {
+    uint64_t v;
+    memcpy(&v, p, 8);
+    crc = (uint32_t)_mm_crc32_u64(crc, v);
+  }
+  for (; len > 0; p++, len--)
+    crc = _mm_crc32_u8(crc, *p);
+  return crc;
+#endif
+}
+
+result_t bench_crc32c_plain(uint32_t reps) {
+  uint32_t crc = 0;
+  for (uint32_t i = 0; i < reps; i++) {
+    crc = i;
+    for (size_t j = 0; j < CRC_BYTES; j++)
+      crc = crc >> 8 ^ crc_table[(crc ^ crc_buf[j]) & 0xff];
+  }
+  return {(uint64_t)reps * CRC_BYTES, (double)crc};
+}
+
+result_t bench_crc32c_simd(uint32_t reps) {
+  uint32_t crc = 0;
+  for (uint32_t i = 0; i < reps; i++)
+    crc = crc32c_simd(i, crc_buf, CRC_BYTES);
+  return {(uint64_t)reps * CRC_BYTES, (double)crc};
+}
+
+/* Motion search */
+// Full search of a 16x16 block over a 48x48 reference window, the pattern of
+// the encoder's motion estimation: the SAD at each of the 32x32 offsets, and
+// the first offset with the smallest SAD in row-major order. _mm_mpsadbw_epu8
+// gives the SADs of one 4-byte group at 8 neighbouring offsets, so a row of
+// the block takes four of them, one per group.
+#define MS_BLOCK 16
+#define MS_RANGE 32
+#define MS_STRIDE (MS_BLOCK + MS_RANGE)
+
+static uint8_t ms_ref[MS_STRIDE * MS_STRIDE];
+static uint8_t ms_cur[MS_BLOCK * MS_BLOCK];
+
+static void ms_init(void) {
+  fill(ms_ref, sizeof(ms_ref));
+  fill(ms_cur, sizeof(ms_cur));
+}
+
+static uint32_t block_search_plain(void) {
+  uint32_t best = UINT32_MAX, best_pos = 0;
+  for (int y = 0; y < MS_RANGE; y++)
+    for (int x = 0; x < MS_RANGE; x++) {
+      uint32_t sad = 0;
+      for (int i = 0; i < MS_BLOCK; i++) {
+        const uint8_t *r = ms_ref + (y + i) * MS_STRIDE + x;
+        const uint8_t *c = ms_cur + i * MS_BLOCK;
+        for (int j = 0; j < MS_BLOCK; j++)
+          sad += (uint32_t)abs(r[j] - c[j]);
+      }
+      if (sad < best) {
+        best = sad;
+        best_pos = (uint32_t)(y * MS_RANGE + x);
+      }
+    }
+  return best << 16 | best_pos;
+}
+
+static uint32_t block_search_simd(void) {
+  uint32_t best = UINT32_MAX, best_pos = 0;
+  for (int y = 0; y < MS_RANGE; y++)
+    for (int x = 0; x < MS_RANGE; x += 8) {
+      // a 16x16 SAD is at most 65280, so the sums stay in 16 bits
+      __m128i sad = _mm_setzero_si128();
+      for (int i = 0; i < MS_BLOCK; i++) {
+        const uint8_t *r = ms_ref + (y + i) * MS_STRIDE + x;
+        __m128i c = _mm_loadu_si128((const __m128i *)(ms_cur + i * MS_BLOCK));
+        __m128i r0 = _mm_loadu_si128((const __m128i *)r);
+        __m128i r1 = _mm_loadu_si128((const __m128i *)(r + 8));
+        sad = _mm_add_epi16(sad, _mm_mpsadbw_epu8(r0, c, 0));
+        sad = _mm_add_epi16(sad, _mm_mpsadbw_epu8(r0, c, 5));
+        sad = _mm_add_epi16(sad, _mm_mpsadbw_epu8(r1, c, 2));
+        sad = _mm_add_epi16(sad, _mm_mpsadbw_epu8(r1, c, 7));
+      }
+      uint32_t m = (uint32_t)_mm_cvtsi128_si32(_mm_minpos_epu16(sad));
+      if ((m & 0xffff) < best) {
+        best = m & 0xffff;
+        best_pos = (uint32_t)(y * MS_RANGE + x) + (m >> 16 & 7);
+      }
+    }
+  return best << 16 | best_pos;
+}
+
+result_t bench_block_search_plain(uint32_t reps) {
+  uint32_t r = 0;
+  for (uint32_t i = 0; i < reps; i++)
+    r = block_search_plain();
+  return {reps, (double)r};
+}
+
+result_t bench_block_search_simd(uint32_t reps) {
+  uint32_t r = 0;
+  for (uint32_t i = 0; i < reps; i++)
+    r = block_search_simd();
+  return {reps, (double)r};
+}
+
+/* SHA */
+// SHA-256 compression of a 16 KiB buffer as 256 message blocks, without the
+// final padding block. The SIMD version is the usual SHA-NI sequence: the
+// state is held as ABEF/CDGH, each _mm_sha256rnds2_epu32 does two rounds and
+// the schedule is extended four words at a time with msg1/msg2.
+#define SHA_BYTES 16384
+
+static const uint32_t sha_k[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+    0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+    0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+    0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+    0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+    0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+static const uint32_t sha_h0[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372,
+                                   0xa54ff53a, 0x510e527f, 0x9b05688c,
+                                   0x1f83d9ab, 0x5be0cd19};
+
+static uint8_t sha_buf[SHA_BYTES];
+
+static void sha_init(void) {
+  fill(sha_buf, sizeof(sha_buf));
+}
+
+static uint32_t rotr32(uint32_t x, int n) {
+  return x >> n | x << (32 - n);
+}
+
+static void sha256_plain(uint32_t st[8], const uint8_t *p, size_t len) {
+  for (; len >= 64; p += 64, len -= 64) {
+    uint32_t w[64];
+    for (int i = 0; i < 16; i++)
+      w[i] = (uint32_t)p[4 * i] << 24 | (uint32_t)p[4 * i + 1] << 16 |
+             (uint32_t)p[4 * i + 2] << 8 | p[4 * i + 3];
+    for (int i = 16; i < 64; i++) {
+      uint32_t s0 = rotr32(w[i - 15], 7) ^ rotr32(w[i - 15], 18) ^
+                    w[i - 15] >> 3;
+      uint32_t s1 = rotr32(w[i - 2], 17) ^ rotr32(w[i - 2], 19) ^
+                    w[i - 2] >> 10;
+      w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+    uint32_t a = st[0], b = st[1], c = st[2], d = st[3];
+    uint32_t e = st[4], f = st[5], g = st[6], h = st[7];
+    for (int i = 0; i < 64; i++) {
+      uint32_t t1 = h + (rotr32(e, 6) ^ rotr32(e, 11) ^ rotr32(e, 25)) +
+                    ((e & f) ^ (~e & g)) + sha_k[i] + w[i];
+      uint32_t t2 = (rotr32(a, 2) ^ rotr32(a, 13) ^ rotr32(a, 22)) +
+                    ((a & b) ^ (a & c) ^ (b & c));
+      h = g;
+      g = f;
+      f = e;
+      e = d + t1;
+      d = c;
+      c = b;
+      b = a;
+      a = t1 + t2;
+    }
+    st[0] += a;
+    st[1] += b;
+    st[2] += c;
+    st[3] += d;
+    st[4] += e;
+    st[5] += f;
+    st[6] += g;
+    st[7] += h;
+  }
+}
+
+static void sha256_simd(uint32_t st[8], const uint8_t *p, size_t len) {
+#if defined(__x86_64__) || defined(__i386__)
+  // SHA-NI has no VEX encoding; clear the upper halves the compiler may have
+  // left dirty so the legacy SSE instructions do not pay a transition stall
+  _mm256_zeroupper();
+#endif
+  const __m128i bswap =
+      _mm_set_epi64x(0x0c0d0e0f08090a0bll, 0x0405060700010203ll);
+  __m128i t = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)st), 0xb1);
+  __m128i s1 = _mm_shuffle_epi32(_mm_loadu_si128((__m128i *)(st + 4)), 0x1b);
+  __m128i s0 = _mm_alignr_epi8(t, s1, 8); // ABEF
+  s1 = _mm_blend_epi16(s1, t, 0xf0);      // CDGH
+
+  for (; len >= 64; p += 64, len -= 64) {
+    __m128i save0 = s0, save1 = s1;
+    __m128i m0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)p), bswap);
+    __m128i m1 =
+        _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(p + 16)), bswap);
+    __m128i m2 =
+        _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(p + 32)), bswap);
+    __m128i m3 =
+        _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(p + 48)), bswap);
+    for (int i = 0; i < 16; i++) {
+      __m128i k = _mm_loadu_si128((const __m128i *)(sha_k + 4 * i));
+      __m128i msg = _mm_add_epi32(m0, k);
+      s1 = _mm_sha256rnds2_epu32(s1, s0, msg);
+      s0 = _mm_sha256rnds2_epu32(s0, s1, _mm_shuffle_epi32(msg, 0x0e));
+      // W[i+16..i+19] from W[i..i+3], W[i+4..i+7], W[i+9..i+12], W[i+12..]
+      __m128i next = _mm_add_epi32(_mm_sha256msg1_epu32(m0, m1),
+                                   _mm_alignr_epi8(m3, m2, 4));
+      next = _mm_sha256msg2_epu32(next, m3);
+      m0 = m1;
+      m1 = m2;
+      m2 = m3;
+      m3 = next;
+    }
+    s0 = _mm_add_epi32(s0, save0);
+    s1 = _mm_add_epi32(s1, save1);
+  }
+
+  t = _mm_shuffle_epi32(s0, 0x1b);  // FEBA
+  s1 = _mm_shuffle_epi32(s1, 0xb1); // DCHG
+  _mm_storeu_si128((__m128i *)st, _mm_blend_epi16(t, s1, 0xf0));
+  _mm_storeu_si128((__m128i *)(st + 4), _mm_alignr_epi8(s1, t, 8));
+}
+
+result_t bench_sha256_plain(uint32_t reps) {
+  uint32_t st[8];
+  memcpy(st, sha_h0, sizeof(st));
+  for (uint32_t i = 0; i < reps; i++)
+    sha256_plain(st, sha_buf, SHA_BYTES);
+  return {(uint64_t)reps * SHA_BYTES, digest(st, sizeof(st))};
+}
+
+result_t bench_sha256_simd(uint32_t reps) {
+  uint32_t st[8];
+  memcpy(st, sha_h0, sizeof(st));
+  for (uint32_t i = 0; i < reps; i++)
+    sha256_simd(st, sha_buf, SHA_BYTES);
+  return {(uint64_t)reps * SHA_BYTES, digest(st, sizeof(st))};
+}
+
+/* VNNI */
+// C = A * B with unsigned 8-bit A (32x256), signed 8-bit B (256x64) and
+// 32-bit C, counting a multiply and an add as two operations. B is packed as
+// the kernel wants it: groups of four k for each column, so one 512-bit row
+// of the packed B feeds _mm512_dpbusd_epi32 with 16 columns. Each group of
+// four bytes of A is broadcast with _mm512_permutexvar_epi32.
+#define GEMM_M 32
+#define GEMM_N 64
+#define GEMM_K 256
+
+static uint8_t gemm_a[GEMM_M * GEMM_K];
+static int8_t gemm_b[GEMM_K * GEMM_N];  // row-major, for the plain version
+static int8_t gemm_bp[GEMM_K * GEMM_N]; // [k / 4][n][k % 4]
+static int32_t gemm_c[GEMM_M * GEMM_N];
+static uint32_t gemm_bcast[16][16];     // gemm_bcast[q] is q in every lane
+
+static void gemm_init(void) {
+  fill(gemm_a, sizeof(gemm_a));
+  fill(gemm_b, sizeof(gemm_b));
+  for (int k = 0; k < GEMM_K; k++)
+    for (int n = 0; n < GEMM_N; n++)
+      gemm_bp[(k / 4 * GEMM_N + n) * 4 + k % 4] = gemm_b[k * GEMM_N + n];
+  for (int q = 0; q < 16; q++)
+    for (int i = 0; i < 16; i++)
+      gemm_bcast[q][i] = (uint32_t)q;
+}
+
+static void gemm_plain(void) {
+  for (int m = 0; m < GEMM_M; m++) {
+    int32_t *c = gemm_c + m * GEMM_N;
+    for (int n = 0; n < GEMM_N; n++)
+      c[n] = 0;
+    for (int k = 0; k < GEMM_K; k++) {
+      int32_t a = gemm_a[m * GEMM_K + k];
+      const int8_t *b = gemm_b + k * GEMM_N;
+      for (int n = 0; n < GEMM_N; n++)
+        c[n] += a * b[n];
+    }
+  }
+}
+
+static void gemm_simd(void) {
+  for (int m = 0; m < GEMM_M; m++) {
+    __m512i c0 = _mm512_setzero_si512(), c1 = _mm512_setzero_si512();
+    __m512i c2 = _mm512_setzero_si512(), c3 = _mm512_setzero_si512();
+    for (int kb = 0; kb < GEMM_K; kb += 64) {
+      __m512i a = _mm512_loadu_si512(gemm_a + m * GEMM_K + kb);
+      for (int q = 0; q < 16; q++) {
+        __m512i aq = _mm512_permutexvar_epi32(
+            _mm512_loadu_si512(gemm_bcast[q]), a);
+        const int8_t *b = gemm_bp + (kb / 4 + q) * GEMM_N * 4;
+        c0 = _mm512_dpbusd_epi32(c0, aq, _mm512_loadu_si512(b));
+        c1 = _mm512_dpbusd_epi32(c1, aq, _mm512_loadu_si512(b + 64));
+        c2 = _mm512_dpbusd_epi32(c2, aq, _mm512_loadu_si512(b + 128));
+        c3 = _mm512_dpbusd_epi32(c3, aq, _mm512_loadu_si512(b + 192));
+      }
+    }
+    int32_t *c = gemm_c + m * GEMM_N;
+    _mm512_storeu_si512(c, c0);
+    _mm512_storeu_si512(c + 16, c1);
+    _mm512_storeu_si512(c + 32, c2);
+    _mm512_storeu_si512(c + 48, c3);
+  }
+}
+
+result_t bench_gemm_u8s8_plain(uint32_t reps) {
+  for (uint32_t i = 0; i < reps; i++)
+    gemm_plain();
+  return {(uint64_t)reps * 2 * GEMM_M * GEMM_N * GEMM_K,
+          digest(gemm_c, sizeof(gemm_c))};
+}
+
+result_t bench_gemm_u8s8_simd(uint32_t reps) {
+  for (uint32_t i = 0; i < reps; i++)
+    gemm_simd();
+  return {(uint64_t)reps * 2 * GEMM_M * GEMM_N * GEMM_K,
+          digest(gemm_c, sizeof(gemm_c))};
+}
+
+/* VBMI */
+// Base64 of 12 KiB of data to 16 KiB of text and back, counting the text
+// bytes. Encoding follows Mula and Lemire: _mm512_permutexvar_epi8 spreads
+// each 3 bytes over 4, _mm512_multishift_epi64_epi8 pulls out the four
+// 6-bit fields and a second permutexvar maps them to ASCII. Decoding maps
+// ASCII back with _mm512_permutex2var_epi8, flagging invalid characters with
+// the sign bit, merges the fields with dpbusd/dpwssd and packs the 3-byte
+// groups with permutexvar. The plain versions are the usual table loops.
+#define B64_RAW 12288
+#define B64_TEXT (B64_RAW / 3 * 4)
+
+static const char b64_chars[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// The 16 spare bytes let the SIMD loops load and store whole vectors
+static uint8_t b64_raw[B64_RAW + 16], b64_text[B64_TEXT];
+static uint8_t b64_back[B64_RAW + 16];
+static uint8_t b64_dec_lut[128];  // value of each ASCII character, or 0x80
+static uint8_t b64_enc_perm[64];  // bytes 1, 0, 2, 1 of each 3-byte group
+static uint8_t b64_dec_pack[64];  // bytes 2, 1, 0 of each 32-bit lane
+static uint64_t b64_shifts[8];    // multishift offsets of the four fields
+static uint32_t b64_w_ab[16], b64_w_cd[16], b64_w_abcd[16];
+
+static void b64_init(void) {
+  fill(b64_raw, B64_RAW);
+  memset(b64_dec_lut, 0x80, sizeof(b64_dec_lut));
+  for (int i = 0; i < 64; i++)
+    b64_dec_lut[(uint8_t)b64_chars[i]] = (uint8_t)i;
+  for (int j = 0; j < 16; j++) {
+    b64_enc_perm[4 * j] = (uint8_t)(3 * j + 1);
+    b64_enc_perm[4 * j + 1] = (uint8_t)(3 * j);
+    b64_enc_perm[4 * j + 2] = (uint8_t)(3 * j + 2);
+    b64_enc_perm[4 * j + 3] = (uint8_t)(3 * j + 1);
+    b64_w_ab[j] = 0x00000140;   // a * 64 + b
+    b64_w_cd[j] = 0x01400000;   // c * 64 + d
+    b64_w_abcd[j] = 0x00001000; // (a * 64 + b) * 4096 in 16-bit halves
+  }
+  for (int i = 0; i < 64; i++)
+    b64_dec_pack[i] = (uint8_t)(i < 48 ? 4 * (i / 3) + 2 - i % 3 : 0);
+  for (int i = 0; i < 8; i++)
+    b64_shifts[i] = 0x3036242a1016040aull;
+}
+
+static void b64_encode_plain(void) {
+  for (size_t i = 0, o = 0; i < B64_RAW; i += 3, o += 4) {
+    uint32_t v = (uint32_t)b64_raw[i] << 16 | (uint32_t)b64_raw[i + 1] << 8 |
+                 b64_raw[i + 2];
+    b64_text[o] = (uint8_t)b64_chars[v >> 18];
+    b64_text[o + 1] = (uint8_t)b64_chars[v >> 12 & 63];
+    b64_text[o + 2] = (uint8_t)b64_chars[v >> 6 & 63];
+    b64_text[o + 3] = (uint8_t)b64_chars[v & 63];
+  }
+}
+
+// Returns whether the text was valid
+static bool b64_decode_plain(void) {
+  uint8_t bad = 0;
+  for (size_t i = 0, o = 0; i < B64_TEXT; i += 4, o += 3) {
+    uint8_t a = b64_dec_lut[b64_text[i] & 0x7f] | (b64_text[i] & 0x80);
+    uint8_t b = b64_dec_lut[b64_text[i + 1] & 0x7f] | (b64_text[i + 1] & 0x80);
+    uint8_t c = b64_dec_lut[b64_text[i + 2] & 0x7f] | (b64_text[i + 2] & 0x80);
+    uint8_t d = b64_dec_lut[b64_text[i + 3] & 0x7f] | (b64_text[i + 3] & 0x80);
+    bad |= (uint8_t)(a | b | c | d);
+    uint32_t v = (uint32_t)a << 18 | (uint32_t)b << 12 | (uint32_t)c << 6 | d;
+    b64_back[o] = (uint8_t)(v >> 16);
+    b64_back[o + 1] = (uint8_t)(v >> 8);
+    b64_back[o + 2] = (uint8_t)v;
+  }
+  return !(bad & 0x80);
+}
+
+static void b64_encode_simd(void) {
+  const __m512i perm = _mm512_loadu_si512(b64_enc_perm);
+  const __m512i shifts = _mm512_loadu_si512(b64_shifts);
+  const __m512i chars = _mm512_loadu_si512(b64_chars);
+  for (size_t i = 0, o = 0; i < B64_RAW; i += 48, o += 64) {
+    __m512i v = _mm512_permutexvar_epi8(perm, _mm512_loadu_si512(b64_raw + i));
+    v = _mm512_multishift_epi64_epi8(shifts, v);
+    _mm512_storeu_si512(b64_text + o, _mm512_permutexvar_epi8(v, chars));
+  }
+}
+
+static bool b64_decode_simd(void) {
+  const __m512i lut_lo = _mm512_loadu_si512(b64_dec_lut);
+  const __m512i lut_hi = _mm512_loadu_si512(b64_dec_lut + 64);
+  const __m512i w_ab = _mm512_loadu_si512(b64_w_ab);
+  const __m512i w_cd = _mm512_loadu_si512(b64_w_cd);
+  const __m512i w_abcd = _mm512_loadu_si512(b64_w_abcd);
+  const __m512i pack = _mm512_loadu_si512(b64_dec_pack);
+  const __m512i zero = _mm512_setzero_si512();
+  __mmask64 bad = 0;
+  for (size_t i = 0, o = 0; i < B64_TEXT; i += 64, o += 48) {
+    __m512i t = _mm512_loadu_si512(b64_text + i);
+    __m512i v = _mm512_permutex2var_epi8(lut_lo, t, lut_hi);
+    bad |= _mm512_cmpgt_epi8_mask(zero, t) | _mm512_cmpgt_epi8_mask(zero, v);
+    __m512i cd = _mm512_dpbusd_epi32(zero, v, w_cd);
+    v = _mm512_dpwssd_epi32(cd, _mm512_dpbusd_epi32(zero, v, w_ab), w_abcd);
+    _mm512_storeu_si512(b64_back + o, _mm512_permutexvar_epi8(pack, v));
+  }
+  return bad == 0;
+}
+
+result_t bench_base64_enc_plain(uint32_t reps) {
+  for (uint32_t i = 0; i < reps; i++)
+    b64_encode_plain();
+  return {(uint64_t)reps * B64_TEXT, digest(b64_text, B64_TEXT)};
+}
+
+result_t bench_base64_enc_simd(uint32_t reps) {
+  for (uint32_t i = 0; i < reps; i++)
+    b64_encode_simd();
+  return {(uint64_t)reps * B64_TEXT, digest(b64_text, B64_TEXT)};
+}
+
+// Both decoders read the text of the plain encoder, and fail the check if
+// the round trip does not give back the data
+result_t bench_base64_dec_plain(uint32_t reps) {
+  b64_encode_plain();
+  bool ok = true;
+  for (uint32_t i = 0; i < reps; i++)
+    ok = b64_decode_plain();
+  ok = ok && memcmp(b64_back, b64_raw, B64_RAW) == 0;
+  return {(uint64_t)reps * B64_TEXT, ok ? digest(b64_back, B64_RAW) : -1};
+}
+
+result_t bench_base64_dec_simd(uint32_t reps) {
+  b64_encode_plain();
+  bool ok = true;
+  for (uint32_t i = 0; i < reps; i++)
+    ok = b64_decode_simd();
+  ok = ok && memcmp(b64_back, b64_raw, B64_RAW) == 0;
+  return {(uint64_t)reps * B64_TEXT, ok ? digest(b64_back, B64_RAW) : -1};
+}
+
+/* BF16 */
+// y = A * x with a 256x256 bf16 matrix and vector and fp32 y, counting a
+// multiply and an add as two operations. A is packed as [k / 2][m][k % 2] so
+// one _mm512_dpbf16_ps covers 16 rows and a pair of k, with that pair of x
+// broadcast to every lane. The plain version widens each bf16 with a shift.
+// The check is the sum of |y|, which tolerates the different rounding.
+#define GEMV_M 256
+#define GEMV_K 256
+
+static uint16_t gemv_a[GEMV_M * GEMV_K];  // row-major, for the plain version
+static uint16_t gemv_ap[GEMV_M * GEMV_K]; // [k / 2][m][k % 2]
+static uint16_t gemv_x[GEMV_K];
+static float gemv_y[GEMV_M];
+
+static uint16_t bf16_rand(void) {
+  float f = (float)rng() / 2147483648.0f - 1.0f;
+  uint32_t bits;
+  memcpy(&bits, &f, 4);
+  return (uint16_t)(bits >> 16);
+}
+
+static float bf16_to_float(uint16_t h) {
+  uint32_t bits = (uint32_t)h << 16;
+  float f;
+  memcpy(&f, &bits, 4);
+  return f;
+}
+
+static void gemv_init(void) {
+  for (int i = 0; i < GEMV_M * GEMV_K; i++)
+    gemv_a[i] = bf16_rand();
+  for (int k = 0; k < GEMV_K; k++)
+    gemv_x[k] = bf16_rand();
+  for (int m = 0; m < GEMV_M; m++)
+    for (int k = 0; k < GEMV_K; k++)
+      gemv_ap[(k / 2 * GEMV_M + m) * 2 + k % 2] = gemv_a[m * GEMV_K + k];
+}
+
+// x86 has no loads or broadcasts for the bf16 vector types
+#if defined(__riscv) || defined(__riscv__)
+static __m512bh loadu_pbh512(const uint16_t *p) {
+  return _avx512_rvv(vle16_v_u16)(p, 32);
+}
+static __m512bh set1_pbh512_pair(const uint16_t *p) {
+  uint32_t v;
+  memcpy(&v, p, 4);
+  return AVX2RVV_CAT(__riscv_vreinterpret_u16,
+                     AVX512_LMUL)(_avx512_rvv(vmv_v_x_u32)(v, 16));
+}
+#else
+static __m512bh loadu_pbh512(const uint16_t *p) {
+  __m512bh a;
+  memcpy(&a, p, 64);
+  return a;
+}
+static __m512bh set1_pbh512_pair(const uint16_t *p) {
+  uint32_t v;
+  memcpy(&v, p, 4);
+  __m512i b = _mm512_set1_epi32((int)v);
+  __m512bh a;
+  memcpy(&a, &b, 64);
+  return a;
+}
+#endif
+
+static void gemv_plain(void) {
+  for (int m = 0; m < GEMV_M; m++) {
+    const uint16_t *a = gemv_a + m * GEMV_K;
+    float y = 0;
+    for (int k = 0; k < GEMV_K; k++)
+      y += bf16_to_float(a[k]) * bf16_to_float(gemv_x[k]);
+    gemv_y[m] = y;
+  }
+}
+
+static void gemv_simd(void) {
+  for (int m = 0; m < GEMV_M; m += 64) {
+    __m512 y0 = _mm512_setzero_ps(), y1 = _mm512_setzero_ps();
+    __m512 y2 = _mm512_setzero_ps(), y3 = _mm512_setzero_ps();
+    for (int k = 0; k < GEMV_K; k += 2) {
+      __m512bh x = set1_pbh512_pair(gemv_x + k);
+      const uint16_t *a = gemv_ap + (k / 2 * GEMV_M + m) * 2;
+      y0 = _mm512_dpbf16_ps(y0, loadu_pbh512(a), x);
+      y1 = _mm512_dpbf16_ps(y1, loadu_pbh512(a + 32), x);
+      y2 = _mm512_dpbf16_ps(y2, loadu_pbh512(a + 64), x);
+      y3 = _mm512_dpbf16_ps(y3, loadu_pbh512(a + 96), x);
+    }
+    _mm512_storeu_ps(gemv_y + m, y0);
+    _mm512_storeu_ps(gemv_y + m + 16, y1);
+    _mm512_storeu_ps(gemv_y + m + 32, y2);
+    _mm512_storeu_ps(gemv_y + m + 48, y3);
+  }
+}
+
+static double gemv_check(void) {
+  double sum = 0;
+  for (int m = 0; m < GEMV_M; m++)
+    sum += fabs(gemv_y[m]);
+  return sum;
+}
+
+result_t bench_gemv_bf16_plain(uint32_t reps) {
+  for (uint32_t i = 0; i < reps; i++)
+    gemv_plain();
+  return {(uint64_t)reps * 2 * GEMV_M * GEMV_K, gemv_check()};
+}
+
+result_t bench_gemv_bf16_simd(uint32_t reps) {
+  for (uint32_t i = 0; i < reps; i++)
+    gemv_simd();
+  return {(uint64_t)reps * 2 * GEMV_M * GEMV_K, gemv_check()};
+}
+
+/* IFMA */
+// Montgomery multiplication modulo a 254-bit odd N, eight independent
+// chains of x <- x * y. The IFMA version runs the eight chains in the lanes
+// of a vector, with five 52-bit limbs per number and _mm512_madd52lo/hi_epu64
+// for the products; the plain version is word-by-word Montgomery with four
+// 64-bit limbs and unsigned __int128. The two use different R (2^260 and
+// 2^256), so the check converts the results out of Montgomery form: both
+// give x * y^MM_CHAIN mod N. Intermediate values stay below 2N, which 4N < R
+// allows, so neither version reduces until the end.
+#define MM_LANES 8
+#define MM_CHAIN 32
+#define MM_MASK52 ((UINT64_C(1) << 52) - 1)
+
+typedef unsigned __int128 u128;
+
+static uint64_t mm_n[4], mm_n0;       // N and -N^-1 mod 2^64
+static uint64_t mm_x[MM_LANES][4];    // x * 2^256 mod N
+static uint64_t mm_y[MM_LANES][4];    // y * 2^256 mod N
+static uint64_t mm_out[MM_LANES][4];  // result of the last chain
+static uint64_t mm52_n[5][MM_LANES];  // limbs of N, one per lane
+static uint64_t mm52_n0[MM_LANES];    // -N^-1 mod 2^52
+static uint64_t mm52_x[5][MM_LANES];  // x * 2^260 mod N, by limb and lane
+static uint64_t mm52_y[5][MM_LANES];  // y * 2^260 mod N
+static uint64_t mm52_one[5][MM_LANES];
+static uint64_t mm52_out[5][MM_LANES];
+
+// r = r - N if r >= N
+static void mm_reduce(uint64_t r[4]) {
+  uint64_t d[4], borrow = 0;
+  for (int i = 0; i < 4; i++) {
+    u128 t = (u128)r[i] - mm_n[i] - borrow;
+    d[i] = (uint64_t)t;
+    borrow = (uint64_t)(t >> 64) & 1;
+  }
+  if (!borrow)
+    memcpy(r, d, sizeof(d));
+}
+
+// r = x * 2^bits mod N for x < N, one doubling at a time
+static void mm_shift_mod(uint64_t r[4], const uint64_t x[4], int bits) {
+  memcpy(r, x, 4 * sizeof(uint64_t));
+  for (int b = 0; b < bits; b++) {
+    for (int i = 3; i > 0; i--)
+      r[i] = r[i] << 1 | r[i - 1] >> 63;
+    r[0] <<= 1;
+    mm_reduce(r);
+  }
+}
+
+static void mm_to52(uint64_t dst[5][MM_LANES], int lane, const uint64_t x[4]) {
+  for (int j = 0; j < 5; j++) {
+    int bit = 52 * j, w = bit / 64, sh = bit % 64;
+    uint64_t v = x[w] >> sh;
+    if (sh > 12 && w < 3)
+      v |= x[w + 1] << (64 - sh);
+    dst[j][lane] = v & MM_MASK52;
+  }
+}
+
+static void mm_from52(uint64_t x[4], const uint64_t src[5][MM_LANES],
+                      int lane) {
+  memset(x, 0, 4 * sizeof(uint64_t));
+  for (int j = 0; j < 5; j++) {
+    int bit = 52 * j, w = bit / 64, sh = bit % 64;
+    x[w] |= src[j][lane] << sh;
+    if (sh > 12 && w < 3)
+      x[w + 1] |= src[j][lane] >> (64 - sh);
+  }
+}
+
+static void mm_init(void) {
+  fill(mm_n, sizeof(mm_n));
+  mm_n[0] |= 1;
+  mm_n[3] = (mm_n[3] & (UINT64_MAX >> 2)) | UINT64_C(1) << 61;
+  uint64_t inv = mm_n[0]; // Newton's iteration doubles the correct bits
+  for (int i = 0; i < 5; i++)
+    inv *= 2 - mm_n[0] * inv;
+  mm_n0 = 0 - inv;
+  for (int i = 0; i < MM_LANES; i++) {
+    uint64_t x[4], y[4];
+    fill(x, sizeof(x));
+    fill(y, sizeof(y));
+    x[3] &= UINT64_MAX >> 3;
+    y[3] &= UINT64_MAX >> 3;
+    mm_shift_mod(mm_x[i], x, 256);
+    mm_shift_mod(mm_y[i], y, 256);
+    uint64_t t[4];
+    mm_shift_mod(t, x, 260);
+    mm_to52(mm52_x, i, t);
+    mm_shift_mod(t, y, 260);
+    mm_to52(mm52_y, i, t);
+    mm_to52(mm52_n, i, mm_n);
+    mm52_n0[i] = mm_n0 & MM_MASK52;
+    mm52_one[0][i] = 1;
+  }
+}
+
+// r = a * b / 2^256 mod N, below 2N for a, b below 2N
+static void mm_mul_plain(uint64_t r[4], const uint64_t a[4],
+                         const uint64_t b[4]) {
+  uint64_t t[6] = {0};
+  for (int i = 0; i < 4; i++) {
+    u128 c = 0;
+    for (int j = 0; j < 4; j++) {
+      c += (u128)a[j] * b[i] + t[j];
+      t[j] = (uint64_t)c;
+      c >>= 64;
+    }
+    c += t[4];
+    t[4] = (uint64_t)c;
+    t[5] = (uint64_t)(c >> 64);
+    uint64_t m = t[0] * mm_n0;
+    c = ((u128)m * mm_n[0] + t[0]) >> 64;
+    for (int j = 1; j < 4; j++) {
+      c += (u128)m * mm_n[j] + t[j];
+      t[j - 1] = (uint64_t)c;
+      c >>= 64;
+    }
+    c += t[4];
+    t[3] = (uint64_t)c;
+    t[4] = t[5] + (uint64_t)(c >> 64);
+  }
+  memcpy(r, t, 4 * sizeof(uint64_t));
+}
+
+static void modmul_plain(void) {
+  for (int i = 0; i < MM_LANES; i++) {
+    uint64_t x[4];
+    memcpy(x, mm_x[i], sizeof(x));
+    for (int k = 0; k < MM_CHAIN; k++)
+      mm_mul_plain(x, x, mm_y[i]);
+    memcpy(mm_out[i], x, sizeof(x));
+  }
+}
+
+// The layer has IFMA but not the plain 64-bit add, shift and and
+#if defined(__riscv) || defined(__riscv__)
+static __m512i mm_add(__m512i a, __m512i b) {
+  return __riscv_vadd(a, b, 8);
+}
+static __m512i mm_srli52(__m512i a) {
+  return __riscv_vsra(a, 52, 8); // limbs stay far below 2^63
+}
+static __m512i mm_and52(__m512i a) {
+  return __riscv_vand(a, (int64_t)MM_MASK52, 8);
+}
+#else
+static __m512i mm_add(__m512i a, __m512i b) {
+  return _mm512_add_epi64(a, b);
+}
+static __m512i mm_srli52(__m512i a) {
+  return _mm512_srli_epi64(a, 52);
+}
+static __m512i mm_and52(__m512i a) {
+  return _mm512_and_si512(a, _mm512_set1_epi64((long long)MM_MASK52));
+}
+#endif
+
+static __m512i mm_load52(const uint64_t v[5][MM_LANES], int j) {
+  return _mm512_loadu_si512(v[j]);
+}
+
+// Operand-scanning in the lanes: for each limb b of B add A * b into T, then
+// m * N with m chosen to clear the lowest limb, which is shifted out. Limbs of
+// T grow past 52 bits and are only normalized at the end; madd52 reads the
+// low 52 bits of A, b, m and N, all of which are normalized.
+static void mm_mul_simd(__m512i &a0, __m512i &a1, __m512i &a2, __m512i &a3,
+                        __m512i &a4, const uint64_t b[5][MM_LANES]) {
+  const __m512i n0 = mm_load52(mm52_n, 0), n1 = mm_load52(mm52_n, 1);
+  const __m512i n2 = mm_load52(mm52_n, 2), n3 = mm_load52(mm52_n, 3);
+  const __m512i n4 = mm_load52(mm52_n, 4);
+  const __m512i ninv = _mm512_loadu_si512(mm52_n0);
+  const __m512i zero = _mm512_setzero_si512();
+  __m512i t0 = zero, t1 = zero, t2 = zero, t3 = zero, t4 = zero, t5;
+  for (int i = 0; i < 5; i++) {
+    __m512i bi = mm_load52(b, i);
+    t0 = _mm512_madd52lo_epu64(t0, a0, bi);
+    t1 = _mm512_madd52lo_epu64(t1, a1, bi);
+    t2 = _mm512_madd52lo_epu64(t2, a2, bi);
+    t3 = _mm512_madd52lo_epu64(t3, a3, bi);
+    t4 = _mm512_madd52lo_epu64(t4, a4, bi);
+    t1 = _mm512_madd52hi_epu64(t1, a0, bi);
+    t2 = _mm512_madd52hi_epu64(t2, a1, bi);
+    t3 = _mm512_madd52hi_epu64(t3, a2, bi);
+    t4 = _mm512_madd52hi_epu64(t4, a3, bi);
+    t5 = _mm512_madd52hi_epu64(zero, a4, bi);
+
+    __m512i m = _mm512_madd52lo_epu64(zero, t0, ninv);
+    t0 = _mm512_madd52lo_epu64(t0, m, n0);
+    t1 = _mm512_madd52lo_epu64(t1, m, n1);
+    t2 = _mm512_madd52lo_epu64(t2, m, n2);
+    t3 = _mm512_madd52lo_epu64(t3, m, n3);
+    t4 = _mm512_madd52lo_epu64(t4, m, n4);
+    t1 = _mm512_madd52hi_epu64(t1, m, n0);
+    t2 = _mm512_madd52hi_epu64(t2, m, n1);
+    t3 = _mm512_madd52hi_epu64(t3, m, n2);
+    t4 = _mm512_madd52hi_epu64(t4, m, n3);
+    t5 = _mm512_madd52hi_epu64(t5, m, n4);
+
+    t0 = mm_add(t1, mm_srli52(t0)); // the low 52 bits of t0 are now zero
+    t1 = t2;
+    t2 = t3;
+    t3 = t4;
+    t4 = t5;
+  }
+  t1 = mm_add(t1, mm_srli52(t0));
+  t2 = mm_add(t2, mm_srli52(t1));
+  t3 = mm_add(t3, mm_srli52(t2));
+  a4 = mm_add(t4, mm_srli52(t3));
+  a0 = mm_and52(t0);
+  a1 = mm_and52(t1);
+  a2 = mm_and52(t2);
+  a3 = mm_and52(t3);
+}
+
+static void modmul_simd(void) {
+  __m512i x0 = mm_load52(mm52_x, 0), x1 = mm_load52(mm52_x, 1);
+  __m512i x2 = mm_load52(mm52_x, 2), x3 = mm_load52(mm52_x, 3);
+  __m512i x4 = mm_load52(mm52_x, 4);
+  for (int k = 0; k < MM_CHAIN; k++)
+    mm_mul_simd(x0, x1, x2, x3, x4, mm52_y);
+  _mm512_storeu_si512(mm52_out[0], x0);
+  _mm512_storeu_si512(mm52_out[1], x1);
+  _mm512_storeu_si512(mm52_out[2], x2);
+  _mm512_storeu_si512(mm52_out[3], x3);
+  _mm512_storeu_si512(mm52_out[4], x4);
+}
+
+// Out of Montgomery form and fully reduced: x * y^MM_CHAIN mod N
+static double modmul_check_plain(void) {
+  static const uint64_t one[4] = {1, 0, 0, 0};
+  uint64_t r[MM_LANES][4];
+  for (int i = 0; i < MM_LANES; i++) {
+    mm_mul_plain(r[i], mm_out[i], one);
+    mm_reduce(r[i]);
+  }
+  return digest(r, sizeof(r));
+}
+
+static double modmul_check_simd(void) {
+  __m512i x0 = mm_load52(mm52_out, 0), x1 = mm_load52(mm52_out, 1);
+  __m512i x2 = mm_load52(mm52_out, 2), x3 = mm_load52(mm52_out, 3);
+  __m512i x4 = mm_load52(mm52_out, 4);
+  mm_mul_simd(x0, x1, x2, x3, x4, mm52_one);
+  uint64_t limbs[5][MM_LANES], r[MM_LANES][4];
+  _mm512_storeu_si512(limbs[0], x0);
+  _mm512_storeu_si512(limbs[1], x1);
+  _mm512_storeu_si512(limbs[2], x2);
+  _mm512_storeu_si512(limbs[3], x3);
+  _mm512_storeu_si512(limbs[4], x4);
+  for (int i = 0; i < MM_LANES; i++) {
+    mm_from52(r[i], limbs, i);
+    mm_reduce(r[i]);
+  }
+  return digest(r, sizeof(r));
+}
+
+result_t bench_modmul256_plain(uint32_t reps) {
+  for (uint32_t i = 0; i < reps; i++)
+    modmul_plain();
+  return {(uint64_t)reps * MM_LANES * MM_CHAIN, modmul_check_plain()};
+}
+
+result_t bench_modmul256_simd(uint32_t reps) {
+  for (uint32_t i = 0; i < reps; i++)
+    modmul_simd();
+  return {(uint64_t)reps * MM_LANES * MM_CHAIN, modmul_check_simd()};
+}
+
+/* CD */
+// A 256-bin histogram of 16 Ki values. The vector version takes 16 indices
+// at a time: _mm512_conflict_epi32 marks the earlier lanes with the same
+// index, so popcount + 1 is how far each lane's count has to advance.
+// Gathering the bins, adding that and scattering leaves the right count in
+// every bin, since the last of the duplicate lanes is written last.
+//
+// histogram draws the indices uniformly, which is the low-conflict case:
+// 16 lanes over 256 bins seldom hold more than one pair of equal indices, so
+// the gather/scatter round trip dominates. histogram_skew sends 7 of every 8
+// indices to 4 hot bins, so most vectors carry long runs of duplicates that
+// the conflict counts have to resolve.
+#define HIST_N 16384
+#define HIST_BINS 256
+
+static uint32_t hist_idx[HIST_N], hist_skew_idx[HIST_N];
+static uint32_t hist[HIST_BINS];
+static const uint32_t hist_ones[16] = {1, 1, 1, 1, 1, 1, 1, 1,
+                                       1, 1, 1, 1, 1, 1, 1, 1};
+
+static void hist_init(void) {
+  for (int i = 0; i < HIST_N; i++)
+    hist_idx[i] = rng() % HIST_BINS;
+  for (int i = 0; i < HIST_N; i++) {
+    uint32_t r = rng();
+    hist_skew_idx[i] = (r & 7) ? (r >> 8) % 4 : (r >> 8) % HIST_BINS;
+  }
+}
+
+#if defined(__riscv) || defined(__riscv__)
+static __m512i hist_add(__m512i a, __m512i b) {
+  return vreinterpret_m512i_i32(
+      __riscv_vadd(vreinterpret_i32_m512i(a), vreinterpret_i32_m512i(b), 16));
+}
+#else
+static __m512i hist_add(__m512i a, __m512i b) {
+  return _mm512_add_epi32(a, b);
+}
+#endif
+
+static result_t hist_plain(const uint32_t *idx, uint32_t reps) {
+  for (uint32_t r = 0; r < reps; r++) {
+    memset(hist, 0, sizeof(hist));
+    for (int i = 0; i < HIST_N; i++)
+      hist[idx[i]]++;
+  }
+  return {(uint64_t)reps * HIST_N, digest(hist, sizeof(hist))};
+}
+
+static result_t hist_simd(const uint32_t *idx, uint32_t reps) {
+  const __m512i ones = _mm512_loadu_si512(hist_ones);
+  for (uint32_t r = 0; r < reps; r++) {
+    memset(hist, 0, sizeof(hist));
+    for (int i = 0; i < HIST_N; i += 16) {
+      __m512i v = _mm512_loadu_si512(idx + i);
+      __m512i n =
+          hist_add(_mm512_popcnt_epi32(_mm512_conflict_epi32(v)), ones);
+      __m512i bins = _mm512_i32gather_epi32(v, hist, 4);
+      _mm512_i32scatter_epi32(hist, v, hist_add(bins, n), 4);
+    }
+  }
+  return {(uint64_t)reps * HIST_N, digest(hist, sizeof(hist))};
+}
+
+result_t bench_histogram_plain(uint32_t reps) {
+  return hist_plain(hist_idx, reps);
+}
+
+result_t bench_histogram_simd(uint32_t reps) {
+  return hist_simd(hist_idx, reps);
+}
+
+result_t bench_histogram_skew_plain(uint32_t reps) {
+  return hist_plain(hist_skew_idx, reps);
+}
+
+result_t bench_histogram_skew_simd(uint32_t reps) {
+  return hist_simd(hist_skew_idx, reps);
+}
+
+/* Runner */
+struct bench_t {
+  const char *name;
+  const char *unit;
+  bench_fn simd, plain;
+};
+
+static const bench_t benches[] = {
+#define _(name, unit) {#name, unit, bench_##name##_simd, bench_##name##_plain},
+    BENCH_LIST(_)
+#undef _
+};
+
+static double min_seconds = 0.25;
+
+// Double reps until a run takes min_seconds, then report units per second
+static double rate(bench_fn fn) {
+  typedef std::chrono::steady_clock clock;
+  for (uint32_t reps = 1;; reps *= 2) {
+    clock::time_point t0 = clock::now();
+    result_t r = fn(reps);
+    double s = std::chrono::duration<double>(clock::now() - t0).count();
+    if (s >= min_seconds || reps >= 1u << 30)
+      return r.units / s;
+  }
+}
+
+static const char *scaled(double r, const char *unit, char *buf, size_t n) {
+  const char *prefix = r >= 1e9 ? "G" : r >= 1e6 ? "M" : "k";
+  double div = r >= 1e9 ? 1e9 : r >= 1e6 ? 1e6 : 1e3;
+  snprintf(buf, n, "%8.2f %s%s/s", r / div, prefix, unit);
+  return buf;
+}
+
+static void init(void) {
+  aes_init();
+  crc_init();
+  ms_init();
+  sha_init();
+  gemm_init();
+  b64_init();
+  gemv_init();
+  mm_init();
+  hist_init();
+}
+
+} // namespace BENCH
+
+int main(int argc, char **argv) {
+  using namespace BENCH;
+  init();
+  int failed = 0;
+  printf("%-16s %16s %16s %9s\n", "benchmark", "intrinsics", "plain C",
+         "speedup");
+  for (const bench_t &b : benches) {
+    bool selected = argc < 2;
+    for (int i = 1; i < argc; i++)
+      selected |= strcmp(argv[i], b.name) == 0;
+    if (!selected)
+      continue;
+    double cs = b.simd(1).check, cp = b.plain(1).check;
+    if (fabs(cs - cp) > 1e-4 * fmax(1.0, fabs(cp))) {
+      printf("%-16s check mismatch: %.9g vs %.9g\n", b.name, cs, cp);
+      failed = 1;
+      continue;
+    }
+    double rs = rate(b.simd), rp = rate(b.plain);
+    char s1[32], s2[32];
+    printf("%-16s %16s %16s %8.2fx\n", b.name,
+           scaled(rs, b.unit, s1, sizeof(s1)),
+           scaled(rp, b.unit, s2, sizeof(s2)), rs / rp);
+  }
+  return failed;
+}
@@ -1,6 +1,7 @@
 #include <assert.h>
 #include <float.h>
 #include <inttypes.h>
+#include <limits.h>
 #include <math.h>
 #include <stdalign.h>
 #include <stdint.h>
@@ -7675,87 +7676,62 @@ result_t test_mm_cvtepu8_epi64(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
   return validate_int64(ret, i0, i1);
 }
 
-#define MM_DP_PD_TEST_CASE_WITH(imm8)                                          \
-  do {                                                                         \
-    const double *_a = (const double *)impl.test_cases_float_pointer1;         \
-    const double *_b = (const double *)impl.test_cases_float_pointer2;         \
-    const int imm = imm8;                                                      \
-    double d[2];                                                               \
-    double sum = 0;                                                            \
-    for (size_t i = 0; i < 2; i++)                                             \
-      sum += ((imm) & (1 << (i + 4))) ? _a[i] * _b[i] : 0;                     \
-    for (size_t i = 0; i < 2; i++)                                             \
-      d[i] = (imm & (1 << i)) ? sum : 0;                                       \
-    __m128d a = load_m128d(_a);                                                \
-    __m128d b = load_m128d(_b);                                                \
-    __m128d ret = _mm_dp_pd(a, b, imm);                                        \
-    if (validate_double(ret, d[0], d[1]) != TEST_SUCCESS)                      \
-      return TEST_FAIL;                                                        \
-  } while (0)
+// Dot products with the products summed in the x86 order. The products go
+// through memory so that the compiler cannot contract them into FMAs.
+static void dp_ps_reference(const float *a, const float *b, int imm8,
+                            float *r) {
+  volatile float p[4];
+  for (int i = 0; i < 4; i++)
+    p[i] = (imm8 >> (4 + i)) & 1 ? a[i] * b[i] : 0.0f;
+  float sum = (p[0] + p[1]) + (p[2] + p[3]);
+  for (int i = 0; i < 4; i++)
+    r[i] = (imm8 >> i) & 1 ? sum : 0.0f;
+}
 
-#define GENERATE_MM_DP_PD_TEST_CASES                                           \
-  MM_DP_PD_TEST_CASE_WITH(0xF0);                                               \
-  MM_DP_PD_TEST_CASE_WITH(0xF1);                                               \
-  MM_DP_PD_TEST_CASE_WITH(0xF2);                                               \
-  MM_DP_PD_TEST_CASE_WITH(0xFF);                                               \
-  MM_DP_PD_TEST_CASE_WITH(0x10);                                               \
-  MM_DP_PD_TEST_CASE_WITH(0x11);                                               \
-  MM_DP_PD_TEST_CASE_WITH(0x12);                                               \
-  MM_DP_PD_TEST_CASE_WITH(0x13);                                               \
-  MM_DP_PD_TEST_CASE_WITH(0x00);                                               \
-  MM_DP_PD_TEST_CASE_WITH(0x01);                                               \
-  MM_DP_PD_TEST_CASE_WITH(0x02);                                               \
-  MM_DP_PD_TEST_CASE_WITH(0x03);                                               \
-  MM_DP_PD_TEST_CASE_WITH(0x20);                                               \
-  MM_DP_PD_TEST_CASE_WITH(0x21);                                               \
-  MM_DP_PD_TEST_CASE_WITH(0x22);                                               \
-  MM_DP_PD_TEST_CASE_WITH(0x23);
+static void dp_pd_reference(const double *a, const double *b, int imm8,
+                            double *r) {
+  volatile double p[2];
+  for (int i = 0; i < 2; i++)
+    p[i] = (imm8 >> (4 + i)) & 1 ? a[i] * b[i] : 0.0;
+  double sum = p[0] + p[1];
+  for (int i = 0; i < 2; i++)
+    r[i] = (imm8 >> i) & 1 ? sum : 0.0;
+}
 
 result_t test_mm_dp_pd(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
-  // #ifdef ENABLE_TEST_ALL
-  //   GENERATE_MM_DP_PD_TEST_CASES
-  //   return TEST_SUCCESS;
-  // #else
-  return TEST_UNIMPL;
-  // #endif  // ENABLE_TEST_ALL
-}
+  const double *_a = (const double *)impl.test_cases_float_pointer1;
+  const double *_b = (const double *)impl.test_cases_float_pointer2;
+  __m128d a = load_m128d(_a);
+  __m128d b = load_m128d(_b);
+  double _c[2];
+#define TEST_IMPL(IDX)                                                         \
+  dp_pd_reference(_a, _b, IDX, _c);                                            \
+  if (validate_128bits(_mm_dp_pd(a, b, IDX), load_m128d(_c)) != TEST_SUCCESS) {\
+    return TEST_FAIL;                                                          \
+  }
 
-#define MM_DP_PS_TEST_CASE_WITH(IMM)                                           \
-  do {                                                                         \
-    const float *_a = impl.test_cases_float_pointer1;                          \
-    const float *_b = impl.test_cases_float_pointer2;                          \
-    const int imm = IMM;                                                       \
-    __m128 a = load_m128(_a);                                                  \
-    __m128 b = load_m128(_b);                                                  \
-    __m128 out = _mm_dp_ps(a, b, imm);                                         \
-    float r[4]; /* the reference */                                            \
-    float sum = 0;                                                             \
-    for (size_t i = 0; i < 4; i++)                                             \
-      sum += ((imm) & (1 << (i + 4))) ? _a[i] * _b[i] : 0;                     \
-    for (size_t i = 0; i < 4; i++)                                             \
-      r[i] = (imm & (1 << i)) ? sum : 0;                                       \
-    /* the epsilon has to be large enough, otherwise test suite fails. */      \
-    if (validate_float_epsilon(out, r[0], r[1], r[2], r[3], 2050.0f) !=        \
-        TEST_SUCCESS)                                                          \
-      return TEST_FAIL;                                                        \
-  } while (0)
+  IMM_256_ITER
+#undef TEST_IMPL
 
-#define GENERATE_MM_DP_PS_TEST_CASES                                           \
-  MM_DP_PS_TEST_CASE_WITH(0xFF);                                               \
-  MM_DP_PS_TEST_CASE_WITH(0x7F);                                               \
-  MM_DP_PS_TEST_CASE_WITH(0x9F);                                               \
-  MM_DP_PS_TEST_CASE_WITH(0x2F);                                               \
-  MM_DP_PS_TEST_CASE_WITH(0x0F);                                               \
-  MM_DP_PS_TEST_CASE_WITH(0x23);                                               \
-  MM_DP_PS_TEST_CASE_WITH(0xB5);
+  return TEST_SUCCESS;
+}
 
 result_t test_mm_dp_ps(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
-  // #ifdef ENABLE_TEST_ALL
-  //   GENERATE_MM_DP_PS_TEST_CASES
-  //   return TEST_SUCCESS;
-  // #else
-  return TEST_UNIMPL;
-  // #endif  // ENABLE_TEST_ALL
+  const float *_a = impl.test_cases_float_pointer1;
+  const float *_b = impl.test_cases_float_pointer2;
+  __m128 a = load_m128(_a);
+  __m128 b = load_m128(_b);
+  float _c[4];
+#define TEST_IMPL(IDX)                                                         \
+  dp_ps_reference(_a, _b, IDX, _c);                                            \
+  if (validate_128bits(_mm_dp_ps(a, b, IDX), load_m128(_c)) != TEST_SUCCESS) { \
+    return TEST_FAIL;                                                          \
+  }
+
+  IMM_256_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
 }
 
 result_t test_mm_extract_epi32(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
@@ -8098,33 +8074,28 @@ result_t test_mm_minpos_epu16(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
 }
 
 result_t test_mm_mpsadbw_epu8(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
-  // #ifdef ENABLE_TEST_ALL
-  //   const uint8_t *_a = (const uint8_t *)impl.test_cases_int_pointer1;
-  //   const uint8_t *_b = (const uint8_t *)impl.test_cases_int_pointer2;
-  //
-  //   __m128i a = load_m128i(_a);
-  //   __m128i b = load_m128i(_b);
-  //   __m128i c;
-  // #define TEST_IMPL(IDX)
-  //   uint8_t a_offset##IDX = ((IDX >> 2) & 0x1) * 4;
-  //   uint8_t b_offset##IDX = (IDX & 0x3) * 4;
-  //
-  //   uint16_t d##IDX[8] = {};
-  //   for (int i = 0; i < 8; i++) {
-  //     for (int j = 0; j < 4; j++) {
-  //       d##IDX[i] += abs(_a[(a_offset##IDX + i) + j] - _b[b_offset##IDX +
-  //       j]);
-  //     }
-  //   }
-  //   c = _mm_mpsadbw_epu8(a, b, IDX);
-  // CHECK_RESULT(VALIDATE_UINT16_M128(c,d##IDX));
-  //
-  //   IMM_8_ITER
-  // #undef TEST_IMPL
-  //   return TEST_SUCCESS;
-  // #else
-  return TEST_UNIMPL;
-  // #endif  // ENABLE_TEST_ALL
+  const uint8_t *_a = (const uint8_t *)impl.test_cases_int_pointer1;
+  const uint8_t *_b = (const uint8_t *)impl.test_cases_int_pointer2;
+
+  __m128i a = load_m128i(_a);
+  __m128i b = load_m128i(_b);
+  __m128i c;
+#define TEST_IMPL(IDX)                                                         \
+  uint8_t a_offset##IDX = ((IDX >> 2) & 0x1) * 4;                              \
+  uint8_t b_offset##IDX = (IDX & 0x3) * 4;                                     \
+                                                                               \
+  uint16_t d##IDX[8] = {};                                                     \
+  for (int i = 0; i < 8; i++) {                                                \
+    for (int j = 0; j < 4; j++) {                                              \
+      d##IDX[i] += abs(_a[(a_offset##IDX + i) + j] - _b[b_offset##IDX + j]);   \
+    }                                                                          \
+  }                                                                            \
+  c = _mm_mpsadbw_epu8(a, b, IDX);                                             \
+  CHECK_RESULT(VALIDATE_UINT16_M128(c, d##IDX));
+
+  IMM_8_ITER
+#undef TEST_IMPL
+  return TEST_SUCCESS;
 }
 
 result_t test_mm_mul_epi32(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
@@ -8567,13 +8538,234 @@ result_t test_mm_testz_si128(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
 
 /* SSE4.2 */
 
+// Scalar model of the string comparisons on 16 raw bytes: IntRes2 as a bit
+// mask, along with the element count and the resolved lengths.
+struct sidd_result {
+  int res, n, la, lb;
+};
+
+static int sidd_element(const uint8_t *p, int i, int imm8) {
+  if (imm8 & _SIDD_UWORD_OPS) {
+    uint16_t w = p[2 * i] | (p[2 * i + 1] << 8);
+    return (imm8 & _SIDD_SBYTE_OPS) ? (int16_t)w : w;
+  }
+  return (imm8 & _SIDD_SBYTE_OPS) ? (int8_t)p[i] : p[i];
+}
+
+static int sidd_strlen(const uint8_t *p, int imm8) {
+  int n = (imm8 & _SIDD_UWORD_OPS) ? 8 : 16;
+  for (int i = 0; i < n; i++) {
+    if (sidd_element(p, i, imm8) == 0)
+      return i;
+  }
+  return n;
+}
+
+static sidd_result sidd_reference(const uint8_t *a, int la, const uint8_t *b,
+                                  int lb, int imm8) {
+  sidd_result r;
+  r.n = (imm8 & _SIDD_UWORD_OPS) ? 8 : 16;
+  // saturate before negating, which would overflow for INT_MIN
+  r.la = (la <= -r.n || la >= r.n) ? r.n : (la < 0 ? -la : la);
+  r.lb = (lb <= -r.n || lb >= r.n) ? r.n : (lb < 0 ? -lb : lb);
+  r.res = 0;
+  for (int j = 0; j < r.n; j++) {
+    int bj = sidd_element(b, j, imm8);
+    bool bit = false;
+    switch (imm8 & 0x0c) {
+    case _SIDD_CMP_EQUAL_ANY:
+      for (int i = 0; i < r.la && j < r.lb; i++)
+        bit |= sidd_element(a, i, imm8) == bj;
+      break;
+    case _SIDD_CMP_RANGES:
+      for (int i = 0; i + 1 < r.la && j < r.lb; i += 2)
+        bit |= sidd_element(a, i, imm8) <= bj &&
+               bj <= sidd_element(a, i + 1, imm8);
+      break;
+    case _SIDD_CMP_EQUAL_EACH:
+      if (j < r.la && j < r.lb)
+        bit = sidd_element(a, j, imm8) == bj;
+      else
+        bit = j >= r.la && j >= r.lb;
+      break;
+    default:
+      bit = true;
+      for (int i = 0; i < r.la && j + i < r.n; i++)
+        bit &= j + i < r.lb &&
+               sidd_element(a, i, imm8) == sidd_element(b, j + i, imm8);
+      break;
+    }
+    r.res |= bit << j;
+  }
+  switch (imm8 & 0x30) {
+  case _SIDD_NEGATIVE_POLARITY:
+    r.res ^= (1 << r.n) - 1;
+    break;
+  case _SIDD_MASKED_NEGATIVE_POLARITY:
+    r.res ^= (1 << r.lb) - 1;
+    break;
+  }
+  return r;
+}
+
+static int sidd_index(const sidd_result &r, int imm8) {
+  if (r.res == 0)
+    return r.n;
+  if (imm8 & _SIDD_MOST_SIGNIFICANT)
+    return 31 - __builtin_clz(r.res);
+  return __builtin_ctz(r.res);
+}
+
+static void sidd_mask(const sidd_result &r, int imm8, uint8_t *mask) {
+  memset(mask, 0, 16);
+  if (!(imm8 & _SIDD_UNIT_MASK)) {
+    mask[0] = r.res & 0xff;
+    mask[1] = r.res >> 8;
+    return;
+  }
+  int size = 16 / r.n;
+  for (int j = 0; j < r.n; j++)
+    memset(mask + j * size, (r.res >> j) & 1 ? 0xff : 0, size);
+}
+
+// Explicit lengths from -20 to 20, plus INT_MIN and INT_MIN + 1, whose
+// absolute value does not fit or only just fits in an int.
+static int sidd_test_len(uint32_t i) {
+  int l = (int)(i % 43) - 20;
+  return l <= 20 ? l : INT_MIN + (l - 21);
+}
+
+// Inputs over a small alphabet with nulls and sign bits mixed in, so that
+// every mode sees matches, misses and string ends; explicit lengths cover
+// negative and oversized values.
+#define SIDD_TEST_INPUTS                                                       \
+  static const uint8_t alphabet[8] = {'a', 'b', 'c', 'd', 0x7f, 0x80, 0xf0, 1};\
+  const uint8_t *_a = (const uint8_t *)impl.test_cases_int_pointer1;           \
+  const uint8_t *_b = (const uint8_t *)impl.test_cases_int_pointer2;           \
+  uint8_t a_bytes[16], b_bytes[16];                                            \
+  for (int k = 0; k < 16; k++) {                                               \
+    a_bytes[k] = (_a[k] & 7) ? alphabet[(_a[k] >> 3) & 7] : 0;                 \
+    b_bytes[k] = (_b[k] & 7) ? alphabet[(_b[k] >> 3) & 7] : 0;                 \
+  }                                                                            \
+  int la = sidd_test_len(iter);                                                \
+  int lb = sidd_test_len(iter * 7);                                            \
+  (void)la;                                                                    \
+  (void)lb;                                                                    \
+  __m128i a = load_m128i(a_bytes);                                             \
+  __m128i b = load_m128i(b_bytes);
+
+#define SIDD_TEST_MODES(TEST)                                                  \
+  TEST(_SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_LEAST_SIGNIFICANT)        \
+  TEST(_SIDD_SBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_MASKED_POSITIVE_POLARITY |\
+       _SIDD_MOST_SIGNIFICANT)                                                 \
+  TEST(_SIDD_UWORD_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_MASKED_NEGATIVE_POLARITY) \
+  TEST(_SIDD_UBYTE_OPS | _SIDD_CMP_RANGES | _SIDD_NEGATIVE_POLARITY |          \
+       _SIDD_MOST_SIGNIFICANT)                                                 \
+  TEST(_SIDD_SBYTE_OPS | _SIDD_CMP_RANGES)                                     \
+  TEST(_SIDD_UWORD_OPS | _SIDD_CMP_RANGES | _SIDD_UNIT_MASK)                   \
+  TEST(_SIDD_SWORD_OPS | _SIDD_CMP_RANGES | _SIDD_MASKED_NEGATIVE_POLARITY |   \
+       _SIDD_MOST_SIGNIFICANT)                                                 \
+  TEST(_SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_EACH | _SIDD_NEGATIVE_POLARITY |      \
+       _SIDD_UNIT_MASK)                                                        \
+  TEST(_SIDD_SWORD_OPS | _SIDD_CMP_EQUAL_EACH | _SIDD_MASKED_POSITIVE_POLARITY)\
+  TEST(_SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ORDERED | _SIDD_MOST_SIGNIFICANT)     \
+  TEST(_SIDD_SBYTE_OPS | _SIDD_CMP_EQUAL_ORDERED | _SIDD_NEGATIVE_POLARITY |   \
+       _SIDD_UNIT_MASK)                                                        \
+  TEST(_SIDD_UWORD_OPS | _SIDD_CMP_EQUAL_ORDERED |                             \
+       _SIDD_MASKED_NEGATIVE_POLARITY)
+
+#define SIDD_ESTR_REFERENCE(imm8)                                              \
+  sidd_result r = sidd_reference(a_bytes, la, b_bytes, lb, imm8);
+#define SIDD_ISTR_REFERENCE(imm8)                                              \
+  sidd_result r = sidd_reference(a_bytes, sidd_strlen(a_bytes, imm8),          \
+                                 b_bytes, sidd_strlen(b_bytes, imm8), imm8);
+
+result_t test_mm_cmpestra(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
+  SIDD_TEST_INPUTS
+#define TEST_MODE(imm8)                                                        \
+  {                                                                            \
+    SIDD_ESTR_REFERENCE(imm8)                                                  \
+    ASSERT_RETURN(_mm_cmpestra(a, la, b, lb, imm8) ==                          \
+                  (r.res == 0 && r.lb == r.n));                                \
+  }
+  SIDD_TEST_MODES(TEST_MODE)
+#undef TEST_MODE
+  return TEST_SUCCESS;
+}
+
 result_t test_mm_cmpestrc(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
-  // #ifdef ENABLE_TEST_ALL
-  //   GENERATE_MM_CMPESTRC_TEST_CASES
-  //   return TEST_SUCCESS;
-  // #else
-  return TEST_UNIMPL;
-  // #endif  // ENABLE_TEST_ALL
+  SIDD_TEST_INPUTS
+#define TEST_MODE(imm8)                                                        \
+  {                                                                            \
+    SIDD_ESTR_REFERENCE(imm8)                                                  \
+    ASSERT_RETURN(_mm_cmpestrc(a, la, b, lb, imm8) == (r.res != 0));           \
+  }
+  SIDD_TEST_MODES(TEST_MODE)
+#undef TEST_MODE
+  return TEST_SUCCESS;
+}
+
+result_t test_mm_cmpestri(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
+  SIDD_TEST_INPUTS
+#define TEST_MODE(imm8)                                                        \
+  {                                                                            \
+    SIDD_ESTR_REFERENCE(imm8)                                                  \
+    ASSERT_RETURN(_mm_cmpestri(a, la, b, lb, imm8) == sidd_index(r, imm8));    \
+  }
+  SIDD_TEST_MODES(TEST_MODE)
+#undef TEST_MODE
+  return TEST_SUCCESS;
+}
+
+result_t test_mm_cmpestrm(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
+  SIDD_TEST_INPUTS
+#define TEST_MODE(imm8)                                                        \
+  {                                                                            \
+    SIDD_ESTR_REFERENCE(imm8)                                                  \
+    uint8_t mask[16];                                                          \
+    sidd_mask(r, imm8, mask);                                                  \
+    ASSERT_RETURN(validate_128bits(_mm_cmpestrm(a, la, b, lb, imm8),           \
+                                   load_m128i(mask)) == TEST_SUCCESS);         \
+  }
+  SIDD_TEST_MODES(TEST_MODE)
+#undef TEST_MODE
+  return TEST_SUCCESS;
+}
+
+result_t test_mm_cmpestro(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
+  SIDD_TEST_INPUTS
+#define TEST_MODE(imm8)                                                        \
+  {                                                                            \
+    SIDD_ESTR_REFERENCE(imm8)                                                  \
+    ASSERT_RETURN(_mm_cmpestro(a, la, b, lb, imm8) == ((r.res & 1) != 0));     \
+  }
+  SIDD_TEST_MODES(TEST_MODE)
+#undef TEST_MODE
+  return TEST_SUCCESS;
+}
+
+result_t test_mm_cmpestrs(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
+  SIDD_TEST_INPUTS
+#define TEST_MODE(imm8)                                                        \
+  {                                                                            \
+    SIDD_ESTR_REFERENCE(imm8)                                                  \
+    ASSERT_RETURN(_mm_cmpestrs(a, la, b, lb, imm8) == (r.la < r.n));           \
+  }
+  SIDD_TEST_MODES(TEST_MODE)
+#undef TEST_MODE
+  return TEST_SUCCESS;
+}
+
+result_t test_mm_cmpestrz(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
+  SIDD_TEST_INPUTS
+#define TEST_MODE(imm8)                                                        \
+  {                                                                            \
+    SIDD_ESTR_REFERENCE(imm8)                                                  \
+    ASSERT_RETURN(_mm_cmpestrz(a, la, b, lb, imm8) == (r.lb < r.n));           \
+  }
+  SIDD_TEST_MODES(TEST_MODE)
+#undef TEST_MODE
+  return TEST_SUCCESS;
 }
 
 result_t test_mm_cmpgt_epi64(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
@@ -8591,22 +8783,91 @@ result_t test_mm_cmpgt_epi64(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
   return validate_int64(iret, result[0], result[1]);
 }
 
+result_t test_mm_cmpistra(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
+  SIDD_TEST_INPUTS
+#define TEST_MODE(imm8)                                                        \
+  {                                                                            \
+    SIDD_ISTR_REFERENCE(imm8)                                                  \
+    ASSERT_RETURN(_mm_cmpistra(a, b, imm8) == (r.res == 0 && r.lb == r.n));    \
+  }
+  SIDD_TEST_MODES(TEST_MODE)
+#undef TEST_MODE
+  return TEST_SUCCESS;
+}
+
+result_t test_mm_cmpistrc(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
+  SIDD_TEST_INPUTS
+#define TEST_MODE(imm8)                                                        \
+  {                                                                            \
+    SIDD_ISTR_REFERENCE(imm8)                                                  \
+    ASSERT_RETURN(_mm_cmpistrc(a, b, imm8) == (r.res != 0));                   \
+  }
+  SIDD_TEST_MODES(TEST_MODE)
+#undef TEST_MODE
+  return TEST_SUCCESS;
+}
+
+result_t test_mm_cmpistri(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
+  SIDD_TEST_INPUTS
+#define TEST_MODE(imm8)                                                        \
+  {                                                                            \
+    SIDD_ISTR_REFERENCE(imm8)                                                  \
+    ASSERT_RETURN(_mm_cmpistri(a, b, imm8) == sidd_index(r, imm8));            \
+  }
+  SIDD_TEST_MODES(TEST_MODE)
+#undef TEST_MODE
+  return TEST_SUCCESS;
+}
+
+result_t test_mm_cmpistrm(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
+  SIDD_TEST_INPUTS
+#define TEST_MODE(imm8)                                                        \
+  {                                                                            \
+    SIDD_ISTR_REFERENCE(imm8)                                                  \
+    uint8_t mask[16];                                                          \
+    sidd_mask(r, imm8, mask);                                                  \
+    ASSERT_RETURN(validate_128bits(_mm_cmpistrm(a, b, imm8),                   \
+                                   load_m128i(mask)) == TEST_SUCCESS);         \
+  }
+  SIDD_TEST_MODES(TEST_MODE)
+#undef TEST_MODE
+  return TEST_SUCCESS;
+}
+
+result_t test_mm_cmpistro(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
+  SIDD_TEST_INPUTS
+#define TEST_MODE(imm8)                                                        \
+  {                                                                            \
+    SIDD_ISTR_REFERENCE(imm8)                                                  \
+    ASSERT_RETURN(_mm_cmpistro(a, b, imm8) == ((r.res & 1) != 0));             \
+  }
+  SIDD_TEST_MODES(TEST_MODE)
+#undef TEST_MODE
+  return TEST_SUCCESS;
+}
+
 result_t test_mm_cmpistrs(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
-  // #ifdef ENABLE_TEST_ALL
-  //   GENERATE_MM_CMPISTRS_TEST_CASES
-  //   return TEST_SUCCESS;
-  // #else
-  return TEST_UNIMPL;
-  // #endif  // ENABLE_TEST_ALL
+  SIDD_TEST_INPUTS
+#define TEST_MODE(imm8)                                                        \
+  {                                                                            \
+    SIDD_ISTR_REFERENCE(imm8)                                                  \
+    ASSERT_RETURN(_mm_cmpistrs(a, b, imm8) == (r.la < r.n));                   \
+  }
+  SIDD_TEST_MODES(TEST_MODE)
+#undef TEST_MODE
+  return TEST_SUCCESS;
 }
 
 result_t test_mm_cmpistrz(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
-  // #ifdef ENABLE_TEST_ALL
-  //   GENERATE_MM_CMPISTRZ_TEST_CASES
-  //   return TEST_SUCCESS;
-  // #else
-  return TEST_UNIMPL;
-  // #endif  // ENABLE_TEST_ALL
+  SIDD_TEST_INPUTS
+#define TEST_MODE(imm8)                                                        \
+  {                                                                            \
+    SIDD_ISTR_REFERENCE(imm8)                                                  \
+    ASSERT_RETURN(_mm_cmpistrz(a, b, imm8) == (r.lb < r.n));                   \
+  }
+  SIDD_TEST_MODES(TEST_MODE)
+#undef TEST_MODE
+  return TEST_SUCCESS;
 }
 
 result_t test_mm_crc32_u16(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
@@ -8641,114 +8902,121 @@ result_t test_mm_crc32_u8(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
   return TEST_SUCCESS;
 }
 
+// _sse2rvv_crc32c is a helper of sse2rvv.h with no x86 counterpart. Lengths
+// around the 64-byte fold block and the 128-byte threshold of the Zvbc path,
+// from a start that walks through every alignment, must match _mm_crc32_u8
+// applied byte by byte.
+result_t test_sse2rvv_crc32c(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(__riscv) || defined(__riscv__)
+  static const size_t lens[] = {0,   1,   7,   8,   63,  64,  65,  100, 127,
+                                128, 129, 191, 192, 200, 255, 256, 300};
+  uint8_t buf[308];
+  for (size_t i = 0; i < sizeof(buf); i++)
+    buf[i] = (uint8_t)impl.test_cases_ints[(iter + i) % MAX_TEST_VALUE];
+  uint32_t crc = *(const uint32_t *)impl.test_cases_int_pointer1;
+  const uint8_t *p = buf + iter % 8;
+
+  // prefix[i] is the CRC of the first i bytes
+  uint32_t prefix[301];
+  prefix[0] = crc;
+  for (size_t i = 0; i < 300; i++)
+    prefix[i + 1] = _mm_crc32_u8(prefix[i], p[i]);
+  for (size_t l = 0; l < sizeof(lens) / sizeof(lens[0]); l++)
+    ASSERT_RETURN(_sse2rvv_crc32c(crc, p, lens[l]) == prefix[lens[l]]);
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif
+}
+
 /* AES */
 result_t test_mm_aesenc_si128(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
-  // #ifdef ENABLE_TEST_ALL
-  //   const int32_t *a = (int32_t *)impl.test_cases_int_pointer1;
-  //   const int32_t *b = (int32_t *)impl.test_cases_int_pointer2;
-  //   __m128i data = _mm_loadu_si128((const __m128i *)a);
-  //   __m128i rk = _mm_loadu_si128((const __m128i *)b);
-  //
-  //   __m128i resultReference = aesenc_128_reference(data, rk);
-  //   __m128i resultIntrinsic = _mm_aesenc_si128(data, rk);
-  //
-  //   return validate_128bits(resultReference, resultIntrinsic);
-  // #else
-  return TEST_UNIMPL;
-  // #endif  // ENABLE_TEST_ALL
+  const int32_t *a = (int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *b = (int32_t *)impl.test_cases_int_pointer2;
+  __m128i data = _mm_loadu_si128((const __m128i *)a);
+  __m128i rk = _mm_loadu_si128((const __m128i *)b);
+
+  __m128i resultReference = aesenc_128_reference(data, rk);
+  __m128i resultIntrinsic = _mm_aesenc_si128(data, rk);
+
+  return validate_128bits(resultReference, resultIntrinsic);
 }
 
 result_t test_mm_aesdec_si128(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
-  // #ifdef ENABLE_TEST_ALL
-  //   const int32_t *a = (int32_t *)impl.test_cases_int_pointer1;
-  //   const int32_t *b = (int32_t *)impl.test_cases_int_pointer2;
-  //   __m128i data = _mm_loadu_si128((const __m128i *)a);
-  //   __m128i rk = _mm_loadu_si128((const __m128i *)b);
-  //
-  //   __m128i resultReference = aesdec_128_reference(data, rk);
-  //   __m128i resultIntrinsic = _mm_aesdec_si128(data, rk);
-  //
-  //   return validate_128bits(resultReference, resultIntrinsic);
-  // #else
-  return TEST_UNIMPL;
-  // #endif  // ENABLE_TEST_ALL
+  const int32_t *a = (int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *b = (int32_t *)impl.test_cases_int_pointer2;
+  __m128i data = _mm_loadu_si128((const __m128i *)a);
+  __m128i rk = _mm_loadu_si128((const __m128i *)b);
+
+  __m128i resultReference = aesdec_128_reference(data, rk);
+  __m128i resultIntrinsic = _mm_aesdec_si128(data, rk);
+
+  return validate_128bits(resultReference, resultIntrinsic);
 }
 
 result_t test_mm_aesenclast_si128(const SSE2RVV_TEST_IMPL &impl,
-                                  // #ifdef ENABLE_TEST_ALL
                                   uint32_t iter) {
-  //   const int32_t *a = (const int32_t *)impl.test_cases_int_pointer1;
-  //   const int32_t *b = (const int32_t *)impl.test_cases_int_pointer2;
-  //   __m128i data = _mm_loadu_si128((const __m128i *)a);
-  //   __m128i rk = _mm_loadu_si128((const __m128i *)b);
-  //
-  //   __m128i resultReference = aesenclast_128_reference(data, rk);
-  //   __m128i resultIntrinsic = _mm_aesenclast_si128(data, rk);
-  //
-  //   return validate_128bits(resultReference, resultIntrinsic);
-  // #else
-  return TEST_UNIMPL;
-  // #endif  // ENABLE_TEST_ALL
+  const int32_t *a = (const int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *b = (const int32_t *)impl.test_cases_int_pointer2;
+  __m128i data = _mm_loadu_si128((const __m128i *)a);
+  __m128i rk = _mm_loadu_si128((const __m128i *)b);
+
+  __m128i resultReference = aesenclast_128_reference(data, rk);
+  __m128i resultIntrinsic = _mm_aesenclast_si128(data, rk);
+
+  return validate_128bits(resultReference, resultIntrinsic);
 }
 
 result_t test_mm_aesdeclast_si128(const SSE2RVV_TEST_IMPL &impl,
-                                  // #ifdef ENABLE_TEST_ALL
                                   uint32_t iter) {
-  //   const uint8_t *a = (uint8_t *)impl.test_cases_int_pointer1;
-  //   const uint8_t *rk = (uint8_t *)impl.test_cases_int_pointer2;
-  //   __m128i _a = _mm_loadu_si128((const __m128i *)a);
-  //   __m128i _rk = _mm_loadu_si128((const __m128i *)rk);
-  //   uint8_t c[16] = {};
-  //
-  //   uint8_t v[4][4];
-  //   for (int i = 0; i < 16; ++i) {
-  //     v[((i / 4) + (i % 4)) % 4][i % 4] = crypto_aes_rsbox[a[i]];
-  //   }
-  //   for (int i = 0; i < 16; ++i) {
-  //     c[i] = v[i / 4][i % 4] ^ rk[i];
-  //   }
-  //
-  //   __m128i result_reference = _mm_loadu_si128((const __m128i *)c);
-  //   __m128i result_intrinsic = _mm_aesdeclast_si128(_a, _rk);
-  //
-  //   return validate_128bits(result_reference, result_intrinsic);
-  // #else
-  return TEST_UNIMPL;
-  // #endif  // ENABLE_TEST_ALL
+  const uint8_t *a = (uint8_t *)impl.test_cases_int_pointer1;
+  const uint8_t *rk = (uint8_t *)impl.test_cases_int_pointer2;
+  __m128i _a = _mm_loadu_si128((const __m128i *)a);
+  __m128i _rk = _mm_loadu_si128((const __m128i *)rk);
+  uint8_t c[16] = {};
+
+  uint8_t v[4][4];
+  for (int i = 0; i < 16; ++i) {
+    v[((i / 4) + (i % 4)) % 4][i % 4] = crypto_aes_rsbox[a[i]];
+  }
+  for (int i = 0; i < 16; ++i) {
+    c[i] = v[i / 4][i % 4] ^ rk[i];
+  }
+
+  __m128i result_reference = _mm_loadu_si128((const __m128i *)c);
+  __m128i result_intrinsic = _mm_aesdeclast_si128(_a, _rk);
+
+  return validate_128bits(result_reference, result_intrinsic);
 }
 
 result_t test_mm_aesimc_si128(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
-  // #ifdef ENABLE_TEST_ALL
-  //   const uint8_t *a = (uint8_t *)impl.test_cases_int_pointer1;
-  //   __m128i _a = _mm_loadu_si128((const __m128i *)a);
-  //
-  //   uint8_t e, f, g, h, v[4][4];
-  //   for (int i = 0; i < 16; ++i) {
-  //     ((uint8_t *)v)[i] = a[i];
-  //   }
-  //   for (int i = 0; i < 4; ++i) {
-  //     e = v[i][0];
-  //     f = v[i][1];
-  //     g = v[i][2];
-  //     h = v[i][3];
-  //
-  //     v[i][0] = MULTIPLY(e, 0x0e) ^ MULTIPLY(f, 0x0b) ^ MULTIPLY(g, 0x0d) ^
-  //               MULTIPLY(h, 0x09);
-  //     v[i][1] = MULTIPLY(e, 0x09) ^ MULTIPLY(f, 0x0e) ^ MULTIPLY(g, 0x0b) ^
-  //               MULTIPLY(h, 0x0d);
-  //     v[i][2] = MULTIPLY(e, 0x0d) ^ MULTIPLY(f, 0x09) ^ MULTIPLY(g, 0x0e) ^
-  //               MULTIPLY(h, 0x0b);
-  //     v[i][3] = MULTIPLY(e, 0x0b) ^ MULTIPLY(f, 0x0d) ^ MULTIPLY(g, 0x09) ^
-  //               MULTIPLY(h, 0x0e);
-  //   }
-  //
-  //   __m128i result_reference = _mm_loadu_si128((const __m128i *)v);
-  //   __m128i result_intrinsic = _mm_aesimc_si128(_a);
-  //
-  //   return validate_128bits(result_reference, result_intrinsic);
-  // #else
-  return TEST_UNIMPL;
-  // #endif  // ENABLE_TEST_ALL
+  const uint8_t *a = (uint8_t *)impl.test_cases_int_pointer1;
+  __m128i _a = _mm_loadu_si128((const __m128i *)a);
+
+  uint8_t e, f, g, h, v[4][4];
+  for (int i = 0; i < 16; ++i) {
+    ((uint8_t *)v)[i] = a[i];
+  }
+  for (int i = 0; i < 4; ++i) {
+    e = v[i][0];
+    f = v[i][1];
+    g = v[i][2];
+    h = v[i][3];
+
+    v[i][0] = MULTIPLY(e, 0x0e) ^ MULTIPLY(f, 0x0b) ^ MULTIPLY(g, 0x0d) ^
+              MULTIPLY(h, 0x09);
+    v[i][1] = MULTIPLY(e, 0x09) ^ MULTIPLY(f, 0x0e) ^ MULTIPLY(g, 0x0b) ^
+              MULTIPLY(h, 0x0d);
+    v[i][2] = MULTIPLY(e, 0x0d) ^ MULTIPLY(f, 0x09) ^ MULTIPLY(g, 0x0e) ^
+              MULTIPLY(h, 0x0b);
+    v[i][3] = MULTIPLY(e, 0x0b) ^ MULTIPLY(f, 0x0d) ^ MULTIPLY(g, 0x09) ^
+              MULTIPLY(h, 0x0e);
+  }
+
+  __m128i result_reference = _mm_loadu_si128((const __m128i *)v);
+  __m128i result_intrinsic = _mm_aesimc_si128(_a);
+
+  return validate_128bits(result_reference, result_intrinsic);
 }
 
 static inline uint32_t sub_word(uint32_t in) {
@@ -8762,61 +9030,498 @@ static inline uint32_t sub_word(uint32_t in) {
 // Reference:
 // https://github.com/randombit/botan/blob/master/src/lib/block/aes/aes_ni/aes_ni.cpp
 result_t test_mm_aeskeygenassist_si128(const SSE2RVV_TEST_IMPL &impl,
-                                       // #ifdef ENABLE_TEST_ALL
                                        uint32_t iter) {
-  //   const uint32_t *a = (uint32_t *)impl.test_cases_int_pointer1;
-  //   __m128i data = load_m128i(a);
-  //   uint32_t sub_x1 = sub_word(a[1]);
-  //   uint32_t sub_x3 = sub_word(a[3]);
-  //   __m128i result_reference;
-  //   __m128i result_intrinsic;
-  // #define TEST_IMPL(IDX)
-  //   uint32_t res##IDX[4] = {
-  //       sub_x1,
-  //       rotr(sub_x1, 8) ^ IDX,
-  //       sub_x3,
-  //       rotr(sub_x3, 8) ^ IDX,
-  //   };
-  //   result_reference = load_m128i(res##IDX);
-  //   result_intrinsic = _mm_aeskeygenassist_si128(data, IDX);
-  //   CHECK_RESULT(validate_128bits(result_reference, result_intrinsic));
-  //
-  //   IMM_256_ITER
-  // #undef TEST_IMPL
-  //   return TEST_SUCCESS;
-  // #else
-  return TEST_UNIMPL;
-  // #endif  // ENABLE_TEST_ALL
+  const uint32_t *a = (uint32_t *)impl.test_cases_int_pointer1;
+  __m128i data = load_m128i(a);
+  uint32_t sub_x1 = sub_word(a[1]);
+  uint32_t sub_x3 = sub_word(a[3]);
+  __m128i result_reference;
+  __m128i result_intrinsic;
+#define TEST_IMPL(IDX)                                                         \
+  uint32_t res##IDX[4] = {                                                     \
+      sub_x1,                                                                  \
+      rotr(sub_x1, 8) ^ IDX,                                                   \
+      sub_x3,                                                                  \
+      rotr(sub_x3, 8) ^ IDX,                                                   \
+  };                                                                           \
+  result_reference = load_m128i(res##IDX);                                     \
+  result_intrinsic = _mm_aeskeygenassist_si128(data, IDX);                     \
+  CHECK_RESULT(validate_128bits(result_reference, result_intrinsic));
+
+  IMM_256_ITER
+#undef TEST_IMPL
+  return TEST_SUCCESS;
+}
+
+/* FMA */
+result_t test_mm_fmadd_ps(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
+  const float *_a = impl.test_cases_float_pointer1;
+  const float *_b = impl.test_cases_float_pointer2;
+  const float *_c = impl.test_cases_floats + iter;
+
+  float f0 = fmaf(_a[0], _b[0], _c[0]);
+  float f1 = fmaf(_a[1], _b[1], _c[1]);
+  float f2 = fmaf(_a[2], _b[2], _c[2]);
+  float f3 = fmaf(_a[3], _b[3], _c[3]);
+
+  __m128 a = load_m128(_a);
+  __m128 b = load_m128(_b);
+  __m128 c = load_m128(_c);
+  __m128 d = _mm_fmadd_ps(a, b, c);
+
+  return validate_float(d, f0, f1, f2, f3);
+}
+
+result_t test_mm_fmsub_pd(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
+  const double *_a = (const double *)impl.test_cases_float_pointer1;
+  const double *_b = (const double *)impl.test_cases_float_pointer2;
+  const double *_c = (const double *)(impl.test_cases_floats + iter);
+
+  double d0 = fma(_a[0], _b[0], -_c[0]);
+  double d1 = fma(_a[1], _b[1], -_c[1]);
+
+  __m128d a = load_m128d(_a);
+  __m128d b = load_m128d(_b);
+  __m128d c = load_m128d(_c);
+  __m128d d = _mm_fmsub_pd(a, b, c);
+
+  return validate_double(d, d0, d1);
+}
+
+result_t test_mm_fnmadd_ps(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
+  const float *_a = impl.test_cases_float_pointer1;
+  const float *_b = impl.test_cases_float_pointer2;
+  const float *_c = impl.test_cases_floats + iter;
+
+  float f0 = fmaf(-_a[0], _b[0], _c[0]);
+  float f1 = fmaf(-_a[1], _b[1], _c[1]);
+  float f2 = fmaf(-_a[2], _b[2], _c[2]);
+  float f3 = fmaf(-_a[3], _b[3], _c[3]);
+
+  __m128 a = load_m128(_a);
+  __m128 b = load_m128(_b);
+  __m128 c = load_m128(_c);
+  __m128 d = _mm_fnmadd_ps(a, b, c);
+
+  return validate_float(d, f0, f1, f2, f3);
+}
+
+result_t test_mm_fnmsub_sd(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
+  const double *_a = (const double *)impl.test_cases_float_pointer1;
+  const double *_b = (const double *)impl.test_cases_float_pointer2;
+  const double *_c = (const double *)(impl.test_cases_floats + iter);
+
+  double d0 = fma(-_a[0], _b[0], -_c[0]);
+  double d1 = _a[1];
+
+  __m128d a = load_m128d(_a);
+  __m128d b = load_m128d(_b);
+  __m128d c = load_m128d(_c);
+  __m128d d = _mm_fnmsub_sd(a, b, c);
+
+  return validate_double(d, d0, d1);
+}
+
+result_t test_mm_fmadd_ss(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
+  const float *_a = impl.test_cases_float_pointer1;
+  const float *_b = impl.test_cases_float_pointer2;
+  const float *_c = impl.test_cases_floats + iter;
+
+  float f0 = fmaf(_a[0], _b[0], _c[0]);
+
+  __m128 a = load_m128(_a);
+  __m128 b = load_m128(_b);
+  __m128 c = load_m128(_c);
+  __m128 d = _mm_fmadd_ss(a, b, c);
+
+  return validate_float(d, f0, _a[1], _a[2], _a[3]);
+}
+
+result_t test_mm_fmaddsub_ps(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
+  const float *_a = impl.test_cases_float_pointer1;
+  const float *_b = impl.test_cases_float_pointer2;
+  const float *_c = impl.test_cases_floats + iter;
+
+  float f0 = fmaf(_a[0], _b[0], -_c[0]);
+  float f1 = fmaf(_a[1], _b[1], _c[1]);
+  float f2 = fmaf(_a[2], _b[2], -_c[2]);
+  float f3 = fmaf(_a[3], _b[3], _c[3]);
+
+  __m128 a = load_m128(_a);
+  __m128 b = load_m128(_b);
+  __m128 c = load_m128(_c);
+  __m128 d = _mm_fmaddsub_ps(a, b, c);
+
+  return validate_float(d, f0, f1, f2, f3);
+}
+
+/* SHA */
+// Scalar SHA-NI models after the Intel pseudocode; element 0 of each array is
+// the low 32 bits of the vector.
+static inline uint32_t rotl(uint32_t value, uint32_t amount) {
+  return (value << amount) | (value >> (32 - amount));
+}
+
+static uint32_t sha256_sigma0(uint32_t x) {
+  return rotr(x, 7) ^ rotr(x, 18) ^ (x >> 3);
+}
+
+static uint32_t sha256_sigma1(uint32_t x) {
+  return rotr(x, 17) ^ rotr(x, 19) ^ (x >> 10);
+}
+
+static void sha1rnds4_reference(const uint32_t *a, const uint32_t *b,
+                                int func, uint32_t *r) {
+  static const uint32_t k[4] = {0x5a827999, 0x6ed9eba1, 0x8f1bbcdc,
+                                0xca62c1d6};
+  uint32_t A = a[3], B = a[2], C = a[1], D = a[0], E = 0;
+  for (int i = 0; i < 4; i++) {
+    uint32_t f = func == 0   ? (B & C) ^ (~B & D)
+                 : func == 2 ? (B & C) ^ (B & D) ^ (C & D)
+                             : B ^ C ^ D;
+    uint32_t t = f + rotl(A, 5) + b[3 - i] + E + k[func];
+    E = D;
+    D = C;
+    C = rotl(B, 30);
+    B = A;
+    A = t;
+  }
+  r[0] = D;
+  r[1] = C;
+  r[2] = B;
+  r[3] = A;
+}
+
+result_t test_mm_sha1msg1_epu32(const SSE2RVV_TEST_IMPL &impl,
+                                uint32_t iter) {
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  const uint32_t *_b = (const uint32_t *)impl.test_cases_int_pointer2;
+  uint32_t d[4] = {_a[0] ^ _b[2], _a[1] ^ _b[3], _a[2] ^ _a[0],
+                   _a[3] ^ _a[1]};
+  __m128i c = _mm_sha1msg1_epu32(load_m128i(_a), load_m128i(_b));
+  return VALIDATE_UINT32_M128(c, d);
+}
+
+result_t test_mm_sha1msg2_epu32(const SSE2RVV_TEST_IMPL &impl,
+                                uint32_t iter) {
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  const uint32_t *_b = (const uint32_t *)impl.test_cases_int_pointer2;
+  uint32_t d[4];
+  d[3] = rotl(_a[3] ^ _b[2], 1);
+  d[2] = rotl(_a[2] ^ _b[1], 1);
+  d[1] = rotl(_a[1] ^ _b[0], 1);
+  d[0] = rotl(_a[0] ^ d[3], 1);
+  __m128i c = _mm_sha1msg2_epu32(load_m128i(_a), load_m128i(_b));
+  return VALIDATE_UINT32_M128(c, d);
+}
+
+result_t test_mm_sha1nexte_epu32(const SSE2RVV_TEST_IMPL &impl,
+                                 uint32_t iter) {
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  const uint32_t *_b = (const uint32_t *)impl.test_cases_int_pointer2;
+  uint32_t d[4] = {_b[0], _b[1], _b[2], _b[3] + rotl(_a[3], 30)};
+  __m128i c = _mm_sha1nexte_epu32(load_m128i(_a), load_m128i(_b));
+  return VALIDATE_UINT32_M128(c, d);
+}
+
+result_t test_mm_sha1rnds4_epu32(const SSE2RVV_TEST_IMPL &impl,
+                                 uint32_t iter) {
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  const uint32_t *_b = (const uint32_t *)impl.test_cases_int_pointer2;
+  __m128i a = load_m128i(_a);
+  __m128i b = load_m128i(_b);
+  uint32_t d[4];
+#define TEST_IMPL(IDX)                                                         \
+  sha1rnds4_reference(_a, _b, IDX, d);                                         \
+  CHECK_RESULT(VALIDATE_UINT32_M128(_mm_sha1rnds4_epu32(a, b, IDX), d));
+
+  IMM_4_ITER
+#undef TEST_IMPL
+  return TEST_SUCCESS;
+}
+
+result_t test_mm_sha256msg1_epu32(const SSE2RVV_TEST_IMPL &impl,
+                                  uint32_t iter) {
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  const uint32_t *_b = (const uint32_t *)impl.test_cases_int_pointer2;
+  uint32_t d[4];
+  for (int i = 0; i < 4; i++)
+    d[i] = _a[i] + sha256_sigma0(i < 3 ? _a[i + 1] : _b[0]);
+  __m128i c = _mm_sha256msg1_epu32(load_m128i(_a), load_m128i(_b));
+  return VALIDATE_UINT32_M128(c, d);
+}
+
+result_t test_mm_sha256msg2_epu32(const SSE2RVV_TEST_IMPL &impl,
+                                  uint32_t iter) {
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  const uint32_t *_b = (const uint32_t *)impl.test_cases_int_pointer2;
+  uint32_t d[4];
+  d[0] = _a[0] + sha256_sigma1(_b[2]);
+  d[1] = _a[1] + sha256_sigma1(_b[3]);
+  d[2] = _a[2] + sha256_sigma1(d[0]);
+  d[3] = _a[3] + sha256_sigma1(d[1]);
+  __m128i c = _mm_sha256msg2_epu32(load_m128i(_a), load_m128i(_b));
+  return VALIDATE_UINT32_M128(c, d);
+}
+
+result_t test_mm_sha256rnds2_epu32(const SSE2RVV_TEST_IMPL &impl,
+                                   uint32_t iter) {
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  const uint32_t *_b = (const uint32_t *)impl.test_cases_int_pointer2;
+  const uint32_t *_k = (const uint32_t *)impl.test_cases_ints + iter;
+  uint32_t A = _b[3], B = _b[2], C = _a[3], D = _a[2];
+  uint32_t E = _b[1], F = _b[0], G = _a[1], H = _a[0];
+  for (int i = 0; i < 2; i++) {
+    uint32_t t1 = H + (rotr(E, 6) ^ rotr(E, 11) ^ rotr(E, 25)) +
+                  ((E & F) ^ (~E & G)) + _k[i];
+    uint32_t t2 = (rotr(A, 2) ^ rotr(A, 13) ^ rotr(A, 22)) +
+                  ((A & B) ^ (A & C) ^ (B & C));
+    H = G;
+    G = F;
+    F = E;
+    E = D + t1;
+    D = C;
+    C = B;
+    B = A;
+    A = t1 + t2;
+  }
+  uint32_t d[4] = {F, E, B, A};
+  __m128i c = _mm_sha256rnds2_epu32(load_m128i(_a), load_m128i(_b),
+                                    load_m128i(_k));
+  return VALIDATE_UINT32_M128(c, d);
+}
+
+/* F16C */
+// Independent references for the half-precision conversions: rounding is
+// done on the value scaled to whole units of the result's last place.
+static uint16_t cvtps_ph_reference(float f, int rounding) {
+  uint32_t bits;
+  memcpy(&bits, &f, sizeof(bits));
+  uint16_t sign = (bits >> 16) & 0x8000;
+  if (isnan(f))
+    return sign | 0x7e00 | ((bits >> 13) & 0x3ff);
+  if (isinf(f))
+    return sign | 0x7c00;
+  bool away = (rounding == _MM_FROUND_TO_POS_INF && !sign) ||
+              (rounding == _MM_FROUND_TO_NEG_INF && sign);
+  double a = fabs((double)f);
+  int e;
+  frexp(a, &e);
+  int ulp = e - 11 < -24 ? -24 : e - 11;
+  double q = ldexp(a, -ulp), r = floor(q);
+  if (rounding == _MM_FROUND_TO_NEAREST_INT) {
+    if (q - r > 0.5 || (q - r == 0.5 && fmod(r, 2.0) != 0.0))
+      r += 1.0;
+  } else if (away) {
+    r = ceil(q);
+  }
+  r = ldexp(r, ulp);
+  if (r > 65504.0)
+    return sign | (rounding == _MM_FROUND_TO_NEAREST_INT || away ? 0x7c00
+                                                                  : 0x7bff);
+  if (r < ldexp(1.0, -14))
+    return sign | (uint16_t)ldexp(r, 24);
+  frexp(r, &e);
+  return sign | (uint16_t)((e + 14) << 10) |
+         (uint16_t)(ldexp(r, 11 - e) - 1024.0);
+}
+
+static uint32_t cvtph_ps_reference(uint16_t h) {
+  uint32_t sign = (uint32_t)(h & 0x8000) << 16;
+  int e = (h >> 10) & 0x1f, m = h & 0x3ff;
+  if (e == 0x1f)
+    return sign | 0x7f800000 | (m ? 0x00400000 | (uint32_t)m << 13 : 0);
+  float f = e ? ldexpf((float)(1024 + m), e - 25) : ldexpf((float)m, -24);
+  uint32_t bits;
+  memcpy(&bits, &f, sizeof(bits));
+  return sign | bits;
+}
+
+// RISC-V returns the canonical NaN, so NaN results only have to be NaNs
+static bool f16c_bits_equal(uint32_t r, uint32_t e, uint32_t exp_mask) {
+  if ((e & exp_mask) == exp_mask && (e & ~exp_mask & (exp_mask >> 1)))
+    return (r & exp_mask) == exp_mask && (r & ~exp_mask & (exp_mask >> 1));
+  return r == e;
+}
+
+// Single-precision inputs around the half-precision range: values that
+// overflow, normals, denormals and values that round to zero, with one
+// lane replaced by a special case
+static const uint32_t f16c_float_specials[] = {
+    0x00000000, 0x80000000, 0x7f800000, 0xff800000, 0x7fc01234, 0xffa00000,
+    0x477fe000, 0x477fefff, 0x477ff000, 0xc77ff000, 0x7f7fffff, 0x00000001,
+    0x33800000, 0x33000000, 0x33000001, 0xb3400000, 0x387fc000, 0x38800000,
+    0x3f801000, 0x3f803000, 0xbf801000, 0x3f801001, 0x387fe000, 0x33c00000};
+#define F16C_FLOAT_SPECIALS                                                    \
+  (sizeof(f16c_float_specials) / sizeof(f16c_float_specials[0]))
+
+static void f16c_test_floats(const uint32_t *ints, uint32_t iter, float *f,
+                             int n) {
+  for (int i = 0; i < n; i++) {
+    uint32_t bits = (ints[i] & 0x807fffff) |
+                    (98 + ((ints[i] >> 23) & 0xff) % 48) << 23;
+    memcpy(&f[i], &bits, sizeof(bits));
+  }
+  memcpy(&f[iter % n], &f16c_float_specials[iter % F16C_FLOAT_SPECIALS],
+         sizeof(float));
+}
+
+static const uint16_t f16c_half_specials[] = {
+    0x0000, 0x8000, 0x0001, 0x83ff, 0x0400, 0x7bff, 0x7c00,
+    0xfc00, 0x7c01, 0x7e00, 0xfd55, 0x3c00, 0x3555, 0x03ff};
+#define F16C_HALF_SPECIALS                                                     \
+  (sizeof(f16c_half_specials) / sizeof(f16c_half_specials[0]))
+
+result_t test_mm_cvtph_ps(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
+  const uint16_t *_a = (const uint16_t *)(impl.test_cases_ints + iter);
+  uint16_t h[8];
+  memcpy(h, _a, sizeof(h));
+  h[iter % 4] = f16c_half_specials[iter % F16C_HALF_SPECIALS];
+
+  __m128 c = _mm_cvtph_ps(load_m128i(h));
+  uint32_t r[4];
+  memcpy(r, &c, sizeof(r));
+  for (int i = 0; i < 4; i++) {
+    if (!f16c_bits_equal(r[i], cvtph_ps_reference(h[i]), 0x7f800000))
+      return TEST_FAIL;
+  }
+  return TEST_SUCCESS;
+}
+
+result_t test_mm_cvtps_ph(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
+  static const int modes[4] = {_MM_ROUND_NEAREST, _MM_ROUND_DOWN, _MM_ROUND_UP,
+                               _MM_ROUND_TOWARD_ZERO};
+  float f[4];
+  f16c_test_floats((const uint32_t *)(impl.test_cases_ints + iter), iter, f,
+                   4);
+  __m128 a = load_m128(f);
+  uint16_t r[8];
+
+  // Failures only clear ok, so the rounding mode is always restored
+  bool ok = true;
+#define TEST_CVTPS_PH(imm8, rounding)                                          \
+  _mm_storeu_si128((__m128i *)r, _mm_cvtps_ph(a, imm8));                       \
+  for (int i = 0; i < 8; i++) {                                                \
+    uint16_t expected = i < 4 ? cvtps_ph_reference(f[i], rounding) : 0;        \
+    if (!f16c_bits_equal(r[i], expected, 0x7c00))                              \
+      ok = false;                                                              \
+  }
+
+  TEST_CVTPS_PH(_MM_FROUND_TO_NEAREST_INT, _MM_FROUND_TO_NEAREST_INT)
+  TEST_CVTPS_PH(_MM_FROUND_TO_NEG_INF, _MM_FROUND_TO_NEG_INF)
+  TEST_CVTPS_PH(_MM_FROUND_TO_POS_INF, _MM_FROUND_TO_POS_INF)
+  TEST_CVTPS_PH(_MM_FROUND_TO_ZERO, _MM_FROUND_TO_ZERO)
+  _MM_SET_ROUNDING_MODE(modes[iter & 3]);
+  TEST_CVTPS_PH(_MM_FROUND_CUR_DIRECTION, (int)(iter & 3))
+  _MM_SET_ROUNDING_MODE(_MM_ROUND_NEAREST);
+#undef TEST_CVTPS_PH
+  return ok ? TEST_SUCCESS : TEST_FAIL;
+}
+
+/* BMI */
+result_t test_bextr_u32(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
+  const uint32_t *a = (const uint32_t *)impl.test_cases_int_pointer1;
+  const uint32_t *b = (const uint32_t *)impl.test_cases_int_pointer2;
+  uint32_t start = b[0] % 40;
+  uint32_t len = b[1] % 40;
+  uint32_t d = start >= 32 ? 0 : a[0] >> start;
+  if (len < 32)
+    d &= (UINT32_C(1) << len) - 1;
+  ASSERT_RETURN(_bextr_u32(a[0], start, len) == d);
+  return TEST_SUCCESS;
+}
+
+result_t test_blsr_u64(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
+  const uint64_t *a = (const uint64_t *)impl.test_cases_int_pointer1;
+  uint64_t d = a[0];
+  for (int i = 0; i < 64; i++) {
+    if (d & (UINT64_C(1) << i)) {
+      d &= ~(UINT64_C(1) << i);
+      break;
+    }
+  }
+  ASSERT_RETURN(_blsr_u64(a[0]) == d);
+  return TEST_SUCCESS;
+}
+
+result_t test_lzcnt_u32(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
+  const uint32_t *a = (const uint32_t *)impl.test_cases_int_pointer1;
+  // Shift by a varying amount so that short counts, long counts and zero
+  // are all exercised.
+  uint32_t x = iter % 33 == 32 ? 0 : a[0] >> (iter % 33);
+  uint32_t d = 32;
+  for (int i = 31; i >= 0; i--) {
+    if (x & (UINT32_C(1) << i)) {
+      d = 31 - i;
+      break;
+    }
+  }
+  ASSERT_RETURN(_lzcnt_u32(x) == d);
+  return TEST_SUCCESS;
+}
+
+result_t test_pdep_u64(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
+  const uint64_t *a = (const uint64_t *)impl.test_cases_int_pointer1;
+  const uint64_t *mask = (const uint64_t *)impl.test_cases_int_pointer2;
+  uint64_t d = 0;
+  for (int i = 0, k = 0; i < 64; i++) {
+    if (mask[0] & (UINT64_C(1) << i)) {
+      d |= ((a[0] >> k) & 1) << i;
+      k++;
+    }
+  }
+  ASSERT_RETURN(_pdep_u64(a[0], mask[0]) == d);
+  return TEST_SUCCESS;
+}
+
+result_t test_pext_u64(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
+  const uint64_t *a = (const uint64_t *)impl.test_cases_int_pointer1;
+  const uint64_t *mask = (const uint64_t *)impl.test_cases_int_pointer2;
+  uint64_t d = 0;
+  for (int i = 0, k = 0; i < 64; i++) {
+    if (mask[0] & (UINT64_C(1) << i)) {
+      d |= ((a[0] >> i) & 1) << k;
+      k++;
+    }
+  }
+  ASSERT_RETURN(_pext_u64(a[0], mask[0]) == d);
+  return TEST_SUCCESS;
+}
+
+result_t test_tzcnt_u64(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
+  const uint64_t *a = (const uint64_t *)impl.test_cases_int_pointer1;
+  uint64_t x = iter % 65 == 64 ? 0 : a[0] << (iter % 65);
+  uint64_t d = 64;
+  for (int i = 0; i < 64; i++) {
+    if (x & (UINT64_C(1) << i)) {
+      d = i;
+      break;
+    }
+  }
+  ASSERT_RETURN(_tzcnt_u64(x) == d);
+  return TEST_SUCCESS;
 }
 
 /* Others */
 result_t test_mm_clmulepi64_si128(const SSE2RVV_TEST_IMPL &impl,
-                                  // #ifdef ENABLE_TEST_ALL
                                   uint32_t iter) {
-  //   const uint64_t *_a = (const uint64_t *)impl.test_cases_int_pointer1;
-  //   const uint64_t *_b = (const uint64_t *)impl.test_cases_int_pointer2;
-  //   __m128i a = load_m128i(_a);
-  //   __m128i b = load_m128i(_b);
-  //   auto result = clmul_64(_a[0], _b[0]);
-  //   if (!validate_uint64(_mm_clmulepi64_si128(a, b, 0x00), result.first,
-  //                        result.second))
-  //     return TEST_FAIL;
-  //   result = clmul_64(_a[1], _b[0]);
-  //   if (!validate_uint64(_mm_clmulepi64_si128(a, b, 0x01), result.first,
-  //                        result.second))
-  //     return TEST_FAIL;
-  //   result = clmul_64(_a[0], _b[1]);
-  //   if (!validate_uint64(_mm_clmulepi64_si128(a, b, 0x10), result.first,
-  //                        result.second))
-  //     return TEST_FAIL;
-  //   result = clmul_64(_a[1], _b[1]);
-  //   if (!validate_uint64(_mm_clmulepi64_si128(a, b, 0x11), result.first,
-  //                        result.second))
-  //     return TEST_FAIL;
-  //   return TEST_SUCCESS;
-  // #else
-  return TEST_UNIMPL;
-  // #endif  // ENABLE_TEST_ALL
+  const uint64_t *_a = (const uint64_t *)impl.test_cases_int_pointer1;
+  const uint64_t *_b = (const uint64_t *)impl.test_cases_int_pointer2;
+  __m128i a = load_m128i(_a);
+  __m128i b = load_m128i(_b);
+  auto result = clmul_64(_a[0], _b[0]);
+  CHECK_RESULT(validate_uint64(_mm_clmulepi64_si128(a, b, 0x00), result.first,
+                               result.second));
+  result = clmul_64(_a[1], _b[0]);
+  CHECK_RESULT(validate_uint64(_mm_clmulepi64_si128(a, b, 0x01), result.first,
+                               result.second));
+  result = clmul_64(_a[0], _b[1]);
+  CHECK_RESULT(validate_uint64(_mm_clmulepi64_si128(a, b, 0x10), result.first,
+                               result.second));
+  result = clmul_64(_a[1], _b[1]);
+  CHECK_RESULT(validate_uint64(_mm_clmulepi64_si128(a, b, 0x11), result.first,
+                               result.second));
+  return TEST_SUCCESS;
 }
 
 result_t test_mm_get_denormals_zero_mode(const SSE2RVV_TEST_IMPL &impl,
@@ -8839,33 +9544,25 @@ result_t test_mm_get_denormals_zero_mode(const SSE2RVV_TEST_IMPL &impl,
   // #endif  // ENABLE_TEST_ALL
 }
 
-// static int popcnt_reference(uint64_t a) {
-// int count = 0;
-// while (a != 0) {
-//   count += a & 1;
-//   a >>= 1;
-// }
-// return count;
-// }
+static int popcnt_reference(uint64_t a) {
+  int count = 0;
+  while (a != 0) {
+    count += a & 1;
+    a >>= 1;
+  }
+  return count;
+}
 
 result_t test_mm_popcnt_u32(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
-  // #ifdef ENABLE_TEST_ALL
-  //   const uint64_t *a = (const uint64_t *)impl.test_cases_int_pointer1;
-  //   ASSERT_RETURN(popcnt_reference((uint32_t)a[0]) == _mm_popcnt_u32(a[0]));
-  //   return TEST_SUCCESS;
-  // #else
-  return TEST_UNIMPL;
-  // #endif  // ENABLE_TEST_ALL
+  const uint64_t *a = (const uint64_t *)impl.test_cases_int_pointer1;
+  ASSERT_RETURN(popcnt_reference((uint32_t)a[0]) == _mm_popcnt_u32(a[0]));
+  return TEST_SUCCESS;
 }
 
 result_t test_mm_popcnt_u64(const SSE2RVV_TEST_IMPL &impl, uint32_t iter) {
-  // #ifdef ENABLE_TEST_ALL
-  //   const uint64_t *a = (const uint64_t *)impl.test_cases_int_pointer1;
-  //   ASSERT_RETURN(popcnt_reference(a[0]) == _mm_popcnt_u64(a[0]));
-  //   return TEST_SUCCESS;
-  // #else
-  return TEST_UNIMPL;
-  // #endif  // ENABLE_TEST_ALL
+  const uint64_t *a = (const uint64_t *)impl.test_cases_int_pointer1;
+  ASSERT_RETURN(popcnt_reference(a[0]) == _mm_popcnt_u64(a[0]));
+  return TEST_SUCCESS;
 }
 
 result_t test_mm_set_denormals_zero_mode(const SSE2RVV_TEST_IMPL &impl,
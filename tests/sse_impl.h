@@ -504,25 +504,26 @@
   _(mm_testnzc_si128)                                                          \
   _(mm_testz_si128)                                                            \
   /* SSE4.2 */                                                                 \
-  /*_(mm_cmpestra)*/                                                           \
-  /*_(mm_cmpestrc) */                                                          \
-  /*_(mm_cmpestri) */                                                          \
-  /*_(mm_cmpestrm) */                                                          \
-  /*_(mm_cmpestro) */                                                          \
-  /*_(mm_cmpestrs) */                                                          \
-  /*_(mm_cmpestrz) */                                                          \
+  _(mm_cmpestra)                                                               \
+  _(mm_cmpestrc)                                                               \
+  _(mm_cmpestri)                                                               \
+  _(mm_cmpestrm)                                                               \
+  _(mm_cmpestro)                                                               \
+  _(mm_cmpestrs)                                                               \
+  _(mm_cmpestrz)                                                               \
   /*_(mm_cmpgt_epi64) */                                                       \
-  /*_(mm_cmpistra) */                                                          \
-  /*_(mm_cmpistrc) */                                                          \
-  /*_(mm_cmpistri) */                                                          \
-  /*_(mm_cmpistrm) */                                                          \
-  /*_(mm_cmpistro) */                                                          \
-  /*_(mm_cmpistrs) */                                                          \
-  /*_(mm_cmpistrz) */                                                          \
+  _(mm_cmpistra)                                                               \
+  _(mm_cmpistrc)                                                               \
+  _(mm_cmpistri)                                                               \
+  _(mm_cmpistrm)                                                               \
+  _(mm_cmpistro)                                                               \
+  _(mm_cmpistrs)                                                               \
+  _(mm_cmpistrz)                                                               \
   _(mm_crc32_u16)                                                              \
   _(mm_crc32_u32)                                                              \
   _(mm_crc32_u64)                                                              \
   _(mm_crc32_u8)                                                               \
+  _(sse2rvv_crc32c)                                                            \
   /* AES */                                                                    \
   _(mm_aesenc_si128)                                                           \
   _(mm_aesdec_si128)                                                           \
@@ -530,6 +531,31 @@
   _(mm_aesdeclast_si128)                                                       \
   _(mm_aesimc_si128)                                                           \
   _(mm_aeskeygenassist_si128)                                                  \
+  /* FMA */                                                                    \
+  _(mm_fmadd_ps)                                                               \
+  _(mm_fmsub_pd)                                                               \
+  _(mm_fnmadd_ps)                                                              \
+  _(mm_fnmsub_sd)                                                              \
+  _(mm_fmadd_ss)                                                               \
+  _(mm_fmaddsub_ps)                                                            \
+  /* SHA */                                                                    \
+  _(mm_sha1msg1_epu32)                                                         \
+  _(mm_sha1msg2_epu32)                                                         \
+  _(mm_sha1nexte_epu32)                                                        \
+  _(mm_sha1rnds4_epu32)                                                        \
+  _(mm_sha256msg1_epu32)                                                       \
+  _(mm_sha256msg2_epu32)                                                       \
+  _(mm_sha256rnds2_epu32)                                                      \
+  /* F16C */                                                                   \
+  _(mm_cvtph_ps)                                                               \
+  _(mm_cvtps_ph)                                                               \
+  /* BMI */                                                                    \
+  _(bextr_u32)                                                                 \
+  _(blsr_u64)                                                                  \
+  _(lzcnt_u32)                                                                 \
+  _(pdep_u64)                                                                  \
+  _(pext_u64)                                                                  \
+  _(tzcnt_u64)                                                                 \
   /* Others */                                                                 \
   _(mm_clmulepi64_si128)                                                       \
   _(mm_get_denormals_zero_mode)                                                \